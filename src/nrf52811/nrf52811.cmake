@@ -53,6 +53,17 @@ target_compile_definitions(ot-config INTERFACE
 )
 set(OT_PUBLIC_INCLUDES ${OT_PUBLIC_INCLUDES} PARENT_SCOPE)
 
+# The radio driver sizes its buffers from the same profile, so it goes through ot-config.
+set(OT_MEMORY_PROFILE "" CACHE STRING "Buffer sizing profile: MTD, RCP or empty for the default sizes")
+if(OT_MEMORY_PROFILE)
+    if(NOT OT_MEMORY_PROFILE MATCHES "^(MTD|RCP)$")
+        message(FATAL_ERROR "Unsupported OT_MEMORY_PROFILE: ${OT_MEMORY_PROFILE}")
+    endif()
+    target_compile_definitions(ot-config INTERFACE
+        "PLATFORM_MEMORY_PROFILE_${OT_MEMORY_PROFILE}=1"
+    )
+endif()
+
 if(OT_CFLAGS MATCHES "-pedantic-errors")
     string(REPLACE "-pedantic-errors" "" OT_CFLAGS "${OT_CFLAGS}")
 endif()
@@ -88,6 +99,7 @@ target_link_libraries(openthread-nrf52811
         ${OT_MBEDTLS}
         ${NRF52811_3RD_LIBS}
         -T${LD_FILE}
+        ${NRF_LINK_OPTIONS}
         -Wl,--gc-sections
         -Wl,-Map=$<TARGET_PROPERTY:NAME>.map
     PRIVATE
@@ -98,6 +110,7 @@ target_link_libraries(openthread-nrf52811-transport
     PUBLIC
         ${OT_MBEDTLS}
         -T${LD_FILE}
+        ${NRF_LINK_OPTIONS}
         -Wl,--gc-sections
         -Wl,-Map=$<TARGET_PROPERTY:NAME>.map
     PRIVATE
@@ -110,6 +123,7 @@ target_link_libraries(openthread-nrf52811-sdk
         ${OT_MBEDTLS}
         ${NRF52811_3RD_LIBS}
         -T${LD_FILE}
+        ${NRF_LINK_OPTIONS}
         -Wl,--gc-sections
         -Wl,-Map=$<TARGET_PROPERTY:NAME>.map
     PRIVATE
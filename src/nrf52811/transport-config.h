@@ -135,10 +135,16 @@
  *
  * UART Receive buffer size.
  *
+ * The reduced memory profiles rely on hardware flow control to hold off the host while the buffer is full.
+ *
  */
 #ifndef UART_RX_BUFFER_SIZE
+#if PLATFORM_MEMORY_PROFILE_MTD || PLATFORM_MEMORY_PROFILE_RCP
+#define UART_RX_BUFFER_SIZE 128
+#else
 #define UART_RX_BUFFER_SIZE 256
 #endif
+#endif
 
 /**
  * @def UART_PIN_TX
@@ -257,4 +263,105 @@
 #define SPIS_PIN_HOST_IRQ 30
 #endif
 
+/*******************************************************************************
+ * @section Host wake configuration.
+ ******************************************************************************/
+
+/**
+ * @def HOST_WAKE_ENABLE
+ *
+ * Enable waking the host processor with a GPIO when otPlatWakeHost() is called. Transmissions to the host are held
+ * until the host is ready or @ref HOST_WAKE_READY_TIMEOUT_MS elapses.
+ *
+ */
+#ifndef HOST_WAKE_ENABLE
+#define HOST_WAKE_ENABLE 0
+#endif
+
+/**
+ * @def HOST_WAKE_PIN
+ *
+ * GPIO used to wake the host. It depends on the board, so it has no default and must be set together with
+ * @ref HOST_WAKE_ENABLE.
+ *
+ */
+#define HOST_WAKE_PIN_NONE 0xFFFFFFFF
+
+#ifndef HOST_WAKE_PIN
+#define HOST_WAKE_PIN HOST_WAKE_PIN_NONE
+#endif
+
+/**
+ * @def HOST_WAKE_ACTIVE_LEVEL
+ *
+ * Level of @ref HOST_WAKE_PIN that wakes the host.
+ *
+ */
+#ifndef HOST_WAKE_ACTIVE_LEVEL
+#define HOST_WAKE_ACTIVE_LEVEL 0
+#endif
+
+/**
+ * @def HOST_WAKE_ASSERT_TIME_MS
+ *
+ * Minimum time for which @ref HOST_WAKE_PIN is kept asserted.
+ *
+ */
+#ifndef HOST_WAKE_ASSERT_TIME_MS
+#define HOST_WAKE_ASSERT_TIME_MS 5
+#endif
+
+/**
+ * @def HOST_WAKE_DEASSERT_TIME_MS
+ *
+ * Minimum time for which @ref HOST_WAKE_PIN is kept deasserted before it is asserted again.
+ *
+ */
+#ifndef HOST_WAKE_DEASSERT_TIME_MS
+#define HOST_WAKE_DEASSERT_TIME_MS 5
+#endif
+
+/**
+ * @def HOST_WAKE_READY_PIN
+ *
+ * GPIO driven by the host when it is awake. Set to @ref HOST_WAKE_READY_PIN_NONE to detect that the host is ready
+ * from the data it sends.
+ *
+ */
+#define HOST_WAKE_READY_PIN_NONE 0xFFFFFFFF
+
+#ifndef HOST_WAKE_READY_PIN
+#define HOST_WAKE_READY_PIN HOST_WAKE_READY_PIN_NONE
+#endif
+
+/**
+ * @def HOST_WAKE_READY_ACTIVE_LEVEL
+ *
+ * Level of @ref HOST_WAKE_READY_PIN that indicates that the host is awake.
+ *
+ */
+#ifndef HOST_WAKE_READY_ACTIVE_LEVEL
+#define HOST_WAKE_READY_ACTIVE_LEVEL 0
+#endif
+
+/**
+ * @def HOST_WAKE_READY_TIMEOUT_MS
+ *
+ * Maximum time for which transmissions are held while waiting for the host to wake up.
+ *
+ */
+#ifndef HOST_WAKE_READY_TIMEOUT_MS
+#define HOST_WAKE_READY_TIMEOUT_MS 100
+#endif
+
+/**
+ * @def HOST_WAKE_IRQ_PRIORITY
+ *
+ * Priority of the GPIOTE interrupt used to detect @ref HOST_WAKE_READY_PIN.
+ *
+ */
+#ifndef HOST_WAKE_IRQ_PRIORITY
+#define HOST_WAKE_IRQ_PRIORITY 6
+#endif
+
 #endif // TRANSPORT_CONFIG_H_
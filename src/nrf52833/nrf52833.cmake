@@ -51,6 +51,11 @@ set(OT_PLATFORM_DEFINES ${OT_PLATFORM_DEFINES} PARENT_SCOPE)
 target_compile_definitions(ot-config INTERFACE
     "MBEDTLS_USER_CONFIG_FILE=\"nrf52833-mbedtls-config.h\""
 )
+if(OT_BOOTLOADER)
+    target_compile_definitions(ot-config INTERFACE
+        "OPENTHREAD_CONFIG_PLATFORM_BOOTLOADER_MODE_ENABLE=1"
+    )
+endif()
 set(OT_PUBLIC_INCLUDES ${OT_PUBLIC_INCLUDES} PARENT_SCOPE)
 
 set(COMM_FLAGS
@@ -102,6 +107,7 @@ target_link_libraries(openthread-nrf52833
         ${OT_MBEDTLS}
         ${NRF52833_3RD_LIBS}
         -T${LD_FILE}
+        ${NRF_LINK_OPTIONS}
         -Wl,--gc-sections
         -Wl,-Map=$<TARGET_PROPERTY:NAME>.map
     PRIVATE
@@ -112,6 +118,7 @@ target_link_libraries(openthread-nrf52833-transport
     PUBLIC
         ${OT_MBEDTLS}
         -T${LD_FILE}
+        ${NRF_LINK_OPTIONS}
         -Wl,--gc-sections
         -Wl,-Map=$<TARGET_PROPERTY:NAME>.map
     PRIVATE
@@ -124,6 +131,7 @@ target_link_libraries(openthread-nrf52833-sdk
         ${OT_MBEDTLS}
         ${NRF52833_3RD_LIBS}
         -T${LD_FILE}
+        ${NRF_LINK_OPTIONS}
         -Wl,--gc-sections
         -Wl,-Map=$<TARGET_PROPERTY:NAME>.map
     PRIVATE
@@ -135,6 +143,7 @@ target_link_libraries(openthread-nrf52833-softdevice-sdk
         ${OT_MBEDTLS}
         ${NRF52833_3RD_LIBS}
         -T${LD_FILE}
+        ${NRF_LINK_OPTIONS}
         -Wl,--gc-sections
         -Wl,-Map=$<TARGET_PROPERTY:NAME>.map
     PRIVATE
@@ -41,6 +41,11 @@ endif()
 list(APPEND OT_PLATFORM_DEFINES
     "OPENTHREAD_CORE_CONFIG_PLATFORM_CHECK_FILE=\"openthread-core-nrf52840-config-check.h\""
 )
+
+option(OT_QSPI_FLASH "store OT settings in QSPI external flash")
+if(OT_QSPI_FLASH)
+    list(APPEND OT_PLATFORM_DEFINES "PLATFORM_FLASH_QSPI_ENABLE=1")
+endif()
 if(NOT OT_EXTERNAL_MBEDTLS)
     if(OT_MBEDTLS_THREADING)
         list(APPEND OT_PLATFORM_DEFINES "MBEDTLS_THREADING_C")
@@ -62,6 +67,11 @@ set(OT_PLATFORM_DEFINES ${OT_PLATFORM_DEFINES} PARENT_SCOPE)
 target_compile_definitions(ot-config INTERFACE
     "MBEDTLS_USER_CONFIG_FILE=\"nrf52840-mbedtls-config.h\""
 )
+if(OT_BOOTLOADER)
+    target_compile_definitions(ot-config INTERFACE
+        "OPENTHREAD_CONFIG_PLATFORM_BOOTLOADER_MODE_ENABLE=1"
+    )
+endif()
 list(APPEND OT_PUBLIC_INCLUDES "${PROJECT_SOURCE_DIR}/third_party/NordicSemiconductor/libraries/nrf_security/mbedtls_plat_config")
 set(OT_PUBLIC_INCLUDES ${OT_PUBLIC_INCLUDES} PARENT_SCOPE)
 
@@ -113,6 +123,7 @@ target_link_libraries(openthread-nrf52840
         ${OT_MBEDTLS}
         ${NRF52840_3RD_LIBS}
         -T${LD_FILE}
+        ${NRF_LINK_OPTIONS}
         -Wl,--gc-sections
         -Wl,-Map=$<TARGET_PROPERTY:NAME>.map
     PRIVATE
@@ -123,6 +134,7 @@ target_link_libraries(openthread-nrf52840-transport
     PUBLIC
         ${OT_MBEDTLS}
         -T${LD_FILE}
+        ${NRF_LINK_OPTIONS}
         -Wl,--gc-sections
         -Wl,-Map=$<TARGET_PROPERTY:NAME>.map
     PRIVATE
@@ -135,6 +147,7 @@ target_link_libraries(openthread-nrf52840-sdk
         ${OT_MBEDTLS}
         ${NRF52840_3RD_LIBS}
         -T${LD_FILE}
+        ${NRF_LINK_OPTIONS}
         -Wl,--gc-sections
         -Wl,-Map=$<TARGET_PROPERTY:NAME>.map
     PRIVATE
@@ -146,6 +159,7 @@ target_link_libraries(openthread-nrf52840-softdevice-sdk
         ${OT_MBEDTLS}
         ${NRF52840_3RD_LIBS}
         -T${LD_FILE}
+        ${NRF_LINK_OPTIONS}
         -Wl,--gc-sections
         -Wl,-Map=$<TARGET_PROPERTY:NAME>.map
     PRIVATE
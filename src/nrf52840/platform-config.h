@@ -120,13 +120,228 @@
  *
  * Number of flash pages to use for OpenThread's non-volatile settings.
  *
- * @note This define applies only for MDK-ARM Keil toolchain configuration.
+ * @note Set with the OT_SETTINGS_FLASH_PAGES CMake option, which also sizes the settings area in the linker script.
+ *       The size of the area provided by the linker script is checked against this value at runtime.
  *
  */
 #ifndef PLATFORM_FLASH_PAGE_NUM
 #define PLATFORM_FLASH_PAGE_NUM 4
 #endif
 
+/**
+ * @def PLATFORM_FLASH_WEAR_LEVELING_ENABLE
+ *
+ * Enable erase counting and wear leveling of the settings area. Each page starts with a header holding its erase
+ * count, and every swap erase moves the swap to the least worn free pages of the area, so enlarging the area with
+ * PLATFORM_FLASH_PAGE_NUM spreads the wear.
+ *
+ * @note The layout of the settings area changes, enabling it on a device erases the stored settings.
+ *
+ */
+#ifndef PLATFORM_FLASH_WEAR_LEVELING_ENABLE
+#define PLATFORM_FLASH_WEAR_LEVELING_ENABLE 0
+#endif
+
+/**
+ * @def PLATFORM_FLASH_WEAR_SWAP_PAGES
+ *
+ * Number of pages of each of the two settings swaps when wear leveling is enabled.
+ *
+ */
+#ifndef PLATFORM_FLASH_WEAR_SWAP_PAGES
+#define PLATFORM_FLASH_WEAR_SWAP_PAGES 2
+#endif
+
+/**
+ * @def PLATFORM_FLASH_WEAR_MAX_PAGES
+ *
+ * Maximum number of pages of the settings area when wear leveling is enabled.
+ *
+ */
+#ifndef PLATFORM_FLASH_WEAR_MAX_PAGES
+#define PLATFORM_FLASH_WEAR_MAX_PAGES 32
+#endif
+
+/**
+ * @def PLATFORM_FLASH_ENDURANCE_CYCLES
+ *
+ * Guaranteed number of erase cycles of a flash page, used to project the lifetime of the settings area.
+ *
+ */
+#ifndef PLATFORM_FLASH_ENDURANCE_CYCLES
+#define PLATFORM_FLASH_ENDURANCE_CYCLES 10000
+#endif
+
+/**
+ * @def PLATFORM_FLASH_SCHEDULER_ENABLE
+ *
+ * Enable scheduling of flash operations around the scheduled radio windows, such as delayed receptions and
+ * transmissions and CSL sample windows. Page erases and writes are queued and executed from the main loop. Page erases
+ * are split into partial erases and writes into chunks, and each part waits for a gap in which it cannot delay a radio
+ * window. Reads of the settings include the data of queued operations, and the queue is completed before a reset.
+ *
+ * @note The SoftDevice schedules flash operations itself, so this applies only to builds without the SoftDevice.
+ *
+ */
+#ifndef PLATFORM_FLASH_SCHEDULER_ENABLE
+#define PLATFORM_FLASH_SCHEDULER_ENABLE 1
+#endif
+
+/**
+ * @def PLATFORM_FLASH_PARTIAL_ERASE_DURATION_MS
+ *
+ * Duration [ms] of each part of a page erase. The CPU is halted during each part.
+ *
+ */
+#ifndef PLATFORM_FLASH_PARTIAL_ERASE_DURATION_MS
+#define PLATFORM_FLASH_PARTIAL_ERASE_DURATION_MS 2
+#endif
+
+/**
+ * @def PLATFORM_FLASH_WRITE_CHUNK_SIZE
+ *
+ * Number of bytes written to flash in one go, a multiple of 4. Programming a word halts the CPU for up to 41 us.
+ *
+ */
+#ifndef PLATFORM_FLASH_WRITE_CHUNK_SIZE
+#define PLATFORM_FLASH_WRITE_CHUNK_SIZE 64
+#endif
+
+/**
+ * @def PLATFORM_FLASH_SCHEDULER_MAX_DELAY_US
+ *
+ * Maximum time [us] the parts of a settings erase or write wait in total for gaps between radio windows. The
+ * remaining parts are executed anyway once the time elapses, so that a busy radio cannot hold off the settings
+ * indefinitely. Queued data is lost if the device loses power or crashes within this time.
+ *
+ */
+#ifndef PLATFORM_FLASH_SCHEDULER_MAX_DELAY_US
+#define PLATFORM_FLASH_SCHEDULER_MAX_DELAY_US 200000
+#endif
+
+/**
+ * @def PLATFORM_FLASH_SCHEDULER_QUEUE_SIZE
+ *
+ * Number of bytes of queued flash writes. When the queue is full, the oldest operations are completed before the
+ * write returns, waiting for radio gaps in place.
+ *
+ */
+#ifndef PLATFORM_FLASH_SCHEDULER_QUEUE_SIZE
+#define PLATFORM_FLASH_SCHEDULER_QUEUE_SIZE 512
+#endif
+
+/**
+ * @def PLATFORM_FLASH_SCHEDULER_QUEUE_OPERATIONS
+ *
+ * Maximum number of queued flash erases and writes.
+ *
+ */
+#ifndef PLATFORM_FLASH_SCHEDULER_QUEUE_OPERATIONS
+#define PLATFORM_FLASH_SCHEDULER_QUEUE_OPERATIONS 16
+#endif
+
+/**
+ * @def PLATFORM_FLASH_QSPI_ENABLE
+ *
+ * Enable storing OpenThread's non-volatile settings in QSPI external flash instead of internal flash.
+ *
+ * @note Set with the OT_QSPI_FLASH CMake option, which also enables the nrfx QSPI driver.
+ *
+ */
+#ifndef PLATFORM_FLASH_QSPI_ENABLE
+#define PLATFORM_FLASH_QSPI_ENABLE 0
+#endif
+
+/**
+ * @def PLATFORM_FLASH_QSPI_PARTITION_OFFSET
+ *
+ * Offset of OpenThread's non-volatile settings partition in QSPI external flash. Must be a multiple of 4 KiB.
+ *
+ */
+#ifndef PLATFORM_FLASH_QSPI_PARTITION_OFFSET
+#define PLATFORM_FLASH_QSPI_PARTITION_OFFSET 0
+#endif
+
+/**
+ * @def PLATFORM_FLASH_QSPI_PARTITION_SIZE
+ *
+ * Size of OpenThread's non-volatile settings partition in QSPI external flash. Must be a multiple of 8 KiB.
+ *
+ */
+#ifndef PLATFORM_FLASH_QSPI_PARTITION_SIZE
+#define PLATFORM_FLASH_QSPI_PARTITION_SIZE 0x10000
+#endif
+
+/**
+ * @def PLATFORM_FLASH_QSPI_PIN_SCK
+ *
+ * QSPI SCK pin. The QSPI pin defaults match the nRF52840 DK.
+ *
+ */
+#ifndef PLATFORM_FLASH_QSPI_PIN_SCK
+#define PLATFORM_FLASH_QSPI_PIN_SCK 19
+#endif
+
+/**
+ * @def PLATFORM_FLASH_QSPI_PIN_CSN
+ *
+ * QSPI CSN pin.
+ *
+ */
+#ifndef PLATFORM_FLASH_QSPI_PIN_CSN
+#define PLATFORM_FLASH_QSPI_PIN_CSN 17
+#endif
+
+/**
+ * @def PLATFORM_FLASH_QSPI_PIN_IO0
+ *
+ * QSPI IO0 pin.
+ *
+ */
+#ifndef PLATFORM_FLASH_QSPI_PIN_IO0
+#define PLATFORM_FLASH_QSPI_PIN_IO0 20
+#endif
+
+/**
+ * @def PLATFORM_FLASH_QSPI_PIN_IO1
+ *
+ * QSPI IO1 pin.
+ *
+ */
+#ifndef PLATFORM_FLASH_QSPI_PIN_IO1
+#define PLATFORM_FLASH_QSPI_PIN_IO1 21
+#endif
+
+/**
+ * @def PLATFORM_FLASH_QSPI_PIN_IO2
+ *
+ * QSPI IO2 pin.
+ *
+ */
+#ifndef PLATFORM_FLASH_QSPI_PIN_IO2
+#define PLATFORM_FLASH_QSPI_PIN_IO2 22
+#endif
+
+/**
+ * @def PLATFORM_FLASH_QSPI_PIN_IO3
+ *
+ * QSPI IO3 pin.
+ *
+ */
+#ifndef PLATFORM_FLASH_QSPI_PIN_IO3
+#define PLATFORM_FLASH_QSPI_PIN_IO3 23
+#endif
+
+/**
+ * @def PLATFORM_FLASH_QSPI_IRQ_PRIORITY
+ *
+ * QSPI interrupt priority.
+ *
+ */
+#ifndef PLATFORM_FLASH_QSPI_IRQ_PRIORITY
+#define PLATFORM_FLASH_QSPI_IRQ_PRIORITY 6
+#endif
+
 /*******************************************************************************
  * @section Platform FEM Configuration
  ******************************************************************************/
@@ -148,7 +363,8 @@
 /**
  * @def NRF_802154_PENDING_SHORT_ADDRESSES
  *
- * Number of slots containing short addresses of nodes for which pending data is stored.
+ * Number of slots containing short addresses of nodes for which pending data is stored. Each slot takes 2 bytes
+ * for the pending bit and 11 bytes for the IE data, twice with NRF_802154_ACK_DATA_DOUBLE_BUFFER_ENABLED.
  *
  */
 #ifndef NRF_802154_PENDING_SHORT_ADDRESSES
@@ -158,13 +374,47 @@
 /**
  * @def NRF_802154_PENDING_EXTENDED_ADDRESSES
  *
- * Number of slots containing extended addresses of nodes for which pending data is stored.
+ * Number of slots containing extended addresses of nodes for which pending data is stored. Each slot takes 8 bytes
+ * for the pending bit and 17 bytes for the IE data, twice with NRF_802154_ACK_DATA_DOUBLE_BUFFER_ENABLED.
  *
  */
 #ifndef NRF_802154_PENDING_EXTENDED_ADDRESSES
 #define NRF_802154_PENDING_EXTENDED_ADDRESSES OPENTHREAD_CONFIG_MLE_MAX_CHILDREN
 #endif
 
+/**
+ * @def NRF_802154_ACK_DATA_PENDING_BIT_HOOK_ENABLED
+ *
+ * Let the platform decide the pending bit of ACK frames from the number of frames queued for the
+ * source of the acknowledged frame, see nrf5RadioPendingQueuesSet().
+ *
+ */
+#ifndef NRF_802154_ACK_DATA_PENDING_BIT_HOOK_ENABLED
+#define NRF_802154_ACK_DATA_PENDING_BIT_HOOK_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_PREEMPTION_POLICY_ENABLED
+ *
+ * Resolve conflicts between radio operations by the priorities of their classes instead of the termination levels
+ * of the requests, see nrf5RadioPreemptionPrioritySet().
+ *
+ */
+#ifndef NRF_802154_PREEMPTION_POLICY_ENABLED
+#define NRF_802154_PREEMPTION_POLICY_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_HFCLK_WARM_ENABLED
+ *
+ * Keep the HFXO running across short radio idle gaps and start it ahead of the next alarm of the stack, see
+ * nrf5RadioHfxoStatsGet().
+ *
+ */
+#ifndef NRF_802154_HFCLK_WARM_ENABLED
+#define NRF_802154_HFCLK_WARM_ENABLED 0
+#endif
+
 /**
  * @def NRF_802154_CSMA_CA_ENABLED
  *
@@ -186,6 +436,279 @@
 #define NRF_802154_ACK_TIMEOUT_ENABLED 1
 #endif
 
+/**
+ * @def RADIO_CONFIG_RX_FILTER_FRAME_TYPES
+ *
+ * Bitmask of 802.15.4 frame types accepted by the receiver. Bit n allows frames whose Frame Type field equals n.
+ * Frames of other types are aborted during the reception, before they occupy a receive buffer.
+ *
+ */
+#ifndef RADIO_CONFIG_RX_FILTER_FRAME_TYPES
+#define RADIO_CONFIG_RX_FILTER_FRAME_TYPES 0xff
+#endif
+
+/**
+ * @def RADIO_CONFIG_RX_FILTER_BEACON_REQUEST_INTERVAL
+ *
+ * Minimum interval in microseconds between Beacon Request commands accepted by the receiver. Beacon Requests received
+ * sooner are aborted during the reception. Value 0 disables the rate limit.
+ *
+ */
+#ifndef RADIO_CONFIG_RX_FILTER_BEACON_REQUEST_INTERVAL
+#define RADIO_CONFIG_RX_FILTER_BEACON_REQUEST_INTERVAL 0
+#endif
+
+/**
+ * @def RADIO_CONFIG_ANT_DIVERSITY_MODE
+ *
+ * Antenna diversity mode applied at init. Used only when NRF_802154_ANT_DIVERSITY_ENABLED is set, which requires
+ * NRF_802154_ANT_DIVERSITY_PIN to select the antenna through an RF switch. SoftDevice builds must also set the
+ * NRF_802154_PPI_ANT_DIVERSITY_* channels, as the defaults fall in the range reserved by the SoftDevice.
+ *
+ */
+#ifndef RADIO_CONFIG_ANT_DIVERSITY_MODE
+#define RADIO_CONFIG_ANT_DIVERSITY_MODE NRF_802154_ANT_DIVERSITY_MODE_AUTO
+#endif
+
+/**
+ * @def RADIO_CONFIG_TPC_ENABLE
+ *
+ * Enable per-neighbor transmit power control. Each unicast frame is transmitted at the lowest power that keeps
+ * RADIO_CONFIG_TPC_LINK_MARGIN above the receive sensitivity, estimated from RSSI of frames and ACKs received from
+ * its destination.
+ *
+ */
+#ifndef RADIO_CONFIG_TPC_ENABLE
+#define RADIO_CONFIG_TPC_ENABLE 0
+#endif
+
+/**
+ * @def RADIO_CONFIG_TPC_NEIGHBORS
+ *
+ * Number of neighbors for which the transmit power is tracked.
+ *
+ */
+#ifndef RADIO_CONFIG_TPC_NEIGHBORS
+#define RADIO_CONFIG_TPC_NEIGHBORS 16
+#endif
+
+/**
+ * @def RADIO_CONFIG_TPC_LINK_MARGIN
+ *
+ * Link margin [dB] above the receive sensitivity kept by the transmit power control.
+ *
+ */
+#ifndef RADIO_CONFIG_TPC_LINK_MARGIN
+#define RADIO_CONFIG_TPC_LINK_MARGIN 20
+#endif
+
+/**
+ * @def RADIO_CONFIG_TPC_HYSTERESIS
+ *
+ * Minimum decrease [dB] of the transmit power for a neighbor. Increases are applied immediately.
+ *
+ */
+#ifndef RADIO_CONFIG_TPC_HYSTERESIS
+#define RADIO_CONFIG_TPC_HYSTERESIS 4
+#endif
+
+/**
+ * @def RADIO_CONFIG_TPC_MIN_POWER
+ *
+ * Lowest transmit power [dBm] used by the transmit power control.
+ *
+ */
+#ifndef RADIO_CONFIG_TPC_MIN_POWER
+#define RADIO_CONFIG_TPC_MIN_POWER -20
+#endif
+
+/**
+ * @def RADIO_CONFIG_TPC_MIN_LQI
+ *
+ * Lowest average LQI of a neighbor for which the transmit power is reduced.
+ *
+ */
+#ifndef RADIO_CONFIG_TPC_MIN_LQI
+#define RADIO_CONFIG_TPC_MIN_LQI 200
+#endif
+
+/**
+ * @def NRF_802154_CCA_MODE_DEFAULT
+ *
+ * CCA mode used by the radio driver: energy detection, carrier, carrier and energy detection, or carrier or energy
+ * detection. Setting the CCA energy detection threshold keeps the configured mode.
+ *
+ */
+#ifndef NRF_802154_CCA_MODE_DEFAULT
+#define NRF_802154_CCA_MODE_DEFAULT NRF_RADIO_CCA_MODE_ED
+#endif
+
+/**
+ * @def RADIO_CONFIG_CCA_ADAPTIVE_ENABLE
+ *
+ * Enable the adaptive CCA energy detection threshold. The noise floor of each channel is tracked from idle RSSI
+ * samples and energy detection results, and the threshold is kept RADIO_CONFIG_CCA_ADAPTIVE_MARGIN above it.
+ *
+ */
+#ifndef RADIO_CONFIG_CCA_ADAPTIVE_ENABLE
+#define RADIO_CONFIG_CCA_ADAPTIVE_ENABLE 0
+#endif
+
+/**
+ * @def RADIO_CONFIG_CCA_ADAPTIVE_MARGIN
+ *
+ * Margin [dB] of the adaptive CCA energy detection threshold above the noise floor.
+ *
+ */
+#ifndef RADIO_CONFIG_CCA_ADAPTIVE_MARGIN
+#define RADIO_CONFIG_CCA_ADAPTIVE_MARGIN 10
+#endif
+
+/**
+ * @def RADIO_CONFIG_CCA_ADAPTIVE_MAX_THRESHOLD
+ *
+ * Highest adaptive CCA energy detection threshold [dBm], so that traffic above it is never ignored.
+ *
+ */
+#ifndef RADIO_CONFIG_CCA_ADAPTIVE_MAX_THRESHOLD
+#define RADIO_CONFIG_CCA_ADAPTIVE_MAX_THRESHOLD -60
+#endif
+
+/**
+ * @def RADIO_CONFIG_CCA_ADAPTIVE_SAMPLE_INTERVAL
+ *
+ * Interval [ms] between idle RSSI samples taken for the noise floor tracking.
+ *
+ */
+#ifndef RADIO_CONFIG_CCA_ADAPTIVE_SAMPLE_INTERVAL
+#define RADIO_CONFIG_CCA_ADAPTIVE_SAMPLE_INTERVAL 100
+#endif
+
+/**
+ * @def RADIO_CONFIG_LINK_ESTIMATOR_ENABLE
+ *
+ * Enable the per-neighbor link estimator. Moving averages of RSSI and LQI, the rate of frames lost to CRC errors, the
+ * ACK success rate and the last-heard time are kept for each neighbor, updated by the radio callbacks.
+ *
+ */
+#ifndef RADIO_CONFIG_LINK_ESTIMATOR_ENABLE
+#define RADIO_CONFIG_LINK_ESTIMATOR_ENABLE 0
+#endif
+
+/**
+ * @def RADIO_CONFIG_LINK_ESTIMATOR_NEIGHBORS
+ *
+ * Number of neighbors tracked by the link estimator.
+ *
+ */
+#ifndef RADIO_CONFIG_LINK_ESTIMATOR_NEIGHBORS
+#define RADIO_CONFIG_LINK_ESTIMATOR_NEIGHBORS 16
+#endif
+
+/**
+ * @def RADIO_CONFIG_LINK_ESTIMATOR_CRC_ERROR_WINDOW
+ *
+ * Time [ms] after a frame received with a CRC error within which a frame received from a neighbor is taken as its
+ * retransmission, so that the error is attributed to that neighbor.
+ *
+ */
+#ifndef RADIO_CONFIG_LINK_ESTIMATOR_CRC_ERROR_WINDOW
+#define RADIO_CONFIG_LINK_ESTIMATOR_CRC_ERROR_WINDOW 20
+#endif
+
+/**
+ * @def RADIO_CONFIG_LINK_ESTIMATOR_ENH_ACK
+ *
+ * Report the averaged RSSI and LQI of the link estimator instead of the values of the acknowledged frame in
+ * Enh-ACK based link metrics probing.
+ *
+ */
+#ifndef RADIO_CONFIG_LINK_ESTIMATOR_ENH_ACK
+#define RADIO_CONFIG_LINK_ESTIMATOR_ENH_ACK 1
+#endif
+
+/**
+ * @def RADIO_CONFIG_CHANNEL_MAP_ENABLE
+ *
+ * Enable the per-channel quality map. Energy detection samples taken while receiving and by energy scans, CCA
+ * results of the CSMA-CA procedure and CRC errors of received frames are averaged for each channel.
+ *
+ */
+#ifndef RADIO_CONFIG_CHANNEL_MAP_ENABLE
+#define RADIO_CONFIG_CHANNEL_MAP_ENABLE 0
+#endif
+
+/**
+ * @def RADIO_CONFIG_CHANNEL_MAP_SAMPLE_INTERVAL
+ *
+ * Interval [ms] between energy detection samples of the receive channel taken for the channel map.
+ *
+ */
+#ifndef RADIO_CONFIG_CHANNEL_MAP_SAMPLE_INTERVAL
+#define RADIO_CONFIG_CHANNEL_MAP_SAMPLE_INTERVAL 1000
+#endif
+
+/**
+ * @def RADIO_CONFIG_CHANNEL_MAP_BUSY_THRESHOLD
+ *
+ * Energy [dBm] above which an energy detection sample counts as the channel being occupied.
+ *
+ */
+#ifndef RADIO_CONFIG_CHANNEL_MAP_BUSY_THRESHOLD
+#define RADIO_CONFIG_CHANNEL_MAP_BUSY_THRESHOLD -75
+#endif
+
+/**
+ * @def RADIO_CONFIG_MAC_FRAME_COUNTER_WATERMARK
+ *
+ * MAC frame counter value whose use is reported by nrf5RadioFrameCounterWatermarkReached(), so that the key can be
+ * rotated before the frame counter is exhausted.
+ *
+ */
+#ifndef RADIO_CONFIG_MAC_FRAME_COUNTER_WATERMARK
+#define RADIO_CONFIG_MAC_FRAME_COUNTER_WATERMARK 0xf0000000
+#endif
+
+/**
+ * @def RADIO_CONFIG_HFXO_KEEP_WARM_MAX
+ *
+ * Longest radio idle gap [us] the HFXO is kept running across, when NRF_802154_HFCLK_WARM_ENABLED is set.
+ *
+ */
+#ifndef RADIO_CONFIG_HFXO_KEEP_WARM_MAX
+#define RADIO_CONFIG_HFXO_KEEP_WARM_MAX 2000
+#endif
+
+/**
+ * @def RADIO_CONFIG_HFXO_PRESTART_ALARM
+ *
+ * Start the HFXO ahead of the next alarm of the stack, when NRF_802154_HFCLK_WARM_ENABLED is set.
+ *
+ */
+#ifndef RADIO_CONFIG_HFXO_PRESTART_ALARM
+#define RADIO_CONFIG_HFXO_PRESTART_ALARM 1
+#endif
+
+/**
+ * @def RADIO_CONFIG_HFXO_PRESTART_HOLD
+ *
+ * Time [us] the HFXO pre-started ahead of an alarm is kept running after the alarm deadline.
+ *
+ */
+#ifndef RADIO_CONFIG_HFXO_PRESTART_HOLD
+#define RADIO_CONFIG_HFXO_PRESTART_HOLD 1000
+#endif
+
+/**
+ * @def RADIO_CONFIG_HFXO_CURRENT
+ *
+ * Current [uA] drawn by the running HFXO, used to estimate the charge spent on keeping it warm.
+ *
+ */
+#ifndef RADIO_CONFIG_HFXO_CURRENT
+#define RADIO_CONFIG_HFXO_CURRENT 250
+#endif
+
 /*******************************************************************************
  * @section Temperature sensor driver configuration.
  ******************************************************************************/
@@ -212,4 +735,338 @@
 #define NRF_802154_TX_STARTED_NOTIFY_ENABLED 1
 #endif
 
+/*******************************************************************************
+ * @section Watchdog configuration.
+ ******************************************************************************/
+
+/**
+ * @def WATCHDOG_ENABLE
+ *
+ * Enable the hardware watchdog fed from the main loop.
+ *
+ * @note Once started, the watchdog cannot be stopped until the next reset.
+ *
+ */
+#ifndef WATCHDOG_ENABLE
+#define WATCHDOG_ENABLE 0
+#endif
+
+/**
+ * @def WATCHDOG_TIMEOUT_MS
+ *
+ * Hardware watchdog reload period [ms].
+ *
+ */
+#ifndef WATCHDOG_TIMEOUT_MS
+#define WATCHDOG_TIMEOUT_MS 5000
+#endif
+
+/**
+ * @def WATCHDOG_BEHAVIOUR
+ *
+ * Watchdog behaviour while the CPU sleeps or is halted by a debugger.
+ *
+ * @brief Possible values:
+ *         \ref NRF_WDT_BEHAVIOUR_PAUSE_SLEEP_HALT - Paused while sleeping (suitable for sleepy devices).
+ *         \ref NRF_WDT_BEHAVIOUR_RUN_SLEEP        - Keeps running while sleeping (always-on devices).
+ *
+ */
+#ifndef WATCHDOG_BEHAVIOUR
+#define WATCHDOG_BEHAVIOUR NRF_WDT_BEHAVIOUR_PAUSE_SLEEP_HALT
+#endif
+
+/**
+ * @def WATCHDOG_RADIO_TIMEOUT_MS
+ *
+ * Maximum time [ms] the radio driver may take to report the result of a requested operation. For a delayed or CSL
+ * transmission, it is counted from the scheduled start of the transmission.
+ *
+ */
+#ifndef WATCHDOG_RADIO_TIMEOUT_MS
+#define WATCHDOG_RADIO_TIMEOUT_MS 2000
+#endif
+
+/**
+ * @def WATCHDOG_TRANSPORT_TIMEOUT_MS
+ *
+ * Maximum time [ms] the serial transport may take to complete a started transmission.
+ *
+ */
+#ifndef WATCHDOG_TRANSPORT_TIMEOUT_MS
+#define WATCHDOG_TRANSPORT_TIMEOUT_MS 3000
+#endif
+
+/**
+ * @def WATCHDOG_ALARM_TIMEOUT_MS
+ *
+ * Maximum delay [ms] of an alarm firing past its expiration time.
+ *
+ */
+#ifndef WATCHDOG_ALARM_TIMEOUT_MS
+#define WATCHDOG_ALARM_TIMEOUT_MS 1000
+#endif
+
+/*******************************************************************************
+ * @section Image staging configuration.
+ ******************************************************************************/
+
+/**
+ * @def IMAGE_STAGING_ENABLE
+ *
+ * Enable staging of a new firmware image in a secondary flash slot while the network stays up.
+ *
+ */
+#ifndef IMAGE_STAGING_ENABLE
+#define IMAGE_STAGING_ENABLE 0
+#endif
+
+/**
+ * @def IMAGE_STAGING_SLOT_ADDRESS
+ *
+ * Page-aligned address of the secondary slot in internal flash. The slot must not overlap the running image or the
+ * OpenThread settings area, otherwise image staging is disabled at runtime.
+ *
+ */
+#ifndef IMAGE_STAGING_SLOT_ADDRESS
+#define IMAGE_STAGING_SLOT_ADDRESS 0x80000
+#endif
+
+/**
+ * @def IMAGE_STAGING_SLOT_SIZE
+ *
+ * Size of the secondary slot, including the last page which holds the staging progress record.
+ *
+ */
+#ifndef IMAGE_STAGING_SLOT_SIZE
+#define IMAGE_STAGING_SLOT_SIZE 0x70000
+#endif
+
+/**
+ * @def IMAGE_STAGING_ERASE_AHEAD_PAGES
+ *
+ * Number of pages erased in background ahead of the image write offset.
+ *
+ */
+#ifndef IMAGE_STAGING_ERASE_AHEAD_PAGES
+#define IMAGE_STAGING_ERASE_AHEAD_PAGES 4
+#endif
+
+/**
+ * @def IMAGE_STAGING_PAGE_ERASE_TIME_US
+ *
+ * Time [us] for which a page erase halts the CPU. A page is erased only if the radio has no scheduled reception or
+ * transmission window within this time.
+ *
+ */
+#ifndef IMAGE_STAGING_PAGE_ERASE_TIME_US
+#define IMAGE_STAGING_PAGE_ERASE_TIME_US 90000
+#endif
+
+/*******************************************************************************
+ * @section mbedtls memory pool configuration.
+ ******************************************************************************/
+
+/**
+ * @def MBEDTLS_POOL_ENABLE
+ *
+ * Serve mbedtls allocations from a pool of fixed-size blocks instead of the OpenThread heap. When enabled,
+ * OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE can be reduced accordingly.
+ *
+ */
+#ifndef MBEDTLS_POOL_ENABLE
+#define MBEDTLS_POOL_ENABLE 0
+#endif
+
+/**
+ * @def MBEDTLS_POOL_BINS
+ *
+ * Size classes of the mbedtls memory pool, as a list of _(block size, block count) entries sorted by block size.
+ * Block sizes must be multiples of 8 bytes.
+ *
+ */
+#ifndef MBEDTLS_POOL_BINS
+#define MBEDTLS_POOL_BINS(_) \
+    _(16, 32) \
+    _(32, 64) \
+    _(64, 48) \
+    _(128, 16) \
+    _(256, 8) \
+    _(640, 4) \
+    _(1664, 2)
+#endif
+
+/**
+ * @def MBEDTLS_POOL_HEAP_FALLBACK
+ *
+ * Allocate from the OpenThread heap if a request is larger than the largest block or all suitable blocks are in use.
+ *
+ */
+#ifndef MBEDTLS_POOL_HEAP_FALLBACK
+#define MBEDTLS_POOL_HEAP_FALLBACK 1
+#endif
+
+/*******************************************************************************
+ * @section Power management configuration.
+ ******************************************************************************/
+
+/**
+ * @def DCDC_ENABLE
+ *
+ * Enable the DC/DC converter of the main regulator. Requires the DC/DC inductor to be populated.
+ *
+ */
+#ifndef DCDC_ENABLE
+#define DCDC_ENABLE 0
+#endif
+
+/**
+ * @def DCDC_HV_ENABLE
+ *
+ * Enable the DC/DC converter of the high voltage regulator (REG0). Requires the DC/DC inductor to be populated.
+ *
+ */
+#ifndef DCDC_HV_ENABLE
+#define DCDC_HV_ENABLE 0
+#endif
+
+/**
+ * @def PLATFORM_POWER_ICACHE_ENABLE
+ *
+ * Enable the instruction cache of the flash controller.
+ *
+ */
+#ifndef PLATFORM_POWER_ICACHE_ENABLE
+#define PLATFORM_POWER_ICACHE_ENABLE (!SOFTDEVICE_PRESENT)
+#endif
+
+/**
+ * @def PLATFORM_POWER_CONSTLAT_THRESHOLD_US
+ *
+ * Idle periods [us] shorter than this are spent in constant latency mode, which keeps the wake-up latency minimal.
+ *
+ */
+#ifndef PLATFORM_POWER_CONSTLAT_THRESHOLD_US
+#define PLATFORM_POWER_CONSTLAT_THRESHOLD_US 200
+#endif
+
+/**
+ * @def PLATFORM_POWER_RAM_UNUSED_OFF
+ *
+ * Power off, and drop from System OFF retention, the RAM sections which lie entirely between the heap limit and the
+ * stack limit of the linker script. The heap is then bounded by the `.heap` section of the linker script.
+ *
+ */
+#ifndef PLATFORM_POWER_RAM_UNUSED_OFF
+#define PLATFORM_POWER_RAM_UNUSED_OFF 0
+#endif
+
+/*******************************************************************************
+ * @section Bootloader configuration.
+ ******************************************************************************/
+
+/**
+ * @def PLATFORM_BOOTLOADER_GPREGRET_VALUE
+ *
+ * Value left in the GPREGRET register to request the DFU mode from the bootloader after a reset. The default matches
+ * the nRF5 SDK bootloader.
+ *
+ */
+#ifndef PLATFORM_BOOTLOADER_GPREGRET_VALUE
+#define PLATFORM_BOOTLOADER_GPREGRET_VALUE 0xB1
+#endif
+
+/*******************************************************************************
+ * @section Crash dump configuration.
+ ******************************************************************************/
+
+/**
+ * @def PLATFORM_CRASH_DUMP_ENABLE
+ *
+ * Enable saving a crash dump in retained RAM on a HardFault, a failed assertion, an SDK error or a pure virtual call.
+ * The dump survives the reset that follows and can be read with `diag crashdump` or, with the OT_PLATFORM_VENDOR_HOOK
+ * build option, the NCP vendor hook.
+ *
+ */
+#ifndef PLATFORM_CRASH_DUMP_ENABLE
+#define PLATFORM_CRASH_DUMP_ENABLE 1
+#endif
+
+/**
+ * @def PLATFORM_CRASH_DUMP_STACK_WORDS
+ *
+ * Number of words saved from the top of the stack at the time of the crash.
+ *
+ */
+#ifndef PLATFORM_CRASH_DUMP_STACK_WORDS
+#define PLATFORM_CRASH_DUMP_STACK_WORDS 32
+#endif
+
+/**
+ * @def PLATFORM_CRASH_DUMP_RADIO_LOG_ENTRIES
+ *
+ * Number of most recent radio driver log entries saved. The radio driver keeps the log only if it is built with
+ * `ENABLE_DEBUG_LOG` set, which must then be set for the platform as well.
+ *
+ */
+#ifndef PLATFORM_CRASH_DUMP_RADIO_LOG_ENTRIES
+#define PLATFORM_CRASH_DUMP_RADIO_LOG_ENTRIES 16
+#endif
+
+/*******************************************************************************
+ * @section Trace configuration.
+ ******************************************************************************/
+
+/**
+ * @def PLATFORM_TRACE_ENABLE
+ *
+ * Enable the binary trace of radio driver and platform events. Each entry holds the RTC timestamp, the event and a
+ * parameter. The trace can be read with `diag trace`, over RTT or, with the OT_PLATFORM_VENDOR_HOOK build option, the
+ * NCP vendor hook, and decoded with `script/trace-decode`.
+ *
+ */
+#ifndef PLATFORM_TRACE_ENABLE
+#define PLATFORM_TRACE_ENABLE 1
+#endif
+
+/**
+ * @def PLATFORM_TRACE_BUFFER_SIZE
+ *
+ * Number of entries in the trace ring buffer. Must be a power of two. The oldest entries are overwritten when the
+ * trace is not drained in time.
+ *
+ */
+#ifndef PLATFORM_TRACE_BUFFER_SIZE
+#define PLATFORM_TRACE_BUFFER_SIZE 256
+#endif
+
+/**
+ * @def PLATFORM_TRACE_RTT_ENABLE
+ *
+ * Enable draining the trace to an RTT up channel from the main loop.
+ *
+ */
+#ifndef PLATFORM_TRACE_RTT_ENABLE
+#define PLATFORM_TRACE_RTT_ENABLE 0
+#endif
+
+/**
+ * @def PLATFORM_TRACE_RTT_CHANNEL
+ *
+ * RTT up channel the trace is drained to. Channels 0 and 1 are used by the RTT log and the RTT UART.
+ *
+ */
+#ifndef PLATFORM_TRACE_RTT_CHANNEL
+#define PLATFORM_TRACE_RTT_CHANNEL 2
+#endif
+
+/**
+ * @def PLATFORM_TRACE_RTT_BUFFER_SIZE
+ *
+ * Size of the RTT up channel buffer the trace is drained to, in bytes.
+ *
+ */
+#ifndef PLATFORM_TRACE_RTT_BUFFER_SIZE
+#define PLATFORM_TRACE_RTT_BUFFER_SIZE 1024
+#endif
+
 #endif // PLATFORM_CONFIG_H_
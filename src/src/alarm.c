@@ -324,6 +324,9 @@ static void HandleCompareMatch(AlarmIndex aIndex, bool aSkipCheck)
             break;
 
         case kMsTimer:
+            nrf5WatchdogCheckDisarm(kWatchdogCheckAlarm);
+            // Fall through.
+
         case kUsTimer:
             sTimerData[aIndex].mFireAlarm = true;
             sEventPending                 = true;
@@ -386,6 +389,14 @@ static void AlarmStartAt(uint32_t aT0, uint32_t aDt, AlarmIndex aIndex)
     GetOffsetAndCounter(&offset, &rtc_value);
     now = GetTime(offset, rtc_value, aIndex);
 
+    if (aIndex == kMsTimer)
+    {
+        // Supervise that the alarm fires no later than the configured margin past its expiration time.
+        int32_t remaining = (int32_t)(aT0 + aDt - (uint32_t)now);
+
+        nrf5WatchdogCheckArm(kWatchdogCheckAlarm, (remaining > 0 ? (uint32_t)remaining : 0) + WATCHDOG_ALARM_TIMEOUT_MS);
+    }
+
     TimerStartAt(aT0, aDt, aIndex, &now);
 
     if (rtc_value != GetRtcCounter())
@@ -426,8 +437,27 @@ static void AlarmStop(AlarmIndex aIndex)
     nrf_rtc_event_clear(RTC_INSTANCE, sChannelData[aIndex].mCompareEvent);
 
     sTimerData[aIndex].mFireAlarm = false;
+
+    if (aIndex == kMsTimer)
+    {
+        nrf5WatchdogCheckDisarm(kWatchdogCheckAlarm);
+    }
+}
+
+static void HandleLfclkEvent(nrf_drv_clock_evt_type_t aEvent)
+{
+    if (aEvent == NRF_DRV_CLOCK_EVT_LFCLK_STARTED)
+    {
+        nrf_rtc_task_trigger(RTC_INSTANCE, NRF_RTC_TASK_START);
+        nrf5BootMilestoneReached(kBootMilestoneLfclk);
+    }
 }
 
+static nrf_drv_clock_handler_item_t sLfclkHandlerItem = {
+    .p_next        = NULL,
+    .event_handler = HandleLfclkEvent,
+};
+
 void nrf5AlarmInit(void)
 {
     memset(sTimerData, 0, sizeof(sTimerData));
@@ -435,13 +465,6 @@ void nrf5AlarmInit(void)
     sMutex           = 0;
     sTimeOffset      = 0;
 
-    // Setup low frequency clock.
-    nrf_drv_clock_lfclk_request(NULL);
-
-    while (!nrf_drv_clock_lfclk_is_running())
-    {
-    }
-
     // Setup RTC timer.
     NVIC_SetPriority(RTC_IRQN, RTC_IRQ_PRIORITY);
     NVIC_ClearPendingIRQ(RTC_IRQN);
@@ -460,7 +483,8 @@ void nrf5AlarmInit(void)
         nrf_rtc_int_disable(RTC_INSTANCE, sChannelData[i].mCompareInt);
     }
 
-    nrf_rtc_task_trigger(RTC_INSTANCE, NRF_RTC_TASK_START);
+    // Setup low frequency clock. The RTC is started as soon as the clock is running, without blocking the boot.
+    nrf_drv_clock_lfclk_request(&sLfclkHandlerItem);
 }
 
 void nrf5AlarmDeinit(void)
@@ -497,6 +521,8 @@ void nrf5AlarmProcess(otInstance *aInstance)
         {
             sTimerData[kUsTimer].mFireAlarm = false;
 
+            nrf5TraceRecord(kTraceEventAlarmMicroFired, 0);
+
             otPlatAlarmMicroFired(aInstance);
         }
 
@@ -504,6 +530,8 @@ void nrf5AlarmProcess(otInstance *aInstance)
         {
             sTimerData[kMsTimer].mFireAlarm = false;
 
+            nrf5TraceRecord(kTraceEventAlarmMilliFired, 0);
+
 #if OPENTHREAD_CONFIG_DIAG_ENABLE
 
             if (otPlatDiagModeGet())
@@ -535,6 +563,58 @@ uint64_t nrf5AlarmGetRawCounter(void)
     return (((uint64_t)offset) << RTC_COUNTER_BITS) | counter;
 }
 
+static uint64_t GetNextDeadline(const AlarmIndex *aTimers, uint32_t aNumTimers)
+{
+    uint64_t now      = GetCurrentTime(kUsTimer);
+    uint64_t deadline = UINT64_MAX;
+
+    for (uint32_t i = 0; i < aNumTimers; i++)
+    {
+        AlarmIndex index = aTimers[i];
+        uint64_t   target;
+
+        if (sTimerData[index].mFireAlarm)
+        {
+            deadline = 0;
+            break;
+        }
+
+        if (!nrf_rtc_int_is_enabled(RTC_INSTANCE, sChannelData[index].mCompareInt))
+        {
+            continue;
+        }
+
+        target = (index == kMsTimer) ? sTimerData[index].mTargetTime * US_PER_MS : sTimerData[index].mTargetTime;
+
+        if (target <= now)
+        {
+            deadline = 0;
+            break;
+        }
+
+        if (target - now < deadline)
+        {
+            deadline = target - now;
+        }
+    }
+
+    return deadline;
+}
+
+uint64_t nrf5AlarmGetNextDeadline(void)
+{
+    static const AlarmIndex kDeadlineTimers[] = {kMsTimer, kUsTimer, k802154Timer};
+
+    return GetNextDeadline(kDeadlineTimers, sizeof(kDeadlineTimers) / sizeof(kDeadlineTimers[0]));
+}
+
+uint64_t nrf5AlarmGetNextStackDeadline(void)
+{
+    static const AlarmIndex kDeadlineTimers[] = {kMsTimer, kUsTimer};
+
+    return GetNextDeadline(kDeadlineTimers, sizeof(kDeadlineTimers) / sizeof(kDeadlineTimers[0]));
+}
+
 uint32_t otPlatAlarmMilliGetNow(void)
 {
     return (uint32_t)(nrf5AlarmGetCurrentTime() / US_PER_MS);
@@ -0,0 +1,299 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file implements the per-channel quality map built in the background from radio activity.
+ *
+ */
+
+#include <openthread-core-config.h>
+#include <openthread/config.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <openthread/platform/alarm-milli.h>
+#include <openthread/platform/radio.h>
+
+#include "platform-nrf5.h"
+
+#include <app_util_platform.h>
+#include <utils/code_utils.h>
+
+#if RADIO_CONFIG_CHANNEL_MAP_ENABLE
+
+enum
+{
+    kChannelMapRateShift   = 6,         // Weight of a new observation in the rates is 1/64.
+    kChannelMapEnergyShift = 4,         // Weight of a new sample in the average energy is 1/16.
+    kChannelMapFracBits    = 4,         // Number of fractional bits of the average energy.
+    kChannelMapRateFull    = 0xffff,    // Rate representing 100%.
+    kChannelMapEnergyNone  = INT16_MIN, // Average energy of a channel that was not sampled yet.
+};
+
+typedef struct
+{
+    uint16_t mOccupancy;    // Average rate of energy samples and CCAs finding the channel occupied.
+    uint16_t mCrcErrorRate; // Average rate of frames received with a CRC error.
+    int16_t  mEnergy;       // Average energy with kChannelMapFracBits fractional bits.
+    uint32_t mEdSamples;    // Number of energy samples.
+    uint32_t mCcaBusy;      // Number of CCAs that found the channel busy.
+    uint32_t mCcaIdle;      // Number of CCAs that found the channel idle.
+    uint32_t mRxFrames;     // Number of frames received.
+    uint32_t mRxCrcErrors;  // Number of frames received with a CRC error.
+    uint32_t mLastUpdate;   // Time [ms] of the last observation.
+} ChannelMapEntry;
+
+static ChannelMapEntry sChannels[OT_RADIO_2P4GHZ_OQPSK_CHANNEL_MAX - OT_RADIO_2P4GHZ_OQPSK_CHANNEL_MIN + 1];
+
+static ChannelMapEntry *entryGet(uint8_t aChannel)
+{
+    ChannelMapEntry *entry = NULL;
+
+    if (aChannel >= OT_RADIO_2P4GHZ_OQPSK_CHANNEL_MIN && aChannel <= OT_RADIO_2P4GHZ_OQPSK_CHANNEL_MAX)
+    {
+        entry = &sChannels[aChannel - OT_RADIO_2P4GHZ_OQPSK_CHANNEL_MIN];
+    }
+
+    return entry;
+}
+
+static uint16_t rateUpdate(uint16_t aRate, bool aSample)
+{
+    int32_t sample = aSample ? kChannelMapRateFull : 0;
+
+    return (uint16_t)(aRate + (sample - aRate) / (1 << kChannelMapRateShift));
+}
+
+static bool entryObserved(const ChannelMapEntry *aEntry)
+{
+    return aEntry->mEdSamples > 0 || aEntry->mCcaBusy > 0 || aEntry->mCcaIdle > 0 || aEntry->mRxFrames > 0;
+}
+
+void nrf5ChannelMapReset(void)
+{
+    CRITICAL_REGION_ENTER();
+
+    memset(sChannels, 0, sizeof(sChannels));
+
+    for (size_t i = 0; i < sizeof(sChannels) / sizeof(sChannels[0]); i++)
+    {
+        sChannels[i].mEnergy = kChannelMapEnergyNone;
+    }
+
+    CRITICAL_REGION_EXIT();
+}
+
+void nrf5ChannelMapEdSample(uint8_t aChannel, int8_t aEnergy)
+{
+    ChannelMapEntry *entry  = entryGet(aChannel);
+    int16_t          sample = (int16_t)(aEnergy * (1 << kChannelMapFracBits));
+    uint32_t         now    = otPlatAlarmMilliGetNow();
+
+    otEXPECT(entry != NULL);
+
+    CRITICAL_REGION_ENTER();
+
+    if (entry->mEnergy == kChannelMapEnergyNone)
+    {
+        entry->mEnergy = sample;
+    }
+    else
+    {
+        entry->mEnergy += (sample - entry->mEnergy) / (1 << kChannelMapEnergyShift);
+    }
+
+    entry->mOccupancy = rateUpdate(entry->mOccupancy, aEnergy > RADIO_CONFIG_CHANNEL_MAP_BUSY_THRESHOLD);
+    entry->mEdSamples++;
+    entry->mLastUpdate = now;
+
+    CRITICAL_REGION_EXIT();
+
+exit:
+    return;
+}
+
+void nrf5ChannelMapCcaResult(uint8_t aChannel, bool aBusy)
+{
+    ChannelMapEntry *entry = entryGet(aChannel);
+    uint32_t         now   = otPlatAlarmMilliGetNow();
+
+    otEXPECT(entry != NULL);
+
+    CRITICAL_REGION_ENTER();
+
+    entry->mOccupancy = rateUpdate(entry->mOccupancy, aBusy);
+
+    if (aBusy)
+    {
+        entry->mCcaBusy++;
+    }
+    else
+    {
+        entry->mCcaIdle++;
+    }
+
+    entry->mLastUpdate = now;
+
+    CRITICAL_REGION_EXIT();
+
+exit:
+    return;
+}
+
+void nrf5ChannelMapRxResult(uint8_t aChannel, bool aCrcError)
+{
+    ChannelMapEntry *entry = entryGet(aChannel);
+    uint32_t         now   = otPlatAlarmMilliGetNow();
+
+    otEXPECT(entry != NULL);
+
+    CRITICAL_REGION_ENTER();
+
+    entry->mCrcErrorRate = rateUpdate(entry->mCrcErrorRate, aCrcError);
+    entry->mRxFrames++;
+
+    if (aCrcError)
+    {
+        entry->mRxCrcErrors++;
+    }
+
+    entry->mLastUpdate = now;
+
+    CRITICAL_REGION_EXIT();
+
+exit:
+    return;
+}
+
+otError nrf5ChannelMapGet(uint8_t aChannel, PlatformChannelQuality *aQuality)
+{
+    otError                error = OT_ERROR_NONE;
+    const ChannelMapEntry *entry = entryGet(aChannel);
+
+    otEXPECT_ACTION(entry != NULL, error = OT_ERROR_INVALID_ARGS);
+
+    CRITICAL_REGION_ENTER();
+
+    aQuality->mOccupancy    = entry->mOccupancy;
+    aQuality->mCrcErrorRate = entry->mCrcErrorRate;
+    aQuality->mEnergy       = OT_RADIO_RSSI_INVALID;
+    aQuality->mEdSamples    = entry->mEdSamples;
+    aQuality->mCcaBusy      = entry->mCcaBusy;
+    aQuality->mCcaIdle      = entry->mCcaIdle;
+    aQuality->mRxFrames     = entry->mRxFrames;
+    aQuality->mRxCrcErrors  = entry->mRxCrcErrors;
+    aQuality->mLastUpdate   = entry->mLastUpdate;
+
+    if (entry->mEnergy != kChannelMapEnergyNone)
+    {
+        aQuality->mEnergy = (int8_t)(entry->mEnergy >> kChannelMapFracBits);
+    }
+
+    CRITICAL_REGION_EXIT();
+
+exit:
+    return error;
+}
+
+otError nrf5ChannelMapBestChannelGet(uint32_t aChannelMask, uint8_t *aChannel)
+{
+    otError  error     = OT_ERROR_NOT_FOUND;
+    uint32_t bestScore = UINT32_MAX;
+
+    CRITICAL_REGION_ENTER();
+
+    for (uint8_t channel = OT_RADIO_2P4GHZ_OQPSK_CHANNEL_MIN; channel <= OT_RADIO_2P4GHZ_OQPSK_CHANNEL_MAX; channel++)
+    {
+        const ChannelMapEntry *entry = entryGet(channel);
+        uint32_t               score;
+
+        if ((aChannelMask & (1UL << channel)) == 0 || !entryObserved(entry))
+        {
+            continue;
+        }
+
+        score = (uint32_t)entry->mOccupancy + entry->mCrcErrorRate;
+
+        if (score < bestScore)
+        {
+            bestScore = score;
+            *aChannel = channel;
+            error     = OT_ERROR_NONE;
+        }
+    }
+
+    CRITICAL_REGION_EXIT();
+
+    return error;
+}
+
+#else // RADIO_CONFIG_CHANNEL_MAP_ENABLE
+
+void nrf5ChannelMapReset(void)
+{
+}
+
+void nrf5ChannelMapEdSample(uint8_t aChannel, int8_t aEnergy)
+{
+    OT_UNUSED_VARIABLE(aChannel);
+    OT_UNUSED_VARIABLE(aEnergy);
+}
+
+void nrf5ChannelMapCcaResult(uint8_t aChannel, bool aBusy)
+{
+    OT_UNUSED_VARIABLE(aChannel);
+    OT_UNUSED_VARIABLE(aBusy);
+}
+
+void nrf5ChannelMapRxResult(uint8_t aChannel, bool aCrcError)
+{
+    OT_UNUSED_VARIABLE(aChannel);
+    OT_UNUSED_VARIABLE(aCrcError);
+}
+
+otError nrf5ChannelMapGet(uint8_t aChannel, PlatformChannelQuality *aQuality)
+{
+    OT_UNUSED_VARIABLE(aChannel);
+    OT_UNUSED_VARIABLE(aQuality);
+
+    return OT_ERROR_NOT_CAPABLE;
+}
+
+otError nrf5ChannelMapBestChannelGet(uint32_t aChannelMask, uint8_t *aChannel)
+{
+    OT_UNUSED_VARIABLE(aChannelMask);
+    OT_UNUSED_VARIABLE(aChannel);
+
+    return OT_ERROR_NOT_CAPABLE;
+}
+
+#endif // RADIO_CONFIG_CHANNEL_MAP_ENABLE
@@ -0,0 +1,360 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the crash dump retained in RAM across the reset following a crash.
+ *
+ */
+
+#include <openthread-core-config.h>
+#include <openthread/config.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <openthread/platform/alarm-milli.h>
+#include <openthread/platform/misc.h>
+
+#include "platform-nrf5.h"
+
+#include <nrf.h>
+#include <nrf_802154.h>
+#include <nrf_802154_debug_core.h>
+#include <utils/code_utils.h>
+
+#if PLATFORM_CRASH_DUMP_ENABLE
+
+// clang-format off
+#define CRASH_RECORD_MAGIC      0x48535243UL  ///< Marks a valid retained crash record ("CRSH").
+#define CRASH_CHECKSUM_SEED     0x811c9dc5UL  ///< FNV-1a offset basis.
+#define CRASH_CHECKSUM_PRIME    0x01000193UL  ///< FNV-1a prime.
+#define CRASH_REGISTER_PC       6             ///< Index of PC in the saved registers.
+// clang-format on
+
+typedef struct
+{
+    uint32_t          mMagic;    ///< Equals @ref CRASH_RECORD_MAGIC if the record is valid.
+    uint32_t          mReported; ///< The dump was already reported after a reset.
+    PlatformCrashDump mDump;     ///< The crash dump.
+    uint32_t          mChecksum; ///< Checksum of @p mDump.
+} CrashRetainedRecord;
+
+extern uint32_t __StackTop;
+extern uint32_t __StackLimit;
+
+static PlatformCrashReason sLastReason;
+static volatile bool       sSaving;
+
+/**
+ * Crash record retained across the reset. The .noinit section is not cleared by the startup code.
+ */
+static CrashRetainedRecord sRetainedRecord __attribute__((section(".noinit")));
+
+static uint32_t checksum(const PlatformCrashDump *aDump)
+{
+    const uint8_t *data = (const uint8_t *)aDump;
+    uint32_t       hash = CRASH_CHECKSUM_SEED;
+
+    for (uint32_t i = 0; i < sizeof(*aDump); i++)
+    {
+        hash = (hash ^ data[i]) * CRASH_CHECKSUM_PRIME;
+    }
+
+    return hash;
+}
+
+static bool isRecordValid(void)
+{
+    return (sRetainedRecord.mMagic == CRASH_RECORD_MAGIC) &&
+           (sRetainedRecord.mChecksum == checksum(&sRetainedRecord.mDump)) &&
+           (sRetainedRecord.mDump.mReason != kCrashReasonNone) &&
+           (sRetainedRecord.mDump.mReason <= kCrashReasonPureVirtual);
+}
+
+static void saveStack(PlatformCrashDump *aDump, uint32_t aSp)
+{
+    const uint32_t *top   = &__StackTop;
+    const uint32_t *limit = &__StackLimit;
+    const uint32_t *sp    = (const uint32_t *)aSp;
+
+    aDump->mSp        = aSp;
+    aDump->mStackSize = 0;
+
+    // Copy only from a stack pointer within the stack, a corrupted one may point anywhere.
+    otEXPECT((sp >= limit) && (sp < top) && ((aSp & 0x3) == 0));
+
+    while ((sp < top) && (aDump->mStackSize < PLATFORM_CRASH_DUMP_STACK_WORDS))
+    {
+        aDump->mStack[aDump->mStackSize++] = *sp++;
+    }
+
+exit:
+    return;
+}
+
+static void saveRadioLog(PlatformCrashDump *aDump)
+{
+    aDump->mRadioState   = (uint32_t)nrf_802154_state_get();
+    aDump->mRadioLogSize = 0;
+
+#if ENABLE_DEBUG_LOG
+    uint32_t ptr   = nrf_802154_debug_log_ptr;
+    uint32_t count = PLATFORM_CRASH_DUMP_RADIO_LOG_ENTRIES;
+
+    if (count > NRF_802154_DEBUG_LOG_BUFFER_LEN)
+    {
+        count = NRF_802154_DEBUG_LOG_BUFFER_LEN;
+    }
+
+    // The log is a ring, the entry at the write pointer is the oldest one.
+    ptr = (ptr + NRF_802154_DEBUG_LOG_BUFFER_LEN - count) % NRF_802154_DEBUG_LOG_BUFFER_LEN;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        aDump->mRadioLog[aDump->mRadioLogSize++] = nrf_802154_debug_log_buffer[ptr];
+        ptr                                      = (ptr + 1) % NRF_802154_DEBUG_LOG_BUFFER_LEN;
+    }
+#endif
+}
+
+static void commitAndReset(void)
+{
+    sRetainedRecord.mReported = 0;
+    sRetainedRecord.mChecksum = checksum(&sRetainedRecord.mDump);
+    __DSB();
+    sRetainedRecord.mMagic = CRASH_RECORD_MAGIC;
+    __DSB();
+
+    if (CoreDebug->DHCSR & CoreDebug_DHCSR_C_DEBUGEN_Msk)
+    {
+        // Stop at the crash site when a debugger is attached.
+        __BKPT(0);
+    }
+
+    NVIC_SystemReset();
+}
+
+static void beginRecord(PlatformCrashReason aReason)
+{
+    __disable_irq();
+
+    if (sSaving)
+    {
+        // A fault while saving the dump, give up on it.
+        NVIC_SystemReset();
+    }
+
+    sSaving = true;
+
+    sRetainedRecord.mMagic = 0;
+    memset(&sRetainedRecord.mDump, 0, sizeof(sRetainedRecord.mDump));
+
+    sRetainedRecord.mDump.mReason = (uint32_t)aReason;
+    sRetainedRecord.mDump.mUptime = otPlatAlarmMilliGetNow();
+}
+
+static void saveSoftwareCrash(PlatformCrashReason aReason,
+                              uint32_t            aInfo0,
+                              uint32_t            aInfo1,
+                              const char         *aFile,
+                              uint32_t            aPc)
+{
+    PlatformCrashDump *dump = &sRetainedRecord.mDump;
+
+    beginRecord(aReason);
+
+    dump->mInfo[0]                      = aInfo0;
+    dump->mInfo[1]                      = aInfo1;
+    dump->mRegisters[CRASH_REGISTER_PC] = aPc;
+
+    if (aFile != NULL)
+    {
+        size_t length = strlen(aFile);
+
+        // Keep the tail of the name, it identifies the file better than the head of the path.
+        if (length >= sizeof(dump->mFile))
+        {
+            aFile += length - (sizeof(dump->mFile) - 1);
+        }
+
+        strncpy(dump->mFile, aFile, sizeof(dump->mFile) - 1);
+    }
+
+    saveStack(dump, __get_MSP());
+    saveRadioLog(dump);
+    commitAndReset();
+
+    while (1)
+        ;
+}
+
+void nrf5CrashHardFault(const uint32_t *aFrame, uint32_t aExcReturn);
+
+void nrf5CrashHardFault(const uint32_t *aFrame, uint32_t aExcReturn)
+{
+    PlatformCrashDump *dump = &sRetainedRecord.mDump;
+    uint32_t           sp   = (uint32_t)aFrame;
+
+    beginRecord(kCrashReasonHardFault);
+
+    dump->mExcReturn = aExcReturn;
+    dump->mCfsr      = SCB->CFSR;
+    dump->mHfsr      = SCB->HFSR;
+    dump->mMmfar     = SCB->MMFAR;
+    dump->mBfar      = SCB->BFAR;
+
+    if ((sp >= (uint32_t)&__StackLimit) && (sp + sizeof(dump->mRegisters) <= (uint32_t)&__StackTop))
+    {
+        memcpy(dump->mRegisters, aFrame, sizeof(dump->mRegisters));
+        // Skip the exception stack frame to get the stack pointer at the fault.
+        sp += sizeof(dump->mRegisters);
+    }
+
+    saveStack(dump, sp);
+    saveRadioLog(dump);
+    commitAndReset();
+}
+
+/**
+ * HardFault handler overriding the weak one of the startup code. Passes the exception stack frame of the stack used
+ * at the fault to nrf5CrashHardFault().
+ *
+ */
+__attribute__((naked)) void HardFault_Handler(void)
+{
+    __ASM volatile("tst lr, #4            \n"
+                   "ite eq                \n"
+                   "mrseq r0, msp         \n"
+                   "mrsne r0, psp         \n"
+                   "mov r1, lr            \n"
+                   "b nrf5CrashHardFault  \n");
+}
+
+void nrf5CrashDumpSave(PlatformCrashReason aReason, uint32_t aInfo0, uint32_t aInfo1, const char *aFile)
+{
+    saveSoftwareCrash(aReason, aInfo0, aInfo1, aFile, (uint32_t)__builtin_return_address(0));
+}
+
+void nrf5CrashDumpInit(void)
+{
+    sLastReason = kCrashReasonNone;
+    sSaving     = false;
+
+    if (!isRecordValid())
+    {
+        memset(&sRetainedRecord, 0, sizeof(sRetainedRecord));
+    }
+    else if (!sRetainedRecord.mReported)
+    {
+        sLastReason               = (PlatformCrashReason)sRetainedRecord.mDump.mReason;
+        sRetainedRecord.mReported = 1;
+    }
+}
+
+const PlatformCrashDump *nrf5CrashDumpGet(void)
+{
+    return isRecordValid() ? &sRetainedRecord.mDump : NULL;
+}
+
+const uint8_t *nrf5CrashDumpRawGet(uint16_t *aLength)
+{
+    const PlatformCrashDump *dump = nrf5CrashDumpGet();
+
+    *aLength = (dump != NULL) ? sizeof(*dump) : 0;
+
+    return (const uint8_t *)dump;
+}
+
+void nrf5CrashDumpClear(void)
+{
+    memset(&sRetainedRecord, 0, sizeof(sRetainedRecord));
+}
+
+PlatformCrashReason nrf5CrashLastReasonGet(void)
+{
+    return sLastReason;
+}
+
+void __assert_func(const char *aFile, int aLine, const char *aFunc, const char *aExpr)
+{
+    OT_UNUSED_VARIABLE(aFunc);
+    OT_UNUSED_VARIABLE(aExpr);
+
+    saveSoftwareCrash(kCrashReasonAssert, (uint32_t)aLine, 0, aFile, (uint32_t)__builtin_return_address(0));
+}
+
+#if OPENTHREAD_CONFIG_PLATFORM_ASSERT_MANAGEMENT
+void otPlatAssertFail(const char *aFilename, int aLineNumber)
+{
+    saveSoftwareCrash(kCrashReasonAssert, (uint32_t)aLineNumber, 0, aFilename, (uint32_t)__builtin_return_address(0));
+}
+#endif
+
+void app_error_fault_handler(uint32_t aId, uint32_t aPc, uint32_t aInfo)
+{
+    saveSoftwareCrash(kCrashReasonAppError, aId, aInfo, NULL, aPc);
+}
+
+#else // PLATFORM_CRASH_DUMP_ENABLE
+
+void nrf5CrashDumpInit(void)
+{
+}
+
+const PlatformCrashDump *nrf5CrashDumpGet(void)
+{
+    return NULL;
+}
+
+const uint8_t *nrf5CrashDumpRawGet(uint16_t *aLength)
+{
+    *aLength = 0;
+
+    return NULL;
+}
+
+void nrf5CrashDumpClear(void)
+{
+}
+
+PlatformCrashReason nrf5CrashLastReasonGet(void)
+{
+    return kCrashReasonNone;
+}
+
+void nrf5CrashDumpSave(PlatformCrashReason aReason, uint32_t aInfo0, uint32_t aInfo1, const char *aFile)
+{
+    OT_UNUSED_VARIABLE(aReason);
+    OT_UNUSED_VARIABLE(aInfo0);
+    OT_UNUSED_VARIABLE(aInfo1);
+    OT_UNUSED_VARIABLE(aFile);
+}
+
+#endif // PLATFORM_CRASH_DUMP_ENABLE
@@ -35,6 +35,7 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "platform-nrf5-transport.h"
 #include "platform-nrf5.h"
 
 #include <hal/nrf_gpio.h>
@@ -155,6 +156,145 @@ exit:
     return error;
 }
 
+static otError processFlashWear(otInstance *aInstance, uint8_t aArgsLength, char *aArgs[])
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aArgs);
+
+    otError                error = OT_ERROR_NONE;
+    PlatformFlashWearStats stats;
+    uint64_t               uptime = nrf5AlarmGetCurrentTime() / 1000000;
+
+    otEXPECT_ACTION(otPlatDiagModeGet(), error = OT_ERROR_INVALID_STATE);
+    otEXPECT_ACTION(aArgsLength == 0, error = OT_ERROR_INVALID_ARGS);
+
+    nrf5FlashWearStatsGet(&stats);
+
+    diagOutput("pages: %u\r\nerases since boot: %" PRIu32 "\r\n", stats.mPageCount, stats.mErasesSinceBoot);
+    otEXPECT(stats.mTracked);
+
+    for (uint16_t i = 0; i < stats.mPageCount; i++)
+    {
+        uint32_t eraseCount;
+
+        if (nrf5FlashWearPageEraseCountGet(i, &eraseCount) == OT_ERROR_NONE)
+        {
+            diagOutput("page %u: %" PRIu32 "\r\n", i, eraseCount);
+        }
+    }
+
+    diagOutput("erase count min: %" PRIu32 "\r\nerase count avg: %" PRIu32 "\r\nerase count max: %" PRIu32 "\r\n",
+               stats.mEraseCountMin, stats.mEraseCountTotal / stats.mPageCount, stats.mEraseCountMax);
+
+    // Project the remaining erase budget of the area at the erase rate observed since boot.
+    if (stats.mErasesSinceBoot > 0 && uptime > 0)
+    {
+        uint64_t budget = (uint64_t)stats.mPageCount * PLATFORM_FLASH_ENDURANCE_CYCLES;
+        uint64_t left   = (budget > stats.mEraseCountTotal) ? budget - stats.mEraseCountTotal : 0;
+
+        diagOutput("projected lifetime: %" PRIu32 " days\r\n",
+                   (uint32_t)(left * uptime / stats.mErasesSinceBoot / (24 * 3600)));
+    }
+    else
+    {
+        diagOutput("projected lifetime: unknown\r\n");
+    }
+
+exit:
+    appendErrorResult(error);
+    return error;
+}
+
+static otError processFlashSched(otInstance *aInstance, uint8_t aArgsLength, char *aArgs[])
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    otError                     error = OT_ERROR_NONE;
+    PlatformFlashSchedulerStats stats;
+
+    otEXPECT_ACTION(otPlatDiagModeGet(), error = OT_ERROR_INVALID_STATE);
+
+    if (aArgsLength == 0)
+    {
+        nrf5FlashSchedulerStatsGet(&stats);
+
+        diagOutput("operations: %" PRIu32 "\r\npostponed: %" PRIu32 "\r\nforced: %" PRIu32 "\r\n",
+                   stats.mOperations, stats.mPostponed, stats.mForced);
+        diagOutput("delay total: %" PRIu32 " us\r\ndelay max: %" PRIu32 " us\r\npartial erases: %" PRIu32 "\r\n",
+                   stats.mDelayTotal, stats.mDelayMax, stats.mPartialErases);
+    }
+    else if (aArgsLength == 1 && strcmp(aArgs[0], "reset") == 0)
+    {
+        nrf5FlashSchedulerStatsReset();
+    }
+    else
+    {
+        error = OT_ERROR_INVALID_ARGS;
+    }
+
+exit:
+    appendErrorResult(error);
+    return error;
+}
+
+static otError processHfxo(otInstance *aInstance, uint8_t aArgsLength, char *aArgs[])
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    otError                error = OT_ERROR_NONE;
+    PlatformRadioHfxoStats stats;
+
+    otEXPECT_ACTION(otPlatDiagModeGet(), error = OT_ERROR_INVALID_STATE);
+
+    if (aArgsLength == 0)
+    {
+        otEXPECT_ACTION(nrf5RadioHfxoStatsGet(&stats) != OT_ERROR_NOT_CAPABLE, diagOutput("hfxo policy: disabled\r\n"));
+
+        diagOutput("prestarts: %" PRIu32 "\r\nhits: %" PRIu32 "\r\nmisses: %" PRIu32 "\r\nkeep warm: %" PRIu32
+                   " us\r\n",
+                   stats.mPrestarts, stats.mHits, stats.mMisses, stats.mKeepWarm);
+        diagOutput("latency saved: %" PRIu32 " ms\r\nwarm time: %" PRIu32 " ms\r\nextra charge: %" PRIu32 " uC\r\n",
+                   (uint32_t)(stats.mLatencySaved / 1000), (uint32_t)(stats.mWarmTime / 1000),
+                   (uint32_t)(stats.mExtraCharge / 1000));
+    }
+    else if (aArgsLength == 1 && strcmp(aArgs[0], "reset") == 0)
+    {
+        nrf5RadioHfxoStatsReset();
+    }
+    else
+    {
+        error = OT_ERROR_INVALID_ARGS;
+    }
+
+exit:
+    appendErrorResult(error);
+    return error;
+}
+
+static otError processHostWake(otInstance *aInstance, uint8_t aArgsLength, char *aArgs[])
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aArgs);
+
+    otError               error = OT_ERROR_NONE;
+    PlatformHostWakeStats stats;
+
+    otEXPECT_ACTION(otPlatDiagModeGet(), error = OT_ERROR_INVALID_STATE);
+    otEXPECT_ACTION(aArgsLength == 0, error = OT_ERROR_INVALID_ARGS);
+
+    nrf5TransportHostWakeStatsGet(&stats);
+
+    diagOutput("host wake: %s\r\n", HOST_WAKE_ENABLE ? "enabled" : "disabled");
+    diagOutput("wake: %" PRIu32 "\r\nready: %" PRIu32 "\r\ntimeout: %" PRIu32 "\r\n", stats.mWakeCount,
+               stats.mReadyCount, stats.mTimeoutCount);
+    diagOutput("latency min: %" PRIu32 " us\r\nlatency avg: %" PRIu32 " us\r\nlatency max: %" PRIu32 " us\r\n",
+               stats.mLatencyMinUs, stats.mLatencyAvgUs, stats.mLatencyMaxUs);
+
+exit:
+    appendErrorResult(error);
+    return error;
+}
+
 static otError processID(otInstance *aInstance, uint8_t aArgsLength, char *aArgs[])
 {
     OT_UNUSED_VARIABLE(aInstance);
@@ -282,6 +422,193 @@ exit:
     return error;
 }
 
+static otError processBootloader(otInstance *aInstance, uint8_t aArgsLength, char *aArgs[])
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aArgs);
+
+    otError error = OT_ERROR_NONE;
+
+    otEXPECT_ACTION(otPlatDiagModeGet(), error = OT_ERROR_INVALID_STATE);
+    otEXPECT_ACTION(aArgsLength == 0, error = OT_ERROR_INVALID_ARGS);
+
+    diagOutput("last entry: %s\r\n", nrf5BootloaderEntryFailed() ? "failed" : "ok");
+
+exit:
+    appendErrorResult(error);
+    return error;
+}
+
+static otError processBootTime(otInstance *aInstance, uint8_t aArgsLength, char *aArgs[])
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aArgs);
+
+    otError error = OT_ERROR_NONE;
+
+    otEXPECT_ACTION(otPlatDiagModeGet(), error = OT_ERROR_INVALID_STATE);
+    otEXPECT_ACTION(aArgsLength == 0, error = OT_ERROR_INVALID_ARGS);
+
+    for (uint32_t i = 0; i < kBootNumMilestones; i++)
+    {
+        uint32_t time = nrf5BootMilestoneTimeGet((PlatformBootMilestone)i);
+
+        if (time == NRF5_BOOT_TIME_INVALID)
+        {
+            diagOutput("%s: pending\r\n", nrf5BootMilestoneToString((PlatformBootMilestone)i));
+        }
+        else
+        {
+            diagOutput("%s: %" PRIu32 " us\r\n", nrf5BootMilestoneToString((PlatformBootMilestone)i), time);
+        }
+    }
+
+exit:
+    appendErrorResult(error);
+    return error;
+}
+
+static void outputCcaStats(void)
+{
+    PlatformRadioCcaChannelStats stats;
+
+    diagOutput("adaptive: %s\r\n", nrf5RadioCcaAdaptiveIsEnabled() ? "enabled" : "disabled");
+
+    for (uint8_t channel = OT_RADIO_2P4GHZ_OQPSK_CHANNEL_MIN; channel <= OT_RADIO_2P4GHZ_OQPSK_CHANNEL_MAX; channel++)
+    {
+        otEXPECT(nrf5RadioCcaChannelStatsGet(channel, &stats) == OT_ERROR_NONE);
+
+        diagOutput("%u: busy %" PRIu32 " idle %" PRIu32, channel, stats.mBusy, stats.mIdle);
+
+        if (stats.mNoiseFloor != OT_RADIO_RSSI_INVALID)
+        {
+            diagOutput(" floor %d", stats.mNoiseFloor);
+        }
+
+        if (stats.mThreshold != OT_RADIO_RSSI_INVALID)
+        {
+            diagOutput(" threshold %d", stats.mThreshold);
+        }
+
+        diagOutput("\r\n");
+    }
+
+exit:
+    return;
+}
+
+static otError processCca(otInstance *aInstance, uint8_t aArgsLength, char *aArgs[])
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    otError error = OT_ERROR_NONE;
+
+    otEXPECT_ACTION(otPlatDiagModeGet(), error = OT_ERROR_INVALID_STATE);
+
+    if (aArgsLength == 0)
+    {
+        outputCcaStats();
+    }
+    else if (aArgsLength == 1 && strcmp(aArgs[0], "reset") == 0)
+    {
+        nrf5RadioCcaStatsReset();
+    }
+    else if (aArgsLength == 2 && strcmp(aArgs[0], "adaptive") == 0)
+    {
+        bool enable = (strcmp(aArgs[1], "on") == 0);
+
+        otEXPECT_ACTION(enable || strcmp(aArgs[1], "off") == 0, error = OT_ERROR_INVALID_ARGS);
+
+        error = nrf5RadioCcaAdaptiveSet(enable);
+        otEXPECT(error == OT_ERROR_NONE);
+        diagOutput("set cca adaptive threshold %s\r\nstatus 0x%02x\r\n", aArgs[1], error);
+    }
+    else
+    {
+        error = OT_ERROR_INVALID_ARGS;
+    }
+
+exit:
+    appendErrorResult(error);
+    return error;
+}
+
+static otError processCcaMode(otInstance *aInstance, uint8_t aArgsLength, char *aArgs[])
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    static const struct
+    {
+        const char          *mName;
+        nrf_radio_cca_mode_t mMode;
+    } kModes[] = {{"ed", NRF_RADIO_CCA_MODE_ED},
+                  {"carrier", NRF_RADIO_CCA_MODE_CARRIER},
+                  {"carrier-and-ed", NRF_RADIO_CCA_MODE_CARRIER_AND_ED},
+                  {"carrier-or-ed", NRF_RADIO_CCA_MODE_CARRIER_OR_ED}};
+
+    otError              error = OT_ERROR_NONE;
+    nrf_802154_cca_cfg_t ccaConfig;
+    size_t               i;
+
+    otEXPECT_ACTION(otPlatDiagModeGet(), error = OT_ERROR_INVALID_STATE);
+
+    nrf_802154_cca_cfg_get(&ccaConfig);
+
+    if (aArgsLength == 0)
+    {
+        const char *name = "unknown";
+
+        for (i = 0; i < sizeof(kModes) / sizeof(kModes[0]); i++)
+        {
+            if (kModes[i].mMode == ccaConfig.mode)
+            {
+                name = kModes[i].mName;
+            }
+        }
+
+        diagOutput("cca mode: %s\r\ncorrelator threshold: %u\r\ncorrelator limit: %u\r\n", name,
+                   ccaConfig.corr_threshold, ccaConfig.corr_limit);
+    }
+    else
+    {
+        otEXPECT_ACTION(aArgsLength == 1 || aArgsLength == 3, error = OT_ERROR_INVALID_ARGS);
+
+        for (i = 0; i < sizeof(kModes) / sizeof(kModes[0]); i++)
+        {
+            if (strcmp(aArgs[0], kModes[i].mName) == 0)
+            {
+                break;
+            }
+        }
+
+        otEXPECT_ACTION(i < sizeof(kModes) / sizeof(kModes[0]), error = OT_ERROR_INVALID_ARGS);
+        ccaConfig.mode = kModes[i].mMode;
+
+        if (aArgsLength == 3)
+        {
+            long threshold;
+            long limit;
+
+            error = parseLong(aArgs[1], &threshold);
+            otEXPECT(error == OT_ERROR_NONE);
+            error = parseLong(aArgs[2], &limit);
+            otEXPECT(error == OT_ERROR_NONE);
+            otEXPECT_ACTION(threshold >= 0 && threshold <= 0xFF && limit >= 0 && limit <= 0xFF,
+                            error = OT_ERROR_INVALID_ARGS);
+
+            ccaConfig.corr_threshold = (uint8_t)threshold;
+            ccaConfig.corr_limit     = (uint8_t)limit;
+        }
+
+        nrf_802154_cca_cfg_set(&ccaConfig);
+        diagOutput("set cca mode to %s\r\nstatus 0x%02x\r\n", kModes[i].mName, error);
+    }
+
+exit:
+    appendErrorResult(error);
+    return error;
+}
+
 static otError processCcaThreshold(otInstance *aInstance, uint8_t aArgsLength, char *aArgs[])
 {
     OT_UNUSED_VARIABLE(aInstance);
@@ -304,24 +631,544 @@ static otError processCcaThreshold(otInstance *aInstance, uint8_t aArgsLength, c
         otEXPECT(error == OT_ERROR_NONE);
         otEXPECT_ACTION(value >= 0 && value <= 0xFF, error = OT_ERROR_INVALID_ARGS);
 
-        memset(&ccaConfig, 0, sizeof(ccaConfig));
-        ccaConfig.mode         = NRF_RADIO_CCA_MODE_ED;
-        ccaConfig.ed_threshold = (uint8_t)value;
+        nrf5RadioCcaEdThresholdSet((uint8_t)value);
+        diagOutput("set cca threshold to %u\r\nstatus 0x%02x\r\n", (uint8_t)value, error);
+    }
 
-        nrf_802154_cca_cfg_set(&ccaConfig);
-        diagOutput("set cca threshold to %u\r\nstatus 0x%02x\r\n", ccaConfig.ed_threshold, error);
+exit:
+    appendErrorResult(error);
+    return error;
+}
+
+static void outputAntennaStats(void)
+{
+    static const char *const kModeNames[] = {"disabled", "manual", "auto"};
+
+    nrf_802154_ant_diversity_stats_t stats;
+
+    nrf_802154_antenna_diversity_stats_get(&stats);
+
+    diagOutput("mode: %s\r\nantenna: %u\r\n", kModeNames[nrf_802154_antenna_diversity_mode_get()],
+               nrf_802154_antenna_get() + 1);
+
+    for (uint8_t i = 0; i < NRF_802154_ANT_DIVERSITY_ANTENNAS; i++)
+    {
+        const nrf_802154_ant_diversity_antenna_stats_t *antenna = &stats.antenna[i];
+
+        diagOutput("antenna %u: rx %" PRIu32 " crcerr %" PRIu32 " rssi %d tx %" PRIu32 " acked %" PRIu32
+                   " noack %" PRIu32 "\r\n",
+                   i + 1, antenna->rx_frames, antenna->rx_crc_errors, antenna->rx_rssi, antenna->tx_frames,
+                   antenna->tx_acked, antenna->tx_no_ack);
+    }
+
+    diagOutput("tx switches: %" PRIu32 "\r\n", stats.tx_switches);
+}
+
+static otError processAntenna(otInstance *aInstance, uint8_t aArgsLength, char *aArgs[])
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    otError error = OT_ERROR_NONE;
+
+    otEXPECT_ACTION(otPlatDiagModeGet(), error = OT_ERROR_INVALID_STATE);
+
+    if (aArgsLength == 0)
+    {
+        outputAntennaStats();
+    }
+    else if (aArgsLength == 1 && strcmp(aArgs[0], "reset") == 0)
+    {
+        nrf_802154_antenna_diversity_stats_reset();
+    }
+    else if (aArgsLength == 2 && strcmp(aArgs[0], "mode") == 0)
+    {
+        nrf_802154_ant_diversity_mode_t mode;
+
+        if (strcmp(aArgs[1], "disabled") == 0)
+        {
+            mode = NRF_802154_ANT_DIVERSITY_MODE_DISABLED;
+        }
+        else if (strcmp(aArgs[1], "manual") == 0)
+        {
+            mode = NRF_802154_ANT_DIVERSITY_MODE_MANUAL;
+        }
+        else
+        {
+            otEXPECT_ACTION(strcmp(aArgs[1], "auto") == 0, error = OT_ERROR_INVALID_ARGS);
+            mode = NRF_802154_ANT_DIVERSITY_MODE_AUTO;
+        }
+
+        otEXPECT_ACTION(nrf_802154_antenna_diversity_mode_set(mode), error = OT_ERROR_NOT_CAPABLE);
+        diagOutput("set antenna mode to %s\r\nstatus 0x%02x\r\n", aArgs[1], error);
+    }
+    else if (aArgsLength == 2 && strcmp(aArgs[0], "select") == 0)
+    {
+        long value;
+
+        error = parseLong(aArgs[1], &value);
+        otEXPECT(error == OT_ERROR_NONE);
+        otEXPECT_ACTION(value >= 1 && value <= NRF_802154_ANT_DIVERSITY_ANTENNAS, error = OT_ERROR_INVALID_ARGS);
+
+        nrf_802154_antenna_set((nrf_802154_ant_diversity_antenna_t)(value - 1));
+        diagOutput("set antenna to %ld\r\nstatus 0x%02x\r\n", value, error);
     }
+    else
+    {
+        error = OT_ERROR_INVALID_ARGS;
+    }
+
+exit:
+    appendErrorResult(error);
+    return error;
+}
+
+static const char *crashReasonToString(uint32_t aReason)
+{
+    static const char *const kReasonNames[] = {"none", "hardfault", "assert", "apperror", "purevirtual"};
+
+    return (aReason < sizeof(kReasonNames) / sizeof(kReasonNames[0])) ? kReasonNames[aReason] : "unknown";
+}
+
+static void outputCrashDumpWords(const char *aName, const uint32_t *aWords, uint32_t aLength)
+{
+    diagOutput("%s:", aName);
+
+    for (uint32_t i = 0; i < aLength; i++)
+    {
+        diagOutput("%s 0x%08" PRIx32, (i % 4 == 0) ? "\r\n" : "", aWords[i]);
+    }
+
+    diagOutput("\r\n");
+}
+
+static void outputCrashDump(const PlatformCrashDump *aDump)
+{
+    diagOutput("crash dump: %s\r\nuptime: %" PRIu32 " ms\r\n", crashReasonToString(aDump->mReason), aDump->mUptime);
+    diagOutput("r0 0x%08" PRIx32 " r1 0x%08" PRIx32 " r2 0x%08" PRIx32 " r3 0x%08" PRIx32 "\r\n", aDump->mRegisters[0],
+               aDump->mRegisters[1], aDump->mRegisters[2], aDump->mRegisters[3]);
+    diagOutput("r12 0x%08" PRIx32 " lr 0x%08" PRIx32 " pc 0x%08" PRIx32 " xpsr 0x%08" PRIx32 "\r\n",
+               aDump->mRegisters[4], aDump->mRegisters[5], aDump->mRegisters[6], aDump->mRegisters[7]);
+    diagOutput("sp 0x%08" PRIx32 " exc_return 0x%08" PRIx32 "\r\n", aDump->mSp, aDump->mExcReturn);
+    diagOutput("cfsr 0x%08" PRIx32 " hfsr 0x%08" PRIx32 " mmfar 0x%08" PRIx32 " bfar 0x%08" PRIx32 "\r\n",
+               aDump->mCfsr, aDump->mHfsr, aDump->mMmfar, aDump->mBfar);
+    diagOutput("info 0x%08" PRIx32 " 0x%08" PRIx32 " file %.*s\r\n", aDump->mInfo[0], aDump->mInfo[1],
+               (int)sizeof(aDump->mFile), aDump->mFile);
+    diagOutput("radio state: %" PRIu32 "\r\n", aDump->mRadioState);
+    outputCrashDumpWords("stack", aDump->mStack, aDump->mStackSize);
+    outputCrashDumpWords("radio log", aDump->mRadioLog, aDump->mRadioLogSize);
+}
+
+static otError processCrashDump(otInstance *aInstance, uint8_t aArgsLength, char *aArgs[])
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    otError                  error = OT_ERROR_NONE;
+    const PlatformCrashDump *dump;
+
+    otEXPECT_ACTION(otPlatDiagModeGet(), error = OT_ERROR_INVALID_STATE);
+
+    if (aArgsLength == 0)
+    {
+        dump = nrf5CrashDumpGet();
+
+        if (dump == NULL)
+        {
+            diagOutput("crash dump: none\r\n");
+        }
+        else
+        {
+            outputCrashDump(dump);
+        }
+    }
+    else
+    {
+        otEXPECT_ACTION(aArgsLength == 1 && strcmp(aArgs[0], "clear") == 0, error = OT_ERROR_INVALID_ARGS);
+
+        nrf5CrashDumpClear();
+        diagOutput("crash dump cleared\r\n");
+    }
+
+exit:
+    appendErrorResult(error);
+    return error;
+}
+
+static void outputMacAddress(const otMacAddress *aAddress)
+{
+    if (aAddress->mType == OT_MAC_ADDRESS_TYPE_SHORT)
+    {
+        diagOutput("%04x", aAddress->mAddress.mShortAddress);
+    }
+    else
+    {
+        for (uint8_t i = 0; i < sizeof(otExtAddress); i++)
+        {
+            diagOutput("%02x", aAddress->mAddress.mExtAddress.m8[i]);
+        }
+    }
+}
+
+static void outputLinkInfo(const PlatformLinkInfo *aInfo)
+{
+    outputMacAddress(&aInfo->mAddress);
+    diagOutput(" rssi %d lqi %u per %" PRIu32 "%% ack %" PRIu32 "%% heard %" PRIu32 " ms ago\r\n", aInfo->mRssi,
+               aInfo->mLqi, (uint32_t)aInfo->mFrameErrorRate * 100 / 0xffff, (uint32_t)aInfo->mAckRate * 100 / 0xffff,
+               otPlatAlarmMilliGetNow() - aInfo->mLastHeard);
+    diagOutput("    rx %" PRIu32 " crc errors %" PRIu32 " tx %" PRIu32 " acked %" PRIu32 "\r\n", aInfo->mRxFrames,
+               aInfo->mRxCrcErrors, aInfo->mTxFrames, aInfo->mTxAcked);
+}
+
+static otError processLink(otInstance *aInstance, uint8_t aArgsLength, char *aArgs[])
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    otError error = OT_ERROR_NONE;
+
+    otEXPECT_ACTION(otPlatDiagModeGet(), error = OT_ERROR_INVALID_STATE);
+
+    if (aArgsLength == 0)
+    {
+        PlatformLinkInfo info;
+
+        for (uint8_t i = 0;; i++)
+        {
+            otError infoError = nrf5LinkEstimatorGetByIndex(i, &info);
+
+            if (infoError == OT_ERROR_NONE)
+            {
+                outputLinkInfo(&info);
+            }
+            else if (infoError == OT_ERROR_NOT_CAPABLE)
+            {
+                diagOutput("link estimator: disabled\r\n");
+                break;
+            }
+            else if (infoError != OT_ERROR_NOT_FOUND)
+            {
+                break;
+            }
+        }
+    }
+    else if (aArgsLength == 1 && strcmp(aArgs[0], "reset") == 0)
+    {
+        nrf5LinkEstimatorReset();
+    }
+    else
+    {
+        error = OT_ERROR_INVALID_ARGS;
+    }
+
+exit:
+    appendErrorResult(error);
+    return error;
+}
+
+static otError processPending(otInstance *aInstance, uint8_t aArgsLength, char *aArgs[])
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    otError                   error = OT_ERROR_NONE;
+    PlatformRadioPendingStats stats;
+
+    otEXPECT_ACTION(otPlatDiagModeGet(), error = OT_ERROR_INVALID_STATE);
+
+    if (aArgsLength == 0)
+    {
+        nrf5RadioPendingStatsGet(&stats);
+
+        diagOutput("decisions: %" PRIu32 "\r\nfallbacks: %" PRIu32 "\r\n", stats.mDecisions, stats.mFallbacks);
+        diagOutput("table false pending: %" PRIu32 "\r\ntable missed pending: %" PRIu32 "\r\n", stats.mFalsePending,
+                   stats.mMissedPending);
+    }
+    else if (aArgsLength == 1 && strcmp(aArgs[0], "reset") == 0)
+    {
+        nrf5RadioPendingStatsReset();
+    }
+    else
+    {
+        error = OT_ERROR_INVALID_ARGS;
+    }
+
+exit:
+    appendErrorResult(error);
+    return error;
+}
+
+static otError processKeys(otInstance *aInstance, uint8_t aArgsLength, char *aArgs[])
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    otError               error = OT_ERROR_NONE;
+    PlatformRadioKeyStats stats;
+
+    otEXPECT_ACTION(otPlatDiagModeGet(), error = OT_ERROR_INVALID_STATE);
+
+    if (aArgsLength == 0)
+    {
+        otEXPECT_ACTION(nrf5RadioKeyStatsGet(&stats) != OT_ERROR_NOT_CAPABLE, diagOutput("keys: not supported\r\n"));
+
+        diagOutput("rotations: %" PRIu32 "\r\nunknown key ids: %" PRIu32 "\r\n", stats.mRotations,
+                   stats.mUnknownKeyIds);
+
+        for (uint8_t i = 0; i < NRF5_RADIO_KEY_SLOTS; i++)
+        {
+            if (stats.mKeys[i].mKeyId == 0)
+            {
+                continue;
+            }
+
+            diagOutput("key %u: frame counter %" PRIu32 " frames %" PRIu32 " enh-acks %" PRIu32 "\r\n",
+                       stats.mKeys[i].mKeyId, stats.mKeys[i].mFrameCounter, stats.mKeys[i].mFrames,
+                       stats.mKeys[i].mEnhAcks);
+        }
+    }
+    else if (aArgsLength == 1 && strcmp(aArgs[0], "reset") == 0)
+    {
+        nrf5RadioKeyStatsReset();
+    }
+    else
+    {
+        error = OT_ERROR_INVALID_ARGS;
+    }
+
+exit:
+    appendErrorResult(error);
+    return error;
+}
+
+static otError processPreemption(otInstance *aInstance, uint8_t aArgsLength, char *aArgs[])
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    static const char *const kClassNames[kRadioNumOpClasses] = {"idlerx", "tx", "edcca", "schedtx", "schedrx"};
+
+    otError                      error = OT_ERROR_NONE;
+    PlatformRadioPreemptionStats stats;
+    uint8_t                      priority;
+    uint8_t                      opClass;
+    long                         value;
+
+    otEXPECT_ACTION(otPlatDiagModeGet(), error = OT_ERROR_INVALID_STATE);
+
+    if (aArgsLength == 0)
+    {
+        otEXPECT_ACTION(nrf5RadioPreemptionStatsGet(&stats) != OT_ERROR_NOT_CAPABLE,
+                        diagOutput("preemption policy: disabled\r\n"));
+
+        for (uint8_t i = 0; i < kRadioNumOpClasses; i++)
+        {
+            nrf5RadioPreemptionPriorityGet((PlatformRadioOpClass)i, &priority);
+            diagOutput("%s: priority %u preempted %" PRIu32 " denied %" PRIu32 "\r\n", kClassNames[i], priority,
+                       stats.mPreempted[i], stats.mDenied[i]);
+        }
+    }
+    else if (aArgsLength == 1 && strcmp(aArgs[0], "reset") == 0)
+    {
+        nrf5RadioPreemptionStatsReset();
+    }
+    else if (aArgsLength == 3 && strcmp(aArgs[0], "priority") == 0)
+    {
+        for (opClass = 0; opClass < kRadioNumOpClasses; opClass++)
+        {
+            if (strcmp(aArgs[1], kClassNames[opClass]) == 0)
+            {
+                break;
+            }
+        }
+
+        otEXPECT_ACTION(opClass < kRadioNumOpClasses, error = OT_ERROR_INVALID_ARGS);
+
+        error = parseLong(aArgs[2], &value);
+        otEXPECT(error == OT_ERROR_NONE);
+        otEXPECT_ACTION(value >= 0 && value <= UINT8_MAX, error = OT_ERROR_INVALID_ARGS);
+
+        error = nrf5RadioPreemptionPrioritySet((PlatformRadioOpClass)opClass, (uint8_t)value);
+    }
+    else
+    {
+        error = OT_ERROR_INVALID_ARGS;
+    }
+
+exit:
+    appendErrorResult(error);
+    return error;
+}
+
+static otError processChannelMap(otInstance *aInstance, uint8_t aArgsLength, char *aArgs[])
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    otError                error = OT_ERROR_NONE;
+    PlatformChannelQuality quality;
+    uint8_t                best;
+
+    otEXPECT_ACTION(otPlatDiagModeGet(), error = OT_ERROR_INVALID_STATE);
+
+    if (aArgsLength == 0)
+    {
+        otEXPECT_ACTION(nrf5ChannelMapGet(OT_RADIO_2P4GHZ_OQPSK_CHANNEL_MIN, &quality) != OT_ERROR_NOT_CAPABLE,
+                        diagOutput("channel map: disabled\r\n"));
+
+        for (uint8_t i = OT_RADIO_2P4GHZ_OQPSK_CHANNEL_MIN; i <= OT_RADIO_2P4GHZ_OQPSK_CHANNEL_MAX; i++)
+        {
+            nrf5ChannelMapGet(i, &quality);
+            diagOutput("%u: occupancy %" PRIu32 "%% crc errors %" PRIu32 "%% energy %d dBm\r\n", i,
+                       (uint32_t)quality.mOccupancy * 100 / 0xffff, (uint32_t)quality.mCrcErrorRate * 100 / 0xffff,
+                       quality.mEnergy);
+            diagOutput("    samples %" PRIu32 " cca busy %" PRIu32 " idle %" PRIu32, quality.mEdSamples,
+                       quality.mCcaBusy, quality.mCcaIdle);
+            diagOutput(" rx %" PRIu32 " crc errors %" PRIu32 "\r\n", quality.mRxFrames, quality.mRxCrcErrors);
+        }
+
+        if (nrf5ChannelMapBestChannelGet(OT_RADIO_2P4GHZ_OQPSK_CHANNEL_MASK, &best) == OT_ERROR_NONE)
+        {
+            diagOutput("best: %u\r\n", best);
+        }
+    }
+    else if (aArgsLength == 1 && strcmp(aArgs[0], "reset") == 0)
+    {
+        nrf5ChannelMapReset();
+    }
+    else
+    {
+        error = OT_ERROR_INVALID_ARGS;
+    }
+
+exit:
+    appendErrorResult(error);
+    return error;
+}
+
+static void outputTpcNeighbor(const PlatformRadioTpcNeighbor *aNeighbor)
+{
+    outputMacAddress(&aNeighbor->mAddress);
+    diagOutput(" rssi %d lqi %u power %d\r\n", aNeighbor->mRssi, aNeighbor->mLqi, aNeighbor->mTxPower);
+}
+
+static otError processTpc(otInstance *aInstance, uint8_t aArgsLength, char *aArgs[])
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    otError               error = OT_ERROR_NONE;
+    PlatformRadioTpcStats stats;
+
+    otEXPECT_ACTION(otPlatDiagModeGet(), error = OT_ERROR_INVALID_STATE);
+
+    if (aArgsLength == 0)
+    {
+        PlatformRadioTpcNeighbor neighbor;
+
+        nrf5RadioTpcStatsGet(&stats);
+
+        diagOutput("tpc: %s\r\n",
+                   (nrf5RadioTpcNeighborGet(0, &neighbor) == OT_ERROR_NOT_CAPABLE) ? "disabled" : "enabled");
+        diagOutput("updates: %" PRIu32 "\r\ndecreases: %" PRIu32 "\r\nincreases: %" PRIu32 "\r\n", stats.mUpdates,
+                   stats.mDecreases, stats.mIncreases);
+        diagOutput("noack restores: %" PRIu32 "\r\n", stats.mNoAckRestores);
+        diagOutput("reduced frames: %" PRIu32 "\r\nfull frames: %" PRIu32 "\r\naverage reduction: %" PRIu32 " dB\r\n",
+                   stats.mReducedFrames, stats.mFullFrames,
+                   (stats.mReducedFrames > 0) ? stats.mReductionTotal / stats.mReducedFrames : 0);
+
+        for (uint8_t i = 0;; i++)
+        {
+            otError neighborError = nrf5RadioTpcNeighborGet(i, &neighbor);
+
+            if (neighborError == OT_ERROR_NONE)
+            {
+                outputTpcNeighbor(&neighbor);
+            }
+            else if (neighborError != OT_ERROR_NOT_FOUND)
+            {
+                break;
+            }
+        }
+    }
+    else if (aArgsLength == 1 && strcmp(aArgs[0], "reset") == 0)
+    {
+        nrf5RadioTpcReset();
+    }
+    else
+    {
+        error = OT_ERROR_INVALID_ARGS;
+    }
+
+exit:
+    appendErrorResult(error);
+    return error;
+}
+
+static otError processTrace(otInstance *aInstance, uint8_t aArgsLength, char *aArgs[])
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aArgs);
+
+    otError            error = OT_ERROR_NONE;
+    PlatformTraceEntry entries[8];
+    uint32_t           remaining = PLATFORM_TRACE_BUFFER_SIZE;
+    uint16_t           count;
+
+    otEXPECT_ACTION(otPlatDiagModeGet(), error = OT_ERROR_INVALID_STATE);
+    otEXPECT_ACTION(aArgsLength == 0, error = OT_ERROR_INVALID_ARGS);
+
+    // Drain at most one buffer worth of entries, the trace keeps growing while it is printed.
+    while ((remaining > 0) && ((count = nrf5TraceRead(entries, sizeof(entries) / sizeof(entries[0]))) > 0))
+    {
+        for (uint16_t i = 0; i < count; i++)
+        {
+            diagOutput("%08" PRIx32 " %04x %04x\r\n", entries[i].mTimestamp, entries[i].mEvent, entries[i].mParam);
+        }
+
+        remaining = (remaining > count) ? remaining - count : 0;
+    }
+
+    diagOutput("lost: %" PRIu32 "\r\n", nrf5TraceLostGet());
+
+exit:
+    appendErrorResult(error);
+    return error;
+}
+
+static otError processWatchdog(otInstance *aInstance, uint8_t aArgsLength, char *aArgs[])
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aArgs);
+
+    otError error = OT_ERROR_NONE;
+
+    otEXPECT_ACTION(otPlatDiagModeGet(), error = OT_ERROR_INVALID_STATE);
+    otEXPECT_ACTION(aArgsLength == 0, error = OT_ERROR_INVALID_ARGS);
+
+    diagOutput("watchdog: %s\r\nlast failed check: %s\r\n", WATCHDOG_ENABLE ? "enabled" : "disabled",
+               nrf5WatchdogCheckToString(nrf5WatchdogLastFailedCheckGet()));
 
 exit:
     appendErrorResult(error);
     return error;
 }
 
-const struct PlatformDiagCommand sCommands[] = {{"ccathreshold", &processCcaThreshold},
+const struct PlatformDiagCommand sCommands[] = {{"antenna", &processAntenna},
+                                                {"bootloader", &processBootloader},
+                                                {"boottime", &processBootTime},
+                                                {"cca", &processCca},
+                                                {"ccamode", &processCcaMode},
+                                                {"ccathreshold", &processCcaThreshold},
+                                                {"channelmap", &processChannelMap},
+                                                {"crashdump", &processCrashDump},
+                                                {"flashsched", &processFlashSched},
+                                                {"flashwear", &processFlashWear},
+                                                {"hfxo", &processHfxo},
+                                                {"hostwake", &processHostWake},
                                                 {"id", &processID},
+                                                {"keys", &processKeys},
+                                                {"link", &processLink},
                                                 {"listen", &processListen},
+                                                {"pending", &processPending},
+                                                {"preemption", &processPreemption},
                                                 {"temp", &processTemp},
-                                                {"transmit", &processTransmit}};
+                                                {"tpc", &processTpc},
+                                                {"trace", &processTrace},
+                                                {"transmit", &processTransmit},
+                                                {"watchdog", &processWatchdog}};
 
 void otPlatDiagSetOutputCallback(otInstance *aInstance, otPlatDiagOutputCallback aCallback, void *aContext)
 {
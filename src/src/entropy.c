@@ -177,6 +177,7 @@ void nrf5RandomInit(void)
 #endif // SOFTDEVICE_PRESENT
 
     srand(seed);
+    nrf5BootMilestoneReached(kBootMilestoneEntropy);
 }
 
 void nrf5RandomDeinit(void)
@@ -43,6 +43,7 @@
 
 #define ENABLE_FEM 1
 #include <nrf_802154.h>
+#include <nrf_802154_peripherals.h>
 
 // clang-format off
 
@@ -73,6 +74,13 @@
 
 // clang-format on
 
+#if NRF_802154_ANT_DIVERSITY_ENABLED &&                                                    \
+    ((NRF_802154_ANT_DIVERSITY_GPIOTE_CHANNEL == PLATFORM_FEM_DEFAULT_PA_GPIOTE_CHANNEL) ||  \
+     (NRF_802154_ANT_DIVERSITY_GPIOTE_CHANNEL == PLATFORM_FEM_DEFAULT_LNA_GPIOTE_CHANNEL) || \
+     (NRF_802154_ANT_DIVERSITY_GPIOTE_CHANNEL == PLATFORM_FEM_DEFAULT_PDN_GPIOTE_CHANNEL))
+#error "NRF_802154_ANT_DIVERSITY_GPIOTE_CHANNEL is used by the FEM, select a free channel"
+#endif
+
 #define PLATFORM_FEM_DEFAULT_CONFIG                                     \
     ((PlatformFemConfigParams){                                         \
         .mFemPhyCfg =                                                   \
@@ -30,6 +30,8 @@
 #include <stdint.h>
 #include <string.h>
 
+#include <utils/code_utils.h>
+
 #include "platform-nrf5.h"
 
 /**
@@ -47,10 +49,265 @@
 #define FLASH_PAGE_ADDR_MASK 0xFFFFF000
 #define FLASH_PAGE_SIZE 4096
 
+#if PLATFORM_FLASH_WEAR_LEVELING_ENABLE
+#if PLATFORM_FLASH_QSPI_ENABLE
+#error "Flash wear leveling is not supported with QSPI external flash."
+#endif
+
+// clang-format off
+#define FLASH_HEADER_MAGIC          0x4c57544fUL ///< Marks a page header ("OTWL").
+#define FLASH_ERASE_RECORD_MAGIC    0x45535245UL ///< Marks a valid erase record ("ERSE").
+#define FLASH_HEADER_SIZE           sizeof(FlashPageHeader)
+#define FLASH_PAGE_DATA_SIZE        (FLASH_PAGE_SIZE - FLASH_HEADER_SIZE)
+#define FLASH_UNASSIGNED            0xffffffffUL
+#define FLASH_SWAP_SHIFT            7
+#define FLASH_GENERATION_SHIFT      8
+#define FLASH_POSITION_MASK         ((1UL << FLASH_SWAP_SHIFT) - 1)
+#define FLASH_NUM_SWAPS             2
+// clang-format on
+
+/**
+ * Header reserved at the start of each page of the settings area.
+ *
+ * The header is programmed right after the page is erased, so the erase count survives the erase.
+ *
+ */
+typedef struct
+{
+    uint32_t mMagic;      ///< Equals @ref FLASH_HEADER_MAGIC if the header is valid.
+    uint32_t mEraseCount; ///< Number of times the page has been erased.
+    uint32_t mAssignment; ///< Generation, swap index and position the page holds, or @ref FLASH_UNASSIGNED.
+    uint32_t mReserved;
+} FlashPageHeader;
+
+typedef struct
+{
+    uint32_t mEraseCount;
+    uint32_t mGeneration;
+    int8_t   mSwapIndex; ///< Swap index the page belongs to, or -1 if the page is free.
+    uint8_t  mPosition;  ///< Position of the page within its swap.
+} FlashPageState;
+
+/**
+ * Page erase in progress, retained across a reset that happens between the page erase and the rewrite of its header.
+ *
+ */
+typedef struct
+{
+    uint32_t mMagic;      ///< Equals @ref FLASH_ERASE_RECORD_MAGIC while the erase is in progress.
+    uint32_t mPage;       ///< Index of the page being erased.
+    uint32_t mEraseCount; ///< Erase count of the page, including the erase in progress.
+} FlashEraseRecord;
+
+/**
+ * Erase record in retained RAM. The .noinit section is not cleared by the startup code.
+ *
+ */
+static FlashEraseRecord sEraseRecord __attribute__((section(".noinit")));
+
+static FlashPageState sPages[PLATFORM_FLASH_WEAR_MAX_PAGES];
+static uint8_t        sSwapMap[FLASH_NUM_SWAPS][PLATFORM_FLASH_WEAR_SWAP_PAGES];
+static uint32_t       sGeneration;
+#endif // PLATFORM_FLASH_WEAR_LEVELING_ENABLE
+
 static uint32_t sFlashDataStart;
 static uint32_t sFlashDataEnd;
 static uint32_t sSwapSize;
+static uint16_t sPageCount;
+static uint32_t sErasesSinceBoot;
+
+#if PLATFORM_FLASH_WEAR_LEVELING_ENABLE
+static inline uint32_t pageAddress(uint16_t aPage)
+{
+    return sFlashDataStart + aPage * FLASH_PAGE_SIZE;
+}
+
+static inline uint32_t mapAddress(uint8_t aSwapIndex, uint32_t aOffset)
+{
+    uint16_t page = sSwapMap[aSwapIndex][aOffset / FLASH_PAGE_DATA_SIZE];
+
+    return pageAddress(page) + FLASH_HEADER_SIZE + (aOffset % FLASH_PAGE_DATA_SIZE);
+}
+
+static inline uint32_t chunkSize(uint32_t aOffset, uint32_t aSize)
+{
+    uint32_t left = FLASH_PAGE_DATA_SIZE - (aOffset % FLASH_PAGE_DATA_SIZE);
+
+    return (aSize < left) ? aSize : left;
+}
+
+static void erasePage(uint16_t aPage, int8_t aSwapIndex, uint8_t aPosition, uint32_t aGeneration)
+{
+    FlashPageState *state = &sPages[aPage];
+    FlashPageHeader header;
+    otError         error;
+
+    state->mEraseCount++;
+
+    // The header holding the erase count is lost with the erase, keep the count until the header is rewritten.
+    sEraseRecord.mPage       = aPage;
+    sEraseRecord.mEraseCount = state->mEraseCount;
+    sEraseRecord.mMagic      = FLASH_ERASE_RECORD_MAGIC;
+
+    error = nrf5FlashPageErase(pageAddress(aPage));
+    assert(error == OT_ERROR_NONE);
+
+    state->mSwapIndex  = aSwapIndex;
+    state->mPosition   = aPosition;
+    state->mGeneration = aGeneration;
+    sErasesSinceBoot++;
+
+    memset(&header, 0xff, sizeof(header));
+    header.mMagic      = FLASH_HEADER_MAGIC;
+    header.mEraseCount = state->mEraseCount;
+
+    if (aSwapIndex >= 0)
+    {
+        header.mAssignment = (aGeneration << FLASH_GENERATION_SHIFT) | ((uint32_t)aSwapIndex << FLASH_SWAP_SHIFT) |
+                             aPosition;
+        sSwapMap[aSwapIndex][aPosition] = (uint8_t)aPage;
+    }
+
+    error = nrf5FlashWrite(pageAddress(aPage), (const uint8_t *)&header, sizeof(header));
+    assert(error == OT_ERROR_NONE);
+
+    // The erase and the header write may still be queued, the record is kept until the next erase replaces it. It is
+    // ignored for pages with a valid header.
+
+    OT_UNUSED_VARIABLE(error);
+}
+
+static uint16_t leastWornFreePage(void)
+{
+    uint16_t page = sPageCount;
+
+    for (uint16_t i = 0; i < sPageCount; i++)
+    {
+        if (sPages[i].mSwapIndex < 0 && (page == sPageCount || sPages[i].mEraseCount < sPages[page].mEraseCount))
+        {
+            page = i;
+        }
+    }
+
+    assert(page < sPageCount);
+
+    return page;
+}
+
+static void assignSwap(uint8_t aSwapIndex, uint32_t aGeneration, const bool *aPresent)
+{
+    for (uint8_t position = 0; position < PLATFORM_FLASH_WEAR_SWAP_PAGES; position++)
+    {
+        if (aPresent == NULL || !aPresent[position])
+        {
+            erasePage(leastWornFreePage(), (int8_t)aSwapIndex, position, aGeneration);
+        }
+    }
+}
+
+static void wearLevelingInit(void)
+{
+    uint32_t maxGeneration[FLASH_NUM_SWAPS] = {0, 0};
+    bool     assigned[FLASH_NUM_SWAPS]      = {false, false};
+    bool     present[FLASH_NUM_SWAPS][PLATFORM_FLASH_WEAR_SWAP_PAGES];
+    uint32_t maxEraseCount = 0;
+
+    memset(present, 0, sizeof(present));
+    sGeneration = 0;
+
+    // Recover the erase counts and the pages of each swap from the page headers.
+    for (uint16_t i = 0; i < sPageCount; i++)
+    {
+        const FlashPageHeader *header = (const FlashPageHeader *)pageAddress(i);
+        FlashPageState        *state  = &sPages[i];
+
+        state->mSwapIndex  = -1;
+        state->mEraseCount = (header->mMagic == FLASH_HEADER_MAGIC) ? header->mEraseCount : FLASH_UNASSIGNED;
+
+        if (state->mEraseCount != FLASH_UNASSIGNED && state->mEraseCount > maxEraseCount)
+        {
+            maxEraseCount = state->mEraseCount;
+        }
+
+        if (header->mMagic != FLASH_HEADER_MAGIC || header->mAssignment == FLASH_UNASSIGNED ||
+            (header->mAssignment & FLASH_POSITION_MASK) >= PLATFORM_FLASH_WEAR_SWAP_PAGES)
+        {
+            continue;
+        }
+
+        state->mSwapIndex  = (int8_t)((header->mAssignment >> FLASH_SWAP_SHIFT) & 1);
+        state->mPosition   = (uint8_t)(header->mAssignment & FLASH_POSITION_MASK);
+        state->mGeneration = header->mAssignment >> FLASH_GENERATION_SHIFT;
+
+        if (!assigned[state->mSwapIndex] || state->mGeneration > maxGeneration[state->mSwapIndex])
+        {
+            maxGeneration[state->mSwapIndex] = state->mGeneration;
+            assigned[state->mSwapIndex]      = true;
+        }
+
+        if (state->mGeneration > sGeneration)
+        {
+            sGeneration = state->mGeneration;
+        }
+    }
+
+    // A page without a header was erased when the device was reset, before its header was rewritten. Its count is
+    // kept by the erase record across a reset, after a power loss it is taken from the most worn page.
+    for (uint16_t i = 0; i < sPageCount; i++)
+    {
+        FlashPageState *state = &sPages[i];
+
+        if (state->mEraseCount != FLASH_UNASSIGNED)
+        {
+            continue;
+        }
+
+        if (sEraseRecord.mMagic == FLASH_ERASE_RECORD_MAGIC && sEraseRecord.mPage == i)
+        {
+            state->mEraseCount = sEraseRecord.mEraseCount;
+        }
+        else
+        {
+            state->mEraseCount = maxEraseCount;
+        }
+    }
+
+    sEraseRecord.mMagic = 0;
 
+    // Only the latest generation of each swap is valid, older pages are free.
+    for (uint16_t i = 0; i < sPageCount; i++)
+    {
+        FlashPageState *state = &sPages[i];
+
+        if (state->mSwapIndex < 0)
+        {
+            continue;
+        }
+
+        if (state->mGeneration != maxGeneration[state->mSwapIndex] || present[state->mSwapIndex][state->mPosition])
+        {
+            state->mSwapIndex = -1;
+            continue;
+        }
+
+        present[state->mSwapIndex][state->mPosition] = true;
+        sSwapMap[state->mSwapIndex][state->mPosition] = (uint8_t)i;
+    }
+
+    // Complete a swap whose erase was interrupted, or assign pages to a swap for the first time.
+    for (uint8_t swap = 0; swap < FLASH_NUM_SWAPS; swap++)
+    {
+        if (assigned[swap])
+        {
+            assignSwap(swap, maxGeneration[swap], present[swap]);
+        }
+        else
+        {
+            assignSwap(swap, ++sGeneration, NULL);
+        }
+    }
+}
+#else
 static inline uint32_t mapAddress(uint8_t aSwapIndex, uint32_t aOffset)
 {
     uint32_t address;
@@ -64,12 +321,19 @@ static inline uint32_t mapAddress(uint8_t aSwapIndex, uint32_t aOffset)
 
     return address;
 }
+#endif // PLATFORM_FLASH_WEAR_LEVELING_ENABLE
 
 void otPlatFlashInit(otInstance *aInstance)
 {
     OT_UNUSED_VARIABLE(aInstance);
 
-#if defined(__CC_ARM)
+#if PLATFORM_FLASH_QSPI_ENABLE
+    nrf5QspiFlashInit();
+
+    sFlashDataStart = PLATFORM_FLASH_QSPI_PARTITION_OFFSET;
+    sFlashDataEnd   = PLATFORM_FLASH_QSPI_PARTITION_OFFSET + PLATFORM_FLASH_QSPI_PARTITION_SIZE;
+
+#elif defined(__CC_ARM)
     // Temporary solution for Keil compiler.
     uint32_t const bootloaderAddr = NRF_UICR->NRFFW[0];
     uint32_t const pageSize       = NRF_FICR->CODEPAGESIZE;
@@ -95,12 +359,32 @@ void otPlatFlashInit(otInstance *aInstance)
 
 #endif
 
+#if !PLATFORM_FLASH_QSPI_ENABLE
+    // The page headers are read directly, complete the erases and writes queued before a pseudo reset.
+    nrf5FlashFlush();
+
+    // The settings area may be sized by the linker script, ensure it matches the configuration.
+    assert(sFlashDataEnd - sFlashDataStart == PLATFORM_FLASH_PAGE_NUM * FLASH_PAGE_SIZE);
+#endif
+
     // Just ensure that the start and end addresses are page-aligned.
     assert((sFlashDataStart % FLASH_PAGE_SIZE) == 0);
     assert((sFlashDataEnd % FLASH_PAGE_SIZE) == 0);
 
-    sSwapSize = ((sFlashDataEnd - sFlashDataStart) / FLASH_PAGE_SIZE / 2) * FLASH_PAGE_SIZE;
+    sPageCount       = (uint16_t)((sFlashDataEnd - sFlashDataStart) / FLASH_PAGE_SIZE);
+    sErasesSinceBoot = 0;
+
+#if PLATFORM_FLASH_WEAR_LEVELING_ENABLE
+    assert(sPageCount >= FLASH_NUM_SWAPS * PLATFORM_FLASH_WEAR_SWAP_PAGES);
+    assert(sPageCount <= PLATFORM_FLASH_WEAR_MAX_PAGES);
+
+    sSwapSize = PLATFORM_FLASH_WEAR_SWAP_PAGES * FLASH_PAGE_DATA_SIZE;
+
+    wearLevelingInit();
+#else
+    sSwapSize = (sPageCount / 2) * FLASH_PAGE_SIZE;
     assert(sSwapSize > 0);
+#endif
 }
 
 uint32_t otPlatFlashGetSwapSize(otInstance *aInstance)
@@ -116,15 +400,35 @@ void otPlatFlashErase(otInstance *aInstance, uint8_t aSwapIndex)
 
     otError error;
 
+    nrf5TraceRecord(kTraceEventFlashErase, aSwapIndex);
+    nrf5FlashSchedulerOperationStart();
+
+#if PLATFORM_FLASH_QSPI_ENABLE
+    // The swap area is erased in the background, subsequent accesses wait for the erase to complete.
+    error = nrf5QspiFlashErase(mapAddress(aSwapIndex, 0), sSwapSize);
+    assert(error == OT_ERROR_NONE);
+    sErasesSinceBoot += sSwapSize / FLASH_PAGE_SIZE;
+#elif PLATFORM_FLASH_WEAR_LEVELING_ENABLE
+    // Move the swap to the least worn free pages.
+    for (uint8_t position = 0; position < PLATFORM_FLASH_WEAR_SWAP_PAGES; position++)
+    {
+        sPages[sSwapMap[aSwapIndex][position]].mSwapIndex = -1;
+    }
+
+    assignSwap(aSwapIndex, ++sGeneration, NULL);
+
+    error = OT_ERROR_NONE;
+#else
     for (uint32_t offset = 0; offset < sSwapSize; offset += FLASH_PAGE_SIZE)
     {
         error = nrf5FlashPageErase(mapAddress(aSwapIndex, offset));
         assert(error == OT_ERROR_NONE);
 
-        while (nrf5FlashIsBusy())
-        {
-        }
+        sErasesSinceBoot++;
     }
+#endif
+
+    nrf5TraceRecord(kTraceEventFlashDone, 0);
 
     OT_UNUSED_VARIABLE(error);
 }
@@ -135,9 +439,31 @@ void otPlatFlashWrite(otInstance *aInstance, uint8_t aSwapIndex, uint32_t aOffse
 
     otError error;
 
+    nrf5TraceRecord(kTraceEventFlashWrite, (uint16_t)aSize);
+    nrf5FlashSchedulerOperationStart();
+
+#if PLATFORM_FLASH_QSPI_ENABLE
+    error = nrf5QspiFlashWrite(mapAddress(aSwapIndex, aOffset), aData, aSize);
+#elif PLATFORM_FLASH_WEAR_LEVELING_ENABLE
+    error = OT_ERROR_NONE;
+
+    while (aSize > 0 && error == OT_ERROR_NONE)
+    {
+        uint32_t size = chunkSize(aOffset, aSize);
+
+        error = nrf5FlashWrite(mapAddress(aSwapIndex, aOffset), aData, size);
+
+        aOffset += size;
+        aData = (const uint8_t *)aData + size;
+        aSize -= size;
+    }
+#else
     error = nrf5FlashWrite(mapAddress(aSwapIndex, aOffset), aData, aSize);
+#endif
     assert(error == OT_ERROR_NONE);
 
+    nrf5TraceRecord(kTraceEventFlashDone, 0);
+
     OT_UNUSED_VARIABLE(error);
 }
 
@@ -145,5 +471,73 @@ void otPlatFlashRead(otInstance *aInstance, uint8_t aSwapIndex, uint32_t aOffset
 {
     OT_UNUSED_VARIABLE(aInstance);
 
-    memcpy(aData, (uint8_t *)mapAddress(aSwapIndex, aOffset), aSize);
+#if PLATFORM_FLASH_QSPI_ENABLE
+    otError error;
+
+    error = nrf5QspiFlashRead(mapAddress(aSwapIndex, aOffset), aData, aSize);
+    assert(error == OT_ERROR_NONE);
+
+    OT_UNUSED_VARIABLE(error);
+#elif PLATFORM_FLASH_WEAR_LEVELING_ENABLE
+    while (aSize > 0)
+    {
+        uint32_t size = chunkSize(aOffset, aSize);
+
+        nrf5FlashRead(mapAddress(aSwapIndex, aOffset), aData, size);
+
+        aOffset += size;
+        aData = (uint8_t *)aData + size;
+        aSize -= size;
+    }
+#else
+    nrf5FlashRead(mapAddress(aSwapIndex, aOffset), aData, aSize);
+#endif
+}
+
+void nrf5FlashWearStatsGet(PlatformFlashWearStats *aStats)
+{
+    memset(aStats, 0, sizeof(*aStats));
+
+    aStats->mPageCount       = sPageCount;
+    aStats->mErasesSinceBoot = sErasesSinceBoot;
+
+#if PLATFORM_FLASH_WEAR_LEVELING_ENABLE
+    aStats->mTracked       = true;
+    aStats->mEraseCountMin = UINT32_MAX;
+
+    for (uint16_t i = 0; i < sPageCount; i++)
+    {
+        if (sPages[i].mEraseCount < aStats->mEraseCountMin)
+        {
+            aStats->mEraseCountMin = sPages[i].mEraseCount;
+        }
+
+        if (sPages[i].mEraseCount > aStats->mEraseCountMax)
+        {
+            aStats->mEraseCountMax = sPages[i].mEraseCount;
+        }
+
+        aStats->mEraseCountTotal += sPages[i].mEraseCount;
+    }
+#endif
+}
+
+otError nrf5FlashWearPageEraseCountGet(uint16_t aPage, uint32_t *aEraseCount)
+{
+    otError error = OT_ERROR_NONE;
+
+#if PLATFORM_FLASH_WEAR_LEVELING_ENABLE
+    otEXPECT_ACTION(aPage < sPageCount, error = OT_ERROR_INVALID_ARGS);
+
+    *aEraseCount = sPages[aPage].mEraseCount;
+
+exit:
+#else
+    OT_UNUSED_VARIABLE(aPage);
+    OT_UNUSED_VARIABLE(aEraseCount);
+
+    error = OT_ERROR_NOT_CAPABLE;
+#endif
+
+    return error;
 }
@@ -27,20 +27,330 @@
  */
 
 #include <stdint.h>
+#include <string.h>
+
+#include <openthread-system.h>
+#include <utils/code_utils.h>
+#include <openthread/platform/alarm-micro.h>
 
 #include "platform-nrf5.h"
 #include "drivers/include/nrfx_nvmc.h"
 
+#if PLATFORM_FLASH_SCHEDULER_ENABLE
+// clang-format off
+#define FLASH_PAGE_SIZE             4096
+#define FLASH_WORD_WRITE_TIME_US    41    ///< Maximum time for which programming a word halts the CPU.
+#define FLASH_PAGE_ERASE_TIME_US    87000 ///< Maximum time for which a page erase halts the CPU.
+// clang-format on
+
+#if (PLATFORM_FLASH_WRITE_CHUNK_SIZE == 0) || (PLATFORM_FLASH_WRITE_CHUNK_SIZE % 4 != 0)
+#error "PLATFORM_FLASH_WRITE_CHUNK_SIZE must be a non-zero multiple of 4"
+#endif
+
+#if (PLATFORM_FLASH_SCHEDULER_QUEUE_SIZE == 0) || (PLATFORM_FLASH_SCHEDULER_QUEUE_SIZE > UINT16_MAX)
+#error "PLATFORM_FLASH_SCHEDULER_QUEUE_SIZE must be between 1 and 65535"
+#endif
+
+#if (PLATFORM_FLASH_SCHEDULER_QUEUE_OPERATIONS == 0) || (PLATFORM_FLASH_SCHEDULER_QUEUE_OPERATIONS > UINT8_MAX)
+#error "PLATFORM_FLASH_SCHEDULER_QUEUE_OPERATIONS must be between 1 and 255"
+#endif
+
+typedef struct
+{
+    uint32_t mAddress;  ///< Address of the page to erase, or of the next byte to write.
+    uint32_t mDeadline; ///< Time [us] after which the parts of the operation no longer wait for a radio gap.
+    uint16_t mData;     ///< Offset of the next byte to write in @ref sData.
+    uint16_t mSize;     ///< Number of bytes left to write, or 0 for a page erase.
+} FlashOperation;
+
+static FlashOperation              sOperations[PLATFORM_FLASH_SCHEDULER_QUEUE_OPERATIONS];
+static uint8_t                     sData[PLATFORM_FLASH_SCHEDULER_QUEUE_SIZE];
+static uint8_t                     sHead;
+static uint8_t                     sCount;
+static uint16_t                    sDataUsed;     ///< Bytes of @ref sData taken, released once the queue is empty.
+static uint32_t                    sDeadline;     ///< Deadline of the operations queued by the current erase or write.
+static bool                        sPartWaiting;  ///< If the next part has been postponed already.
+static uint32_t                    sPartWaitStart;
+static PlatformFlashSchedulerStats sStats;
+
+#if defined(NRF_NVMC_PARTIAL_ERASE_PRESENT)
+static bool sEraseStarted;
+#endif
+
+static uint32_t chunkSize(const FlashOperation *aOperation)
+{
+    // Chunks end on word boundaries, so that no word is programmed twice.
+    uint32_t size = PLATFORM_FLASH_WRITE_CHUNK_SIZE - (aOperation->mAddress % sizeof(uint32_t));
+
+    return (size < aOperation->mSize) ? size : aOperation->mSize;
+}
+
+static uint32_t partDuration(const FlashOperation *aOperation)
+{
+    uint32_t duration;
+
+    if (aOperation->mSize == 0)
+    {
+#if defined(NRF_NVMC_PARTIAL_ERASE_PRESENT)
+        duration = PLATFORM_FLASH_PARTIAL_ERASE_DURATION_MS * 1000;
+#else
+        duration = FLASH_PAGE_ERASE_TIME_US;
+#endif
+    }
+    else
+    {
+        uint32_t alignment = aOperation->mAddress % sizeof(uint32_t);
+
+        duration = ((alignment + chunkSize(aOperation) + sizeof(uint32_t) - 1) / sizeof(uint32_t)) *
+                   FLASH_WORD_WRITE_TIME_US;
+    }
+
+    return duration;
+}
+
+/**
+ * Executes one part of the given operation.
+ *
+ * @returns  true if the operation is complete.
+ *
+ */
+static bool runPart(FlashOperation *aOperation)
+{
+    bool done = true;
+
+    if (aOperation->mSize == 0)
+    {
+#if defined(NRF_NVMC_PARTIAL_ERASE_PRESENT)
+        if (!sEraseStarted)
+        {
+            nrfx_nvmc_page_partial_erase_init(aOperation->mAddress, PLATFORM_FLASH_PARTIAL_ERASE_DURATION_MS);
+            sEraseStarted = true;
+            sStats.mPartialErases++;
+        }
+
+        nrf5WatchdogPause();
+        done = nrfx_nvmc_page_partial_erase_continue();
+        nrf5WatchdogResume();
+
+        sEraseStarted = !done;
+#else
+        nrf5WatchdogPause();
+        nrfx_nvmc_page_erase(aOperation->mAddress);
+        nrf5WatchdogResume();
+#endif
+    }
+    else
+    {
+        uint32_t size = chunkSize(aOperation);
+
+        nrfx_nvmc_bytes_write(aOperation->mAddress, &sData[aOperation->mData], size);
+
+        aOperation->mAddress += size;
+        aOperation->mData += size;
+        aOperation->mSize -= size;
+        done = (aOperation->mSize == 0);
+    }
+
+    return done;
+}
+
+/**
+ * Executes the next part of the oldest queued operation once the radio has no scheduled window within its duration,
+ * or once the operation may no longer wait.
+ *
+ * @param[in]  aWait  Wait for the gap, serving interrupts meanwhile, instead of returning when there is none.
+ *
+ */
+static void runNextPart(bool aWait)
+{
+    FlashOperation *operation = &sOperations[sHead];
+    uint32_t        duration  = partDuration(operation);
+    uint32_t        now       = otPlatAlarmMicroGetNow();
+
+    while (!nrf5RadioIsIdleFor(duration))
+    {
+        if ((int32_t)(now - operation->mDeadline) >= 0)
+        {
+            sStats.mForced++;
+            break;
+        }
+
+        if (!sPartWaiting)
+        {
+            sPartWaiting   = true;
+            sPartWaitStart = now;
+            sStats.mPostponed++;
+        }
+
+        otEXPECT(aWait);
+        now = otPlatAlarmMicroGetNow();
+    }
+
+    sStats.mOperations++;
+
+    if (sPartWaiting)
+    {
+        uint32_t delay = now - sPartWaitStart;
+
+        sPartWaiting = false;
+        sStats.mDelayTotal += delay;
+
+        if (delay > sStats.mDelayMax)
+        {
+            sStats.mDelayMax = delay;
+        }
+    }
+
+    if (runPart(operation))
+    {
+        sHead = (sHead + 1) % PLATFORM_FLASH_SCHEDULER_QUEUE_OPERATIONS;
+        sCount--;
+
+        if (sCount == 0)
+        {
+            sDataUsed = 0;
+        }
+    }
+
+exit:
+    return;
+}
+
+static FlashOperation *queueOperation(uint32_t aAddress, uint16_t aSize)
+{
+    FlashOperation *operation;
+
+    // Make room by completing the oldest operations, the data buffer is released once the queue is empty.
+    while ((sCount == PLATFORM_FLASH_SCHEDULER_QUEUE_OPERATIONS) ||
+           ((sCount > 0) && (aSize > sizeof(sData) - sDataUsed)))
+    {
+        runNextPart(true);
+    }
+
+    operation            = &sOperations[(sHead + sCount) % PLATFORM_FLASH_SCHEDULER_QUEUE_OPERATIONS];
+    operation->mAddress  = aAddress;
+    operation->mDeadline = sDeadline;
+    operation->mData     = sDataUsed;
+    operation->mSize     = aSize;
+
+    sDataUsed += aSize;
+    sCount++;
+
+    return operation;
+}
+
+static void overlay(uint32_t aAddress, uint8_t *aData, uint32_t aSize, const FlashOperation *aOperation)
+{
+    uint32_t size  = (aOperation->mSize == 0) ? FLASH_PAGE_SIZE : aOperation->mSize;
+    uint32_t start = (aOperation->mAddress > aAddress) ? aOperation->mAddress : aAddress;
+    uint32_t end   = aAddress + aSize;
+
+    if (aOperation->mAddress + size < end)
+    {
+        end = aOperation->mAddress + size;
+    }
+
+    for (uint32_t address = start; address < end; address++)
+    {
+        if (aOperation->mSize == 0)
+        {
+            aData[address - aAddress] = 0xff;
+        }
+        else
+        {
+            // Programming clears bits only, as the flash does.
+            aData[address - aAddress] &= sData[aOperation->mData + (address - aOperation->mAddress)];
+        }
+    }
+}
+
 otError nrf5FlashPageErase(uint32_t aAddress)
 {
-    nrfx_nvmc_page_erase(aAddress);
+    queueOperation(aAddress, 0);
+    otSysEventSignalPending();
 
     return OT_ERROR_NONE;
 }
 
+otError nrf5FlashWrite(uint32_t aAddress, const uint8_t *aData, uint32_t aSize)
+{
+    while (aSize > 0)
+    {
+        uint32_t        size      = (aSize < sizeof(sData)) ? aSize : sizeof(sData);
+        FlashOperation *operation = queueOperation(aAddress, (uint16_t)size);
+
+        memcpy(&sData[operation->mData], aData, size);
+
+        aAddress += size;
+        aData += size;
+        aSize -= size;
+    }
+
+    otSysEventSignalPending();
+
+    return OT_ERROR_NONE;
+}
+
+void nrf5FlashRead(uint32_t aAddress, void *aData, uint32_t aSize)
+{
+    memcpy(aData, (const void *)aAddress, aSize);
+
+    // Apply the queued operations in order, the ones not complete yet are not visible in flash.
+    for (uint8_t i = 0; i < sCount; i++)
+    {
+        overlay(aAddress, aData, aSize, &sOperations[(sHead + i) % PLATFORM_FLASH_SCHEDULER_QUEUE_OPERATIONS]);
+    }
+}
+
 bool nrf5FlashIsBusy(void)
 {
-    return NRF_NVMC->READY != NVMC_READY_READY_Ready;
+    return (sCount > 0) || (NRF_NVMC->READY != NVMC_READY_READY_Ready);
+}
+
+void nrf5FlashProcess(void)
+{
+    otEXPECT(sCount > 0);
+
+    runNextPart(false);
+
+    // Keep the main loop running until the queue is drained, so that the next part is retried soon.
+    otEXPECT(sCount > 0);
+    otSysEventSignalPending();
+
+exit:
+    return;
+}
+
+void nrf5FlashFlush(void)
+{
+    while (sCount > 0)
+    {
+        runNextPart(true);
+    }
+}
+
+void nrf5FlashSchedulerStatsGet(PlatformFlashSchedulerStats *aStats)
+{
+    *aStats = sStats;
+}
+
+void nrf5FlashSchedulerStatsReset(void)
+{
+    memset(&sStats, 0, sizeof(sStats));
+}
+
+void nrf5FlashSchedulerOperationStart(void)
+{
+    sDeadline = otPlatAlarmMicroGetNow() + PLATFORM_FLASH_SCHEDULER_MAX_DELAY_US;
+}
+#else  // PLATFORM_FLASH_SCHEDULER_ENABLE
+otError nrf5FlashPageErase(uint32_t aAddress)
+{
+    nrf5WatchdogPause();
+    nrfx_nvmc_page_erase(aAddress);
+    nrf5WatchdogResume();
+
+    return OT_ERROR_NONE;
 }
 
 otError nrf5FlashWrite(uint32_t aAddress, const uint8_t *aData, uint32_t aSize)
@@ -49,3 +359,35 @@ otError nrf5FlashWrite(uint32_t aAddress, const uint8_t *aData, uint32_t aSize)
 
     return OT_ERROR_NONE;
 }
+
+void nrf5FlashSchedulerStatsGet(PlatformFlashSchedulerStats *aStats)
+{
+    memset(aStats, 0, sizeof(*aStats));
+}
+
+void nrf5FlashSchedulerStatsReset(void)
+{
+}
+
+void nrf5FlashSchedulerOperationStart(void)
+{
+}
+
+void nrf5FlashRead(uint32_t aAddress, void *aData, uint32_t aSize)
+{
+    memcpy(aData, (const void *)aAddress, aSize);
+}
+
+bool nrf5FlashIsBusy(void)
+{
+    return NRF_NVMC->READY != NVMC_READY_READY_Ready;
+}
+
+void nrf5FlashProcess(void)
+{
+}
+
+void nrf5FlashFlush(void)
+{
+}
+#endif // PLATFORM_FLASH_SCHEDULER_ENABLE
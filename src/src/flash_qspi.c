@@ -0,0 +1,243 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the QSPI external flash backend of the flash driver.
+ *
+ */
+
+#include <openthread-core-config.h>
+#include <openthread/config.h>
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <utils/code_utils.h>
+
+#include "platform-nrf5.h"
+
+#if PLATFORM_FLASH_QSPI_ENABLE
+
+#include <nrfx_qspi.h>
+
+#define QSPI_WORD_SIZE 4
+#define QSPI_PAGE_SIZE 256
+#define QSPI_SECTOR_SIZE 0x1000
+#define QSPI_BLOCK_SIZE 0x10000
+
+static uint32_t          sBuffer[QSPI_PAGE_SIZE / sizeof(uint32_t)]; ///< EasyDMA buffer, must be word-aligned in RAM.
+static volatile bool     sBusy;
+static volatile uint32_t sEraseAddress;
+static volatile uint32_t sEraseEnd;
+
+static void startErase(void)
+{
+    nrf_qspi_erase_len_t length = NRF_QSPI_ERASE_LEN_4KB;
+    uint32_t             size   = QSPI_SECTOR_SIZE;
+    nrfx_err_t           error;
+
+    // Use block erase wherever the remaining range covers a whole block, it is much faster than erasing its sectors.
+    if (((sEraseAddress % QSPI_BLOCK_SIZE) == 0) && ((sEraseEnd - sEraseAddress) >= QSPI_BLOCK_SIZE))
+    {
+        length = NRF_QSPI_ERASE_LEN_64KB;
+        size   = QSPI_BLOCK_SIZE;
+    }
+
+    error = nrfx_qspi_erase(length, sEraseAddress);
+    assert(error == NRFX_SUCCESS);
+    OT_UNUSED_VARIABLE(error);
+
+    sEraseAddress += size;
+}
+
+static void qspiEventHandler(nrfx_qspi_evt_t aEvent, void *aContext)
+{
+    OT_UNUSED_VARIABLE(aEvent);
+    OT_UNUSED_VARIABLE(aContext);
+
+    if (sEraseAddress < sEraseEnd)
+    {
+        startErase();
+    }
+    else
+    {
+        sBusy = false;
+    }
+}
+
+static void waitForIdle(void)
+{
+    otEXPECT(sBusy);
+
+    // Erasing a partition can take seconds, during which the main loop does not feed the watchdog.
+    nrf5WatchdogPause();
+
+    while (sBusy)
+    {
+    }
+
+    nrf5WatchdogResume();
+
+exit:
+    return;
+}
+
+void nrf5QspiFlashInit(void)
+{
+    nrfx_qspi_config_t config = NRFX_QSPI_DEFAULT_CONFIG;
+    nrfx_err_t         error;
+
+    config.pins.sck_pin = PLATFORM_FLASH_QSPI_PIN_SCK;
+    config.pins.csn_pin = PLATFORM_FLASH_QSPI_PIN_CSN;
+    config.pins.io0_pin = PLATFORM_FLASH_QSPI_PIN_IO0;
+    config.pins.io1_pin = PLATFORM_FLASH_QSPI_PIN_IO1;
+    config.pins.io2_pin = PLATFORM_FLASH_QSPI_PIN_IO2;
+    config.pins.io3_pin = PLATFORM_FLASH_QSPI_PIN_IO3;
+    config.irq_priority = PLATFORM_FLASH_QSPI_IRQ_PRIORITY;
+
+    sBusy         = false;
+    sEraseAddress = 0;
+    sEraseEnd     = 0;
+
+    error = nrfx_qspi_init(&config, qspiEventHandler, NULL);
+    assert(error == NRFX_SUCCESS);
+    OT_UNUSED_VARIABLE(error);
+}
+
+bool nrf5QspiFlashIsBusy(void)
+{
+    return sBusy;
+}
+
+otError nrf5QspiFlashErase(uint32_t aAddress, uint32_t aSize)
+{
+    otError error = OT_ERROR_NONE;
+
+    otEXPECT_ACTION(((aAddress % QSPI_SECTOR_SIZE) == 0) && ((aSize % QSPI_SECTOR_SIZE) == 0),
+                    error = OT_ERROR_INVALID_ARGS);
+    otEXPECT(aSize > 0);
+
+    waitForIdle();
+
+    sEraseAddress = aAddress;
+    sEraseEnd     = aAddress + aSize;
+    sBusy         = true;
+
+    // The remaining sectors are erased from the QSPI interrupt handler.
+    startErase();
+
+exit:
+    return error;
+}
+
+otError nrf5QspiFlashWrite(uint32_t aAddress, const uint8_t *aData, uint32_t aSize)
+{
+    otError error = OT_ERROR_NONE;
+
+    while (aSize > 0)
+    {
+        // EasyDMA transfers whole words, pad the data with 0xff bytes which leave the erased memory unchanged.
+        uint32_t address = aAddress & ~(QSPI_WORD_SIZE - 1);
+        uint32_t offset  = aAddress - address;
+        uint32_t size    = QSPI_PAGE_SIZE - (address % QSPI_PAGE_SIZE) - offset;
+        uint32_t length;
+
+        if (size > aSize)
+        {
+            size = aSize;
+        }
+
+        length = (offset + size + QSPI_WORD_SIZE - 1) & ~(QSPI_WORD_SIZE - 1);
+
+        waitForIdle();
+
+        memset(sBuffer, 0xff, length);
+        memcpy((uint8_t *)sBuffer + offset, aData, size);
+
+        sBusy = true;
+
+        if (nrfx_qspi_write(sBuffer, length, address) != NRFX_SUCCESS)
+        {
+            sBusy = false;
+            error = OT_ERROR_FAILED;
+            break;
+        }
+
+        aAddress += size;
+        aData += size;
+        aSize -= size;
+    }
+
+    return error;
+}
+
+otError nrf5QspiFlashRead(uint32_t aAddress, uint8_t *aData, uint32_t aSize)
+{
+    otError error = OT_ERROR_NONE;
+
+    while (aSize > 0)
+    {
+        uint32_t address = aAddress & ~(QSPI_WORD_SIZE - 1);
+        uint32_t offset  = aAddress - address;
+        uint32_t size    = sizeof(sBuffer) - offset;
+        uint32_t length;
+
+        if (size > aSize)
+        {
+            size = aSize;
+        }
+
+        length = (offset + size + QSPI_WORD_SIZE - 1) & ~(QSPI_WORD_SIZE - 1);
+
+        waitForIdle();
+
+        sBusy = true;
+
+        if (nrfx_qspi_read(sBuffer, length, address) != NRFX_SUCCESS)
+        {
+            sBusy = false;
+            error = OT_ERROR_FAILED;
+            break;
+        }
+
+        waitForIdle();
+
+        memcpy(aData, (uint8_t *)sBuffer + offset, size);
+
+        aAddress += size;
+        aData += size;
+        aSize -= size;
+    }
+
+    return error;
+}
+
+#endif // PLATFORM_FLASH_QSPI_ENABLE
@@ -159,6 +159,8 @@ otError nrf5FlashPageErase(uint32_t aAddress)
     uint32_t retval;
     uint32_t maxRetry = FLASH_MAX_RETRY;
 
+    nrf5WatchdogPause();
+
     do
     {
         nrf_sdh_suspend();
@@ -199,6 +201,8 @@ otError nrf5FlashPageErase(uint32_t aAddress)
 
     } while (retval != NRF_SUCCESS && maxRetry--);
 
+    nrf5WatchdogResume();
+
     return nrf5SdErrorToOtError(retval);
 }
 
@@ -207,6 +211,20 @@ bool nrf5FlashIsBusy(void)
     return sState != FLASH_STATE_IDLE;
 }
 
+void nrf5FlashRead(uint32_t aAddress, void *aData, uint32_t aSize)
+{
+    memcpy(aData, (const void *)aAddress, aSize);
+}
+
+void nrf5FlashProcess(void)
+{
+    // Erases and writes complete before they return.
+}
+
+void nrf5FlashFlush(void)
+{
+}
+
 otError nrf5FlashWrite(uint32_t aAddress, const uint8_t *aData, uint32_t aSize)
 {
     otError  error     = OT_ERROR_NONE;
@@ -263,3 +281,17 @@ otError nrf5FlashWrite(uint32_t aAddress, const uint8_t *aData, uint32_t aSize)
 exit:
     return error;
 }
+
+void nrf5FlashSchedulerStatsGet(PlatformFlashSchedulerStats *aStats)
+{
+    // The SoftDevice schedules flash operations around its radio activity itself.
+    memset(aStats, 0, sizeof(*aStats));
+}
+
+void nrf5FlashSchedulerStatsReset(void)
+{
+}
+
+void nrf5FlashSchedulerOperationStart(void)
+{
+}
@@ -0,0 +1,436 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements staging of a new firmware image in a secondary flash slot.
+ *
+ */
+
+#include <openthread-core-config.h>
+#include <openthread/config.h>
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <mbedtls/sha256.h>
+#include <utils/code_utils.h>
+
+#include "platform-nrf5.h"
+
+#if IMAGE_STAGING_ENABLE
+
+#if IMAGE_STAGING_SLOT_SIZE == 0
+#error "IMAGE_STAGING_SLOT_ADDRESS and IMAGE_STAGING_SLOT_SIZE must be set to enable image staging."
+#endif
+
+// clang-format off
+#define IMAGE_STAGING_PAGE_SIZE         4096
+#define IMAGE_STAGING_RECORD_MAGIC      0x53474d49UL ///< Marks a valid progress record ("IMGS").
+#define IMAGE_STAGING_RECORD_INVALID    0UL          ///< Magic of a discarded progress record.
+#define IMAGE_STAGING_RECORD_COMPLETE   0UL          ///< Value of the completion marker of a staged image.
+#define IMAGE_STAGING_ERASED_WORD       0xffffffffUL
+#define IMAGE_STAGING_HEADER_SIZE       64
+#define IMAGE_STAGING_JOURNAL_SIZE      ((IMAGE_STAGING_PAGE_SIZE - IMAGE_STAGING_HEADER_SIZE) / sizeof(uint32_t))
+// clang-format on
+
+/**
+ * Staging progress record, kept in the last page of the slot.
+ *
+ * Every word is programmed once after the page is erased. The journal holds the offsets up to which the image has
+ * been written, appended each time a page is completed, so the staging can resume after a reset.
+ *
+ */
+typedef struct
+{
+    uint32_t mMagic;                                 ///< Equals @ref IMAGE_STAGING_RECORD_MAGIC if valid.
+    uint32_t mImageSize;                             ///< Size of the image being staged.
+    uint32_t mComplete;                              ///< Equals @ref IMAGE_STAGING_RECORD_COMPLETE once staged.
+    uint8_t  mDigest[NRF5_IMAGE_STAGING_DIGEST_SIZE]; ///< SHA-256 digest of the staged image.
+    uint8_t  mReserved[IMAGE_STAGING_HEADER_SIZE - 3 * sizeof(uint32_t) - NRF5_IMAGE_STAGING_DIGEST_SIZE];
+    uint32_t mJournal[IMAGE_STAGING_JOURNAL_SIZE]; ///< Committed write offsets.
+} ImageStagingRecord;
+
+static PlatformImageStagingState sState;
+static uint32_t                  sSlotAddress;
+static uint32_t                  sImageSize;
+static uint32_t                  sWriteOffset;     ///< Offset of the next image byte to write.
+static uint32_t                  sCommitOffset;    ///< Offset recorded in the journal, page-aligned until complete.
+static uint32_t                  sEraseOffset;     ///< Offset of the first page not erased yet.
+static uint32_t                  sHashOffset;      ///< Offset up to which the image is rehashed after a reset.
+static uint32_t                  sJournalIndex;    ///< Index of the first free journal entry.
+static uint32_t                  sEraseDeferrals;  ///< Number of page erases deferred due to radio activity.
+static mbedtls_sha256_context    sSha256;
+
+static const ImageStagingRecord *getRecord(void)
+{
+    return (const ImageStagingRecord *)(sSlotAddress + IMAGE_STAGING_SLOT_SIZE - IMAGE_STAGING_PAGE_SIZE);
+}
+
+static uint32_t getCapacity(void)
+{
+    return IMAGE_STAGING_SLOT_SIZE - IMAGE_STAGING_PAGE_SIZE;
+}
+
+static uint32_t pageFloor(uint32_t aOffset)
+{
+    return aOffset - (aOffset % IMAGE_STAGING_PAGE_SIZE);
+}
+
+static otError writeWord(const uint32_t *aAddress, uint32_t aValue)
+{
+    nrf5FlashSchedulerOperationStart();
+
+    return nrf5FlashWrite((uint32_t)aAddress, (const uint8_t *)&aValue, sizeof(aValue));
+}
+
+static bool isSlotValid(void)
+{
+    bool valid = false;
+
+    otEXPECT((IMAGE_STAGING_SLOT_ADDRESS % IMAGE_STAGING_PAGE_SIZE) == 0);
+    otEXPECT((IMAGE_STAGING_SLOT_SIZE % IMAGE_STAGING_PAGE_SIZE) == 0);
+    otEXPECT(IMAGE_STAGING_SLOT_SIZE >= 2 * IMAGE_STAGING_PAGE_SIZE);
+
+#if defined(__GNUC__) || defined(__ICCARM__)
+    {
+        extern uint32_t __etext;
+        extern uint32_t __data_start__;
+        extern uint32_t __data_end__;
+        extern uint32_t __start_ot_flash_data;
+
+        uint32_t imageEnd = (uint32_t)&__etext + ((uint32_t)&__data_end__ - (uint32_t)&__data_start__);
+
+        // The slot must lie between the running image and the settings area.
+        otEXPECT(IMAGE_STAGING_SLOT_ADDRESS >= imageEnd);
+        otEXPECT(IMAGE_STAGING_SLOT_ADDRESS + IMAGE_STAGING_SLOT_SIZE <= (uint32_t)&__start_ot_flash_data);
+    }
+#endif
+
+    valid = true;
+
+exit:
+    return valid;
+}
+
+static bool erasePage(uint32_t aAddress)
+{
+    bool erased = false;
+
+    otEXPECT(!nrf5FlashIsBusy());
+
+    // A page erase halts the CPU, do not let it overlap a scheduled radio window.
+    otEXPECT_ACTION(nrf5RadioIsIdleFor(IMAGE_STAGING_PAGE_ERASE_TIME_US), sEraseDeferrals++);
+
+    nrf5FlashSchedulerOperationStart();
+    erased = (nrf5FlashPageErase(aAddress) == OT_ERROR_NONE);
+
+exit:
+    return erased;
+}
+
+static void appendJournal(uint32_t aOffset)
+{
+    const ImageStagingRecord *record = getRecord();
+    otError                   error;
+
+    assert(sJournalIndex < IMAGE_STAGING_JOURNAL_SIZE);
+
+    error = writeWord(&record->mJournal[sJournalIndex], aOffset);
+    assert(error == OT_ERROR_NONE);
+    OT_UNUSED_VARIABLE(error);
+
+    sJournalIndex++;
+    sCommitOffset = aOffset;
+}
+
+static void processStarting(void)
+{
+    const ImageStagingRecord *record = getRecord();
+
+    otEXPECT(erasePage((uint32_t)record));
+
+    writeWord(&record->mImageSize, sImageSize);
+    writeWord(&record->mMagic, IMAGE_STAGING_RECORD_MAGIC);
+
+    sState = kImageStagingReceiving;
+
+exit:
+    return;
+}
+
+static void processResuming(void)
+{
+    uint32_t length = sCommitOffset - sHashOffset;
+
+    // Rehash the image written before the reset a page at a time, to keep the main loop responsive.
+    if (length > IMAGE_STAGING_PAGE_SIZE)
+    {
+        length = IMAGE_STAGING_PAGE_SIZE;
+    }
+
+    mbedtls_sha256_update_ret(&sSha256, (const uint8_t *)(sSlotAddress + sHashOffset), length);
+    sHashOffset += length;
+
+    if (sHashOffset == sCommitOffset)
+    {
+        sState = kImageStagingReceiving;
+    }
+}
+
+static void processReceiving(void)
+{
+    uint32_t limit = pageFloor(sWriteOffset) + IMAGE_STAGING_ERASE_AHEAD_PAGES * IMAGE_STAGING_PAGE_SIZE;
+
+    if (limit > sImageSize)
+    {
+        limit = sImageSize;
+    }
+
+    if ((sEraseOffset < limit) && erasePage(sSlotAddress + sEraseOffset))
+    {
+        sEraseOffset += IMAGE_STAGING_PAGE_SIZE;
+    }
+}
+
+void nrf5ImageStagingInit(void)
+{
+    const ImageStagingRecord *record;
+
+    sState          = kImageStagingDisabled;
+    sSlotAddress    = IMAGE_STAGING_SLOT_ADDRESS;
+    sImageSize      = 0;
+    sWriteOffset    = 0;
+    sCommitOffset   = 0;
+    sEraseOffset    = 0;
+    sHashOffset     = 0;
+    sJournalIndex   = 0;
+    sEraseDeferrals = 0;
+
+    otEXPECT(isSlotValid());
+
+    sState = kImageStagingIdle;
+    record = getRecord();
+
+    otEXPECT((record->mMagic == IMAGE_STAGING_RECORD_MAGIC) && (record->mImageSize <= getCapacity()));
+
+    sImageSize = record->mImageSize;
+
+    while ((sJournalIndex < IMAGE_STAGING_JOURNAL_SIZE) &&
+           (record->mJournal[sJournalIndex] != IMAGE_STAGING_ERASED_WORD))
+    {
+        sCommitOffset = record->mJournal[sJournalIndex];
+        sJournalIndex++;
+    }
+
+    otEXPECT_ACTION(sCommitOffset <= sImageSize, sState = kImageStagingIdle);
+
+    if (record->mComplete == IMAGE_STAGING_RECORD_COMPLETE)
+    {
+        sWriteOffset = sImageSize;
+        sEraseOffset = sImageSize;
+        sState       = kImageStagingComplete;
+    }
+    else
+    {
+        // Data past the last committed page may be partially written, so the page is erased again.
+        sWriteOffset = sCommitOffset;
+        sEraseOffset = sCommitOffset;
+
+        mbedtls_sha256_init(&sSha256);
+        mbedtls_sha256_starts_ret(&sSha256, 0);
+
+        sState = (sCommitOffset > 0) ? kImageStagingResuming : kImageStagingReceiving;
+    }
+
+exit:
+    return;
+}
+
+void nrf5ImageStagingProcess(void)
+{
+    switch (sState)
+    {
+    case kImageStagingStarting:
+        processStarting();
+        break;
+
+    case kImageStagingResuming:
+        processResuming();
+        break;
+
+    case kImageStagingReceiving:
+        processReceiving();
+        break;
+
+    default:
+        break;
+    }
+}
+
+otError nrf5ImageStagingBegin(uint32_t aImageSize)
+{
+    otError error = OT_ERROR_NONE;
+
+    otEXPECT_ACTION(sState != kImageStagingDisabled, error = OT_ERROR_NOT_CAPABLE);
+    otEXPECT_ACTION((aImageSize > 0) && (aImageSize <= getCapacity()), error = OT_ERROR_INVALID_ARGS);
+
+    nrf5ImageStagingAbort();
+
+    sImageSize    = aImageSize;
+    sWriteOffset  = 0;
+    sCommitOffset = 0;
+    sEraseOffset  = 0;
+    sJournalIndex = 0;
+
+    mbedtls_sha256_init(&sSha256);
+    mbedtls_sha256_starts_ret(&sSha256, 0);
+
+    // The progress record page is erased in background as well.
+    sState = kImageStagingStarting;
+
+exit:
+    return error;
+}
+
+otError nrf5ImageStagingWrite(uint32_t aOffset, const uint8_t *aData, uint32_t aLength)
+{
+    otError error = OT_ERROR_NONE;
+
+    otEXPECT_ACTION((sState == kImageStagingStarting) || (sState == kImageStagingResuming) ||
+                        (sState == kImageStagingReceiving),
+                    error = OT_ERROR_INVALID_STATE);
+    otEXPECT_ACTION((aOffset == sWriteOffset) && (aLength <= sImageSize - aOffset), error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION((sState == kImageStagingReceiving) && (aOffset + aLength <= sEraseOffset), error = OT_ERROR_BUSY);
+
+    nrf5FlashSchedulerOperationStart();
+    error = nrf5FlashWrite(sSlotAddress + aOffset, aData, aLength);
+    otEXPECT(error == OT_ERROR_NONE);
+
+    mbedtls_sha256_update_ret(&sSha256, aData, aLength);
+    sWriteOffset += aLength;
+
+    if (pageFloor(sWriteOffset) > sCommitOffset)
+    {
+        appendJournal(pageFloor(sWriteOffset));
+    }
+
+exit:
+    return error;
+}
+
+otError nrf5ImageStagingFinish(uint8_t *aDigest)
+{
+    const ImageStagingRecord *record = getRecord();
+    otError                   error  = OT_ERROR_NONE;
+    uint8_t                   digest[NRF5_IMAGE_STAGING_DIGEST_SIZE];
+
+    otEXPECT_ACTION((sState == kImageStagingReceiving) && (sWriteOffset == sImageSize), error = OT_ERROR_INVALID_STATE);
+
+    mbedtls_sha256_finish_ret(&sSha256, digest);
+    mbedtls_sha256_free(&sSha256);
+
+    if (sCommitOffset < sImageSize)
+    {
+        appendJournal(sImageSize);
+    }
+
+    nrf5FlashSchedulerOperationStart();
+    error = nrf5FlashWrite((uint32_t)record->mDigest, digest, sizeof(digest));
+    otEXPECT(error == OT_ERROR_NONE);
+
+    error = writeWord(&record->mComplete, IMAGE_STAGING_RECORD_COMPLETE);
+    otEXPECT(error == OT_ERROR_NONE);
+
+    sState = kImageStagingComplete;
+
+    if (aDigest != NULL)
+    {
+        memcpy(aDigest, digest, sizeof(digest));
+    }
+
+exit:
+    return error;
+}
+
+void nrf5ImageStagingAbort(void)
+{
+    const ImageStagingRecord *record = getRecord();
+    uint32_t                  magic;
+
+    otEXPECT((sState != kImageStagingDisabled) && (sState != kImageStagingIdle));
+
+    if (sState != kImageStagingComplete)
+    {
+        mbedtls_sha256_free(&sSha256);
+    }
+
+    // Discard the progress record, so the staging is not resumed after a reset.
+    nrf5FlashRead((uint32_t)&record->mMagic, &magic, sizeof(magic));
+
+    if (magic == IMAGE_STAGING_RECORD_MAGIC)
+    {
+        writeWord(&record->mMagic, IMAGE_STAGING_RECORD_INVALID);
+    }
+
+    sState = kImageStagingIdle;
+
+exit:
+    return;
+}
+
+void nrf5ImageStagingStatusGet(PlatformImageStagingStatus *aStatus)
+{
+    aStatus->mState          = sState;
+    aStatus->mImageSize      = sImageSize;
+    aStatus->mOffset         = sWriteOffset;
+    aStatus->mEraseDeferrals = sEraseDeferrals;
+
+    if (sState == kImageStagingComplete)
+    {
+        nrf5FlashRead((uint32_t)getRecord()->mDigest, aStatus->mDigest, sizeof(aStatus->mDigest));
+    }
+    else
+    {
+        memset(aStatus->mDigest, 0, sizeof(aStatus->mDigest));
+    }
+}
+
+#else // IMAGE_STAGING_ENABLE
+
+void nrf5ImageStagingInit(void)
+{
+}
+
+void nrf5ImageStagingProcess(void)
+{
+}
+
+#endif // IMAGE_STAGING_ENABLE
@@ -0,0 +1,373 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file implements the per-neighbor link quality estimator fed by the radio callbacks.
+ *
+ */
+
+#include <openthread-core-config.h>
+#include <openthread/config.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <openthread/platform/alarm-milli.h>
+
+#include "platform-nrf5.h"
+
+#include <app_util_platform.h>
+#include <utils/code_utils.h>
+
+#if RADIO_CONFIG_LINK_ESTIMATOR_ENABLE
+
+enum
+{
+    kLinkAverageShift = 3,      // Weight of a new sample in the moving averages is 1/8.
+    kLinkRssiFracBits = 4,      // Number of fractional bits of the RSSI moving average.
+    kLinkRateFull     = 0xffff, // Rate representing 100%.
+};
+
+typedef struct
+{
+    otMacAddress mAddress;        // Address of the neighbor, of type OT_MAC_ADDRESS_TYPE_NONE if the entry is free.
+    int16_t      mRssi;           // Average RSSI with kLinkRssiFracBits fractional bits.
+    uint8_t      mLqi;            // Average LQI.
+    uint16_t     mFrameErrorRate; // Average rate of frames lost to CRC errors.
+    uint16_t     mAckRate;        // Average rate of acknowledged frames.
+    uint32_t     mLastHeard;      // Time [ms] of the last frame or ACK received from the neighbor.
+    uint32_t     mLastUsed;       // Value of sUseCount when the entry was last used.
+    uint32_t     mRxFrames;       // Number of frames and ACKs received from the neighbor.
+    uint32_t     mRxCrcErrors;    // Number of CRC errors attributed to the neighbor.
+    uint32_t     mTxFrames;       // Number of frames to the neighbor that requested an ACK.
+    uint32_t     mTxAcked;        // Number of those frames that were acknowledged.
+} LinkNeighbor;
+
+static LinkNeighbor sNeighbors[RADIO_CONFIG_LINK_ESTIMATOR_NEIGHBORS];
+static uint32_t     sUseCount;
+static uint32_t     sCrcErrorTime;    // Time [ms] of the last CRC error not attributed yet.
+static uint8_t      sCrcErrorPending; // Number of CRC errors not attributed yet.
+
+static bool addressEqual(const otMacAddress *aFirst, const otMacAddress *aSecond)
+{
+    bool equal = false;
+
+    if (aFirst->mType == aSecond->mType)
+    {
+        switch (aFirst->mType)
+        {
+        case OT_MAC_ADDRESS_TYPE_SHORT:
+            equal = (aFirst->mAddress.mShortAddress == aSecond->mAddress.mShortAddress);
+            break;
+
+        case OT_MAC_ADDRESS_TYPE_EXTENDED:
+            equal = (memcmp(&aFirst->mAddress.mExtAddress, &aSecond->mAddress.mExtAddress, sizeof(otExtAddress)) == 0);
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    return equal;
+}
+
+static LinkNeighbor *neighborFind(const otMacAddress *aAddress, bool aCreate)
+{
+    LinkNeighbor *neighbor = NULL;
+    LinkNeighbor *oldest   = &sNeighbors[0];
+
+    otEXPECT(aAddress->mType == OT_MAC_ADDRESS_TYPE_EXTENDED ||
+             (aAddress->mType == OT_MAC_ADDRESS_TYPE_SHORT && aAddress->mAddress.mShortAddress != 0xffff));
+
+    for (size_t i = 0; i < sizeof(sNeighbors) / sizeof(sNeighbors[0]); i++)
+    {
+        if (addressEqual(&sNeighbors[i].mAddress, aAddress))
+        {
+            neighbor = &sNeighbors[i];
+            break;
+        }
+
+        // Free entries are reused first, then the least recently used one.
+        if (oldest->mAddress.mType != OT_MAC_ADDRESS_TYPE_NONE &&
+            (sNeighbors[i].mAddress.mType == OT_MAC_ADDRESS_TYPE_NONE ||
+             sNeighbors[i].mLastUsed < oldest->mLastUsed))
+        {
+            oldest = &sNeighbors[i];
+        }
+    }
+
+    if (neighbor == NULL && aCreate)
+    {
+        neighbor = oldest;
+        memset(neighbor, 0, sizeof(*neighbor));
+        neighbor->mAddress = *aAddress;
+        neighbor->mAckRate = kLinkRateFull;
+    }
+
+    otEXPECT(neighbor != NULL);
+    neighbor->mLastUsed = ++sUseCount;
+
+exit:
+    return neighbor;
+}
+
+static uint16_t rateUpdate(uint16_t aRate, uint16_t aSample)
+{
+    return (uint16_t)(aRate + ((int32_t)aSample - aRate) / (1 << kLinkAverageShift));
+}
+
+static int16_t rssiAverage(const LinkNeighbor *aNeighbor, int8_t aRssi)
+{
+    int16_t sample = (int16_t)(aRssi * (1 << kLinkRssiFracBits));
+
+    return (int16_t)(aNeighbor->mRssi + (sample - aNeighbor->mRssi) / (1 << kLinkAverageShift));
+}
+
+static uint8_t lqiAverage(const LinkNeighbor *aNeighbor, uint8_t aLqi)
+{
+    return (uint8_t)(aNeighbor->mLqi + (aLqi - aNeighbor->mLqi) / (1 << kLinkAverageShift));
+}
+
+static void neighborInfoGet(const LinkNeighbor *aNeighbor, PlatformLinkInfo *aInfo)
+{
+    aInfo->mAddress        = aNeighbor->mAddress;
+    aInfo->mRssi           = (int8_t)(aNeighbor->mRssi >> kLinkRssiFracBits);
+    aInfo->mLqi            = aNeighbor->mLqi;
+    aInfo->mFrameErrorRate = aNeighbor->mFrameErrorRate;
+    aInfo->mAckRate        = aNeighbor->mAckRate;
+    aInfo->mLastHeard      = aNeighbor->mLastHeard;
+    aInfo->mRxFrames       = aNeighbor->mRxFrames;
+    aInfo->mRxCrcErrors    = aNeighbor->mRxCrcErrors;
+    aInfo->mTxFrames       = aNeighbor->mTxFrames;
+    aInfo->mTxAcked        = aNeighbor->mTxAcked;
+}
+
+void nrf5LinkEstimatorReset(void)
+{
+    CRITICAL_REGION_ENTER();
+
+    memset(sNeighbors, 0, sizeof(sNeighbors));
+    sUseCount        = 0;
+    sCrcErrorPending = 0;
+
+    CRITICAL_REGION_EXIT();
+}
+
+void nrf5LinkEstimatorRxFrame(const otMacAddress *aAddress, int8_t aRssi, uint8_t aLqi)
+{
+    uint32_t      now = otPlatAlarmMilliGetNow();
+    LinkNeighbor *neighbor;
+    uint8_t       errors = 0;
+
+    CRITICAL_REGION_ENTER();
+
+    // Errors shortly before a frame are most likely failed attempts of the same frame, so they are attributed to its
+    // source. Each received frame is one error-free sample, preceded by the attributed erroneous ones.
+    if (sCrcErrorPending > 0 && now - sCrcErrorTime <= RADIO_CONFIG_LINK_ESTIMATOR_CRC_ERROR_WINDOW)
+    {
+        errors = sCrcErrorPending;
+    }
+
+    sCrcErrorPending = 0;
+
+    neighbor = neighborFind(aAddress, true);
+    otEXPECT(neighbor != NULL);
+
+    if (neighbor->mRxFrames == 0)
+    {
+        neighbor->mRssi = (int16_t)(aRssi * (1 << kLinkRssiFracBits));
+        neighbor->mLqi  = aLqi;
+    }
+    else
+    {
+        neighbor->mRssi = rssiAverage(neighbor, aRssi);
+        neighbor->mLqi  = lqiAverage(neighbor, aLqi);
+    }
+
+    for (uint8_t i = 0; i < errors; i++)
+    {
+        neighbor->mFrameErrorRate = rateUpdate(neighbor->mFrameErrorRate, kLinkRateFull);
+    }
+
+    neighbor->mFrameErrorRate = rateUpdate(neighbor->mFrameErrorRate, 0);
+    neighbor->mRxCrcErrors += errors;
+    neighbor->mRxFrames++;
+    neighbor->mLastHeard = now;
+
+exit:
+    CRITICAL_REGION_EXIT();
+}
+
+void nrf5LinkEstimatorRxCrcError(void)
+{
+    uint32_t now = otPlatAlarmMilliGetNow();
+
+    CRITICAL_REGION_ENTER();
+
+    if (sCrcErrorPending > 0 && now - sCrcErrorTime > RADIO_CONFIG_LINK_ESTIMATOR_CRC_ERROR_WINDOW)
+    {
+        sCrcErrorPending = 0;
+    }
+
+    if (sCrcErrorPending < UINT8_MAX)
+    {
+        sCrcErrorPending++;
+    }
+
+    sCrcErrorTime = now;
+
+    CRITICAL_REGION_EXIT();
+}
+
+void nrf5LinkEstimatorTxDone(const otMacAddress *aAddress, bool aAcked)
+{
+    LinkNeighbor *neighbor;
+
+    CRITICAL_REGION_ENTER();
+
+    neighbor = neighborFind(aAddress, true);
+    otEXPECT(neighbor != NULL);
+
+    neighbor->mAckRate = rateUpdate(neighbor->mAckRate, aAcked ? kLinkRateFull : 0);
+    neighbor->mTxFrames++;
+
+    if (aAcked)
+    {
+        neighbor->mTxAcked++;
+    }
+
+exit:
+    CRITICAL_REGION_EXIT();
+}
+
+void nrf5LinkEstimatorSmooth(const otMacAddress *aAddress, int8_t *aRssi, uint8_t *aLqi)
+{
+    const LinkNeighbor *neighbor;
+
+    CRITICAL_REGION_ENTER();
+
+    neighbor = neighborFind(aAddress, false);
+    otEXPECT(neighbor != NULL && neighbor->mRxFrames > 0);
+
+    *aRssi = (int8_t)(rssiAverage(neighbor, *aRssi) >> kLinkRssiFracBits);
+    *aLqi  = lqiAverage(neighbor, *aLqi);
+
+exit:
+    CRITICAL_REGION_EXIT();
+}
+
+otError nrf5LinkEstimatorGet(const otMacAddress *aAddress, PlatformLinkInfo *aInfo)
+{
+    otError       error = OT_ERROR_NONE;
+    LinkNeighbor *neighbor;
+
+    CRITICAL_REGION_ENTER();
+
+    neighbor = neighborFind(aAddress, false);
+    otEXPECT_ACTION(neighbor != NULL, error = OT_ERROR_NOT_FOUND);
+    neighborInfoGet(neighbor, aInfo);
+
+exit:
+    CRITICAL_REGION_EXIT();
+    return error;
+}
+
+otError nrf5LinkEstimatorGetByIndex(uint8_t aIndex, PlatformLinkInfo *aInfo)
+{
+    otError error = OT_ERROR_NONE;
+
+    otEXPECT_ACTION(aIndex < sizeof(sNeighbors) / sizeof(sNeighbors[0]), error = OT_ERROR_INVALID_ARGS);
+
+    CRITICAL_REGION_ENTER();
+
+    if (sNeighbors[aIndex].mAddress.mType == OT_MAC_ADDRESS_TYPE_NONE)
+    {
+        error = OT_ERROR_NOT_FOUND;
+    }
+    else
+    {
+        neighborInfoGet(&sNeighbors[aIndex], aInfo);
+    }
+
+    CRITICAL_REGION_EXIT();
+
+exit:
+    return error;
+}
+
+#else // RADIO_CONFIG_LINK_ESTIMATOR_ENABLE
+
+void nrf5LinkEstimatorReset(void)
+{
+}
+
+void nrf5LinkEstimatorRxFrame(const otMacAddress *aAddress, int8_t aRssi, uint8_t aLqi)
+{
+    OT_UNUSED_VARIABLE(aAddress);
+    OT_UNUSED_VARIABLE(aRssi);
+    OT_UNUSED_VARIABLE(aLqi);
+}
+
+void nrf5LinkEstimatorRxCrcError(void)
+{
+}
+
+void nrf5LinkEstimatorTxDone(const otMacAddress *aAddress, bool aAcked)
+{
+    OT_UNUSED_VARIABLE(aAddress);
+    OT_UNUSED_VARIABLE(aAcked);
+}
+
+void nrf5LinkEstimatorSmooth(const otMacAddress *aAddress, int8_t *aRssi, uint8_t *aLqi)
+{
+    OT_UNUSED_VARIABLE(aAddress);
+    OT_UNUSED_VARIABLE(aRssi);
+    OT_UNUSED_VARIABLE(aLqi);
+}
+
+otError nrf5LinkEstimatorGet(const otMacAddress *aAddress, PlatformLinkInfo *aInfo)
+{
+    OT_UNUSED_VARIABLE(aAddress);
+    OT_UNUSED_VARIABLE(aInfo);
+
+    return OT_ERROR_NOT_CAPABLE;
+}
+
+otError nrf5LinkEstimatorGetByIndex(uint8_t aIndex, PlatformLinkInfo *aInfo)
+{
+    OT_UNUSED_VARIABLE(aIndex);
+    OT_UNUSED_VARIABLE(aInfo);
+
+    return OT_ERROR_NOT_CAPABLE;
+}
+
+#endif // RADIO_CONFIG_LINK_ESTIMATOR_ENABLE
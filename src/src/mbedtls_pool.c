@@ -0,0 +1,273 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a fixed-block memory pool for mbedtls.
+ *
+ */
+
+#include <openthread-core-config.h>
+#include <openthread/config.h>
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <openthread/heap.h>
+
+#include <utils/code_utils.h>
+
+#include "platform-nrf5.h"
+
+#if MBEDTLS_POOL_ENABLE
+
+// clang-format off
+#define MBEDTLS_POOL_ALIGNMENT          8 ///< Alignment of every block.
+
+#define POOL_BIN_BYTES(aSize, aCount)   + ((aSize) * (aCount))
+#define POOL_BIN_ONE(aSize, aCount)     + 1
+#define POOL_BIN_INIT(aSize, aCount)    {.mStats = {.mBlockSize = (aSize), .mBlockCount = (aCount)}},
+
+#define MBEDTLS_POOL_SIZE               (0 MBEDTLS_POOL_BINS(POOL_BIN_BYTES))
+#define MBEDTLS_POOL_NUM_BINS           (0 MBEDTLS_POOL_BINS(POOL_BIN_ONE))
+// clang-format on
+
+/**
+ * Free block of the pool, linked into the free list of its size class.
+ *
+ */
+typedef struct PoolBlock
+{
+    struct PoolBlock *mNext;
+} PoolBlock;
+
+/**
+ * Size class of the pool.
+ *
+ */
+typedef struct
+{
+    PoolBlock                  *mFreeList;
+    uint8_t                    *mStart; ///< First block of the size class.
+    uint8_t                    *mEnd;   ///< End of the last block of the size class.
+    PlatformMbedtlsPoolBinStats mStats;
+} PoolBin;
+
+static uint64_t sArena[(MBEDTLS_POOL_SIZE + sizeof(uint64_t) - 1) / sizeof(uint64_t)];
+static PoolBin  sBins[MBEDTLS_POOL_NUM_BINS] = {MBEDTLS_POOL_BINS(POOL_BIN_INIT)};
+
+static PlatformMbedtlsPoolStats sStats;
+
+static void *binAlloc(PoolBin *aBin)
+{
+    PoolBlock *block = aBin->mFreeList;
+
+    otEXPECT(block != NULL);
+
+    aBin->mFreeList = block->mNext;
+    aBin->mStats.mInUse++;
+    aBin->mStats.mAllocs++;
+
+    if (aBin->mStats.mInUse > aBin->mStats.mPeak)
+    {
+        aBin->mStats.mPeak = aBin->mStats.mInUse;
+    }
+
+exit:
+    return block;
+}
+
+static PoolBin *findBin(const void *aPointer)
+{
+    const uint8_t *pointer = (const uint8_t *)aPointer;
+    PoolBin       *bin     = NULL;
+
+    otEXPECT(pointer >= (const uint8_t *)sArena && pointer < (const uint8_t *)sArena + MBEDTLS_POOL_SIZE);
+
+    // The number of size classes is a small constant, so the lookup takes constant time.
+    for (uint8_t i = 0; i < MBEDTLS_POOL_NUM_BINS; i++)
+    {
+        if (pointer < sBins[i].mEnd)
+        {
+            bin = &sBins[i];
+            break;
+        }
+    }
+
+    assert(bin != NULL && ((uint32_t)(pointer - bin->mStart) % bin->mStats.mBlockSize) == 0);
+
+exit:
+    return bin;
+}
+
+void nrf5MbedtlsPoolInit(void)
+{
+    uint8_t *block = (uint8_t *)sArena;
+
+    for (uint8_t i = 0; i < MBEDTLS_POOL_NUM_BINS; i++)
+    {
+        PoolBin *bin = &sBins[i];
+
+        assert((bin->mStats.mBlockSize % MBEDTLS_POOL_ALIGNMENT) == 0);
+        assert(i == 0 || bin->mStats.mBlockSize > sBins[i - 1].mStats.mBlockSize);
+
+        bin->mFreeList = NULL;
+        bin->mStart    = block;
+        bin->mEnd      = block + bin->mStats.mBlockSize * bin->mStats.mBlockCount;
+
+        // Link the blocks in address order.
+        for (block = bin->mEnd; block != bin->mStart;)
+        {
+            block -= bin->mStats.mBlockSize;
+
+            ((PoolBlock *)block)->mNext = bin->mFreeList;
+            bin->mFreeList              = (PoolBlock *)block;
+        }
+
+        block                 = bin->mEnd;
+        bin->mStats.mInUse    = 0;
+        bin->mStats.mPeak     = 0;
+        bin->mStats.mAllocs   = 0;
+        bin->mStats.mFailures = 0;
+    }
+
+    memset(&sStats, 0, sizeof(sStats));
+}
+
+void *nrf5MbedtlsPoolCAlloc(size_t aCount, size_t aSize)
+{
+    void  *pointer = NULL;
+    size_t size    = aCount * aSize;
+    bool   fitting = false;
+
+    otEXPECT(size != 0 && size / aCount == aSize);
+
+    for (uint8_t i = 0; i < MBEDTLS_POOL_NUM_BINS && pointer == NULL; i++)
+    {
+        if (sBins[i].mStats.mBlockSize < size)
+        {
+            continue;
+        }
+
+        pointer = binAlloc(&sBins[i]);
+
+        // Only the smallest fitting size class accounts for the failure, larger ones are a fallback.
+        if (pointer == NULL && !fitting)
+        {
+            sBins[i].mStats.mFailures++;
+        }
+
+        fitting = true;
+    }
+
+#if MBEDTLS_POOL_HEAP_FALLBACK
+    if (pointer == NULL)
+    {
+        pointer = otHeapCAlloc(aCount, aSize);
+
+        if (pointer != NULL)
+        {
+            sStats.mHeapFallbacks++;
+        }
+    }
+#endif
+
+    otEXPECT_ACTION(pointer != NULL, sStats.mFailures++);
+
+    memset(pointer, 0, size);
+
+exit:
+    return pointer;
+}
+
+void nrf5MbedtlsPoolFree(void *aPointer)
+{
+    PoolBin *bin;
+
+    otEXPECT(aPointer != NULL);
+
+    bin = findBin(aPointer);
+
+    if (bin != NULL)
+    {
+        assert(bin->mStats.mInUse > 0);
+
+        ((PoolBlock *)aPointer)->mNext = bin->mFreeList;
+        bin->mFreeList                 = (PoolBlock *)aPointer;
+        bin->mStats.mInUse--;
+    }
+    else
+    {
+#if MBEDTLS_POOL_HEAP_FALLBACK
+        otHeapFree(aPointer);
+#else
+        assert(false);
+#endif
+    }
+
+exit:
+    return;
+}
+
+uint8_t nrf5MbedtlsPoolBinCount(void)
+{
+    return MBEDTLS_POOL_NUM_BINS;
+}
+
+otError nrf5MbedtlsPoolBinStatsGet(uint8_t aBin, PlatformMbedtlsPoolBinStats *aStats)
+{
+    otError error = OT_ERROR_NONE;
+
+    otEXPECT_ACTION(aBin < MBEDTLS_POOL_NUM_BINS, error = OT_ERROR_INVALID_ARGS);
+
+    *aStats = sBins[aBin].mStats;
+
+exit:
+    return error;
+}
+
+void nrf5MbedtlsPoolStatsGet(PlatformMbedtlsPoolStats *aStats)
+{
+    *aStats = sStats;
+}
+
+void nrf5MbedtlsPoolStatsReset(void)
+{
+    for (uint8_t i = 0; i < MBEDTLS_POOL_NUM_BINS; i++)
+    {
+        sBins[i].mStats.mPeak     = sBins[i].mStats.mInUse;
+        sBins[i].mStats.mAllocs   = 0;
+        sBins[i].mStats.mFailures = 0;
+    }
+
+    memset(&sStats, 0, sizeof(sStats));
+}
+
+#endif // MBEDTLS_POOL_ENABLE
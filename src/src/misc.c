@@ -28,8 +28,11 @@
 
 #include <openthread-core-config.h>
 #include <openthread/config.h>
+#include <openthread/platform/logging.h>
 #include <openthread/platform/misc.h>
 
+#include <utils/code_utils.h>
+
 #include <nrf.h>
 
 #include "platform-nrf5-transport.h"
@@ -40,6 +43,7 @@
 #endif // SOFTDEVICE_PRESENT
 
 static uint32_t sResetReason;
+static bool     sBootloaderEntryFailed;
 
 bool gPlatformPseudoResetWasRequested;
 
@@ -55,6 +59,47 @@ __WEAK void nrf5CryptoDeinit(void)
 }
 #endif
 
+static uint32_t gpregretGet(void)
+{
+    uint32_t value = 0;
+
+#if SOFTDEVICE_PRESENT
+    (void)sd_power_gpregret_get(0, &value);
+#else
+    value = NRF_POWER->GPREGRET;
+#endif // SOFTDEVICE_PRESENT
+
+    return value;
+}
+
+static void gpregretSet(uint32_t aValue)
+{
+#if SOFTDEVICE_PRESENT
+    (void)sd_power_gpregret_clr(0, 0xFFFFFFFF);
+    (void)sd_power_gpregret_set(0, aValue);
+#else
+    NRF_POWER->GPREGRET = aValue;
+#endif // SOFTDEVICE_PRESENT
+}
+
+static bool isBootloaderPresent(void)
+{
+    uint32_t const bootloaderAddr = NRF_UICR->NRFFW[0];
+    uint32_t const flashSize      = NRF_FICR->CODEPAGESIZE * NRF_FICR->CODESIZE;
+    uint32_t const ramEnd         = 0x20000000 + NRF_FICR->INFO.RAM * 1024;
+    bool           present        = false;
+    uint32_t       stackPointer;
+
+    otEXPECT(bootloaderAddr < flashSize);
+
+    // The bootloader vector table starts with an initial stack pointer within RAM.
+    stackPointer = *(const uint32_t *)bootloaderAddr;
+    present      = (stackPointer > 0x20000000) && (stackPointer <= ramEnd);
+
+exit:
+    return present;
+}
+
 void nrf5MiscInit(void)
 {
 #if SOFTDEVICE_PRESENT
@@ -64,6 +109,15 @@ void nrf5MiscInit(void)
     sResetReason         = NRF_POWER->RESETREAS;
     NRF_POWER->RESETREAS = 0xFFFFFFFF;
 #endif // SOFTDEVICE_PRESENT
+
+    // The bootloader clears the request when it takes over, so a request still pending means it was not honored.
+    sBootloaderEntryFailed = (gpregretGet() == PLATFORM_BOOTLOADER_GPREGRET_VALUE);
+
+    if (sBootloaderEntryFailed)
+    {
+        gpregretSet(0);
+        otPlatLog(OT_LOG_LEVEL_WARN, OT_LOG_REGION_PLATFORM, "Bootloader did not take over the requested reset");
+    }
 }
 
 void nrf5MiscDeinit(void)
@@ -83,17 +137,71 @@ void otPlatReset(otInstance *aInstance)
     }
     else
     {
+        nrf5FlashFlush();
         NVIC_SystemReset();
     }
 }
 
+otError nrf5BootloaderEnter(void)
+{
+    otError error = OT_ERROR_NONE;
+
+    otEXPECT_ACTION(isBootloaderPresent(), error = OT_ERROR_NOT_CAPABLE);
+
+    gpregretSet(PLATFORM_BOOTLOADER_GPREGRET_VALUE);
+
+    if (gpregretGet() != PLATFORM_BOOTLOADER_GPREGRET_VALUE)
+    {
+        gpregretSet(0);
+        error = OT_ERROR_FAILED;
+    }
+    else
+    {
+        // A pseudo reset would keep the application running, so the bootloader request always takes a system reset.
+        nrf5FlashFlush();
+        __disable_irq();
+        __DSB();
+        NVIC_SystemReset();
+    }
+
+exit:
+    return error;
+}
+
+bool nrf5BootloaderEntryFailed(void)
+{
+    return sBootloaderEntryFailed;
+}
+
+#if OPENTHREAD_CONFIG_PLATFORM_BOOTLOADER_MODE_ENABLE
+otError otPlatResetToBootloader(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    return nrf5BootloaderEnter();
+}
+#endif // OPENTHREAD_CONFIG_PLATFORM_BOOTLOADER_MODE_ENABLE
+
 otPlatResetReason otPlatGetResetReason(otInstance *aInstance)
 {
     OT_UNUSED_VARIABLE(aInstance);
 
     otPlatResetReason reason;
 
-    if (sResetReason & POWER_RESETREAS_RESETPIN_Msk)
+    // A failed check is only recorded while waiting for the watchdog, which may be overtaken by another reset.
+    if ((sResetReason & POWER_RESETREAS_DOG_Msk) && (nrf5WatchdogLastFailedCheckGet() != kWatchdogCheckNone))
+    {
+        reason = OT_PLAT_RESET_REASON_WATCHDOG;
+    }
+    else if (nrf5CrashLastReasonGet() == kCrashReasonAssert)
+    {
+        reason = OT_PLAT_RESET_REASON_ASSERT;
+    }
+    else if (nrf5CrashLastReasonGet() != kCrashReasonNone)
+    {
+        reason = OT_PLAT_RESET_REASON_CRASH;
+    }
+    else if (sResetReason & POWER_RESETREAS_RESETPIN_Msk)
     {
         reason = OT_PLAT_RESET_REASON_EXTERNAL;
     }
@@ -130,5 +238,5 @@ otPlatResetReason otPlatGetResetReason(otInstance *aInstance)
 
 void otPlatWakeHost(void)
 {
-    // TODO: implement an operation to wake the host from sleep state.
+    nrf5TransportWakeHost();
 }
@@ -0,0 +1,139 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the NCP vendor hook exposing the platform crash dump to the host.
+ *
+ */
+
+#include "ncp_base.hpp"
+
+extern "C" {
+#include "platform-trace.h"
+
+/*
+ * Declared in platform-nrf5.h, which depends on the nRF5 SDK include paths not available to the NCP library.
+ */
+const uint8_t *nrf5CrashDumpRawGet(uint16_t *aLength);
+void           nrf5CrashDumpClear(void);
+}
+
+namespace ot {
+namespace Ncp {
+
+enum
+{
+    /**
+     * Raw `PlatformCrashDump` retained across the reset that followed the last crash, or empty if there is none.
+     * Setting the property (to any value) clears the crash dump.
+     *
+     * Data per item is: `D`: Crash dump
+     *
+     */
+    SPINEL_PROP_VENDOR_NRF5_CRASH_DUMP = SPINEL_PROP_VENDOR__BEGIN + 0,
+
+    /**
+     * Oldest entries of the platform trace, removed from the trace by the read. Each entry is a little-endian
+     * `PlatformTraceEntry`, as decoded by `script/trace-decode`.
+     *
+     * Data per item is: `D`: Trace entries
+     *
+     */
+    SPINEL_PROP_VENDOR_NRF5_TRACE = SPINEL_PROP_VENDOR__BEGIN + 1,
+};
+
+enum
+{
+    kTraceEntriesPerRead = 32, ///< Trace entries read at once, bounded by the Spinel frame size.
+};
+
+otError NcpBase::VendorCommandHandler(uint8_t aHeader, unsigned int aCommand)
+{
+    OT_UNUSED_VARIABLE(aCommand);
+
+    return PrepareLastStatusResponse(aHeader, SPINEL_STATUS_INVALID_COMMAND);
+}
+
+void NcpBase::VendorHandleFrameRemovedFromNcpBuffer(Spinel::Buffer::FrameTag aFrameTag)
+{
+    OT_UNUSED_VARIABLE(aFrameTag);
+}
+
+otError NcpBase::VendorGetPropertyHandler(spinel_prop_key_t aPropKey)
+{
+    otError error = OT_ERROR_NONE;
+
+    switch (aPropKey)
+    {
+    case SPINEL_PROP_VENDOR_NRF5_CRASH_DUMP:
+    {
+        uint16_t       length;
+        const uint8_t *dump = nrf5CrashDumpRawGet(&length);
+
+        error = mEncoder.WriteData(dump, length);
+        break;
+    }
+
+    case SPINEL_PROP_VENDOR_NRF5_TRACE:
+    {
+        PlatformTraceEntry entries[kTraceEntriesPerRead];
+        uint16_t           count = nrf5TraceRead(entries, kTraceEntriesPerRead);
+
+        error = mEncoder.WriteData(reinterpret_cast<const uint8_t *>(entries), count * sizeof(entries[0]));
+        break;
+    }
+
+    default:
+        error = OT_ERROR_NOT_FOUND;
+        break;
+    }
+
+    return error;
+}
+
+otError NcpBase::VendorSetPropertyHandler(spinel_prop_key_t aPropKey)
+{
+    otError error = OT_ERROR_NONE;
+
+    switch (aPropKey)
+    {
+    case SPINEL_PROP_VENDOR_NRF5_CRASH_DUMP:
+        nrf5CrashDumpClear();
+        break;
+
+    default:
+        error = OT_ERROR_NOT_FOUND;
+        break;
+    }
+
+    return error;
+}
+
+} // namespace Ncp
+} // namespace ot
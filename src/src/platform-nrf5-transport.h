@@ -36,6 +36,7 @@
 #define PLATFORM_NRF5_TRANSPORT_H_
 
 #include <stdbool.h>
+#include <stdint.h>
 
 #include "transport-config.h"
 
@@ -63,4 +64,30 @@ void nrf5TransportProcess(void);
  */
 bool nrf5TransportPseudoResetRequired(void);
 
+/**
+ * Host wake statistics.
+ *
+ */
+typedef struct
+{
+    uint32_t mWakeCount;    ///< Number of times the host wake pin was asserted.
+    uint32_t mReadyCount;   ///< Number of wake-ups the host confirmed before the timeout.
+    uint32_t mTimeoutCount; ///< Number of wake-ups that timed out.
+    uint32_t mLatencyMinUs; ///< Minimum wake latency in microseconds.
+    uint32_t mLatencyMaxUs; ///< Maximum wake latency in microseconds.
+    uint32_t mLatencyAvgUs; ///< Average wake latency in microseconds.
+} PlatformHostWakeStats;
+
+/**
+ * This function wakes the host. Transmissions to the host are held until it is ready.
+ *
+ */
+void nrf5TransportWakeHost(void);
+
+/**
+ * This function gets the host wake statistics.
+ *
+ */
+void nrf5TransportHostWakeStatsGet(PlatformHostWakeStats *aStats);
+
 #endif
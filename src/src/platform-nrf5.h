@@ -35,11 +35,15 @@
 #ifndef PLATFORM_NRF5_H_
 #define PLATFORM_NRF5_H_
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #include <openthread/instance.h>
+#include <openthread/platform/radio.h>
 
 #include "platform-config.h"
+#include "platform-trace.h"
 
 void nrf5AlarmInit(void);
 
@@ -67,6 +71,23 @@ uint64_t nrf5AlarmGetCurrentTime(void);
  */
 uint64_t nrf5AlarmGetRawCounter(void);
 
+/**
+ * Function for getting the time in microseconds until the earliest scheduled alarm, including the radio driver timer.
+ *
+ * @returns  Time until the next alarm, 0 if an alarm is due, or UINT64_MAX if no alarm is scheduled.
+ *
+ */
+uint64_t nrf5AlarmGetNextDeadline(void);
+
+/**
+ * Function for getting the time in microseconds until the earliest alarm scheduled by the OpenThread stack, excluding
+ * the radio driver timer.
+ *
+ * @returns  Time until the next alarm, 0 if an alarm is due, or UINT64_MAX if no alarm is scheduled.
+ *
+ */
+uint64_t nrf5AlarmGetNextStackDeadline(void);
+
 /**
  * Initialization of Random Number Generator.
  *
@@ -103,6 +124,27 @@ void nrf5MiscInit(void);
  */
 void nrf5MiscDeinit(void);
 
+/**
+ * Reset into the DFU bootloader.
+ *
+ * The function leaves a request for the bootloader in the retained GPREGRET register, reads it back and performs a
+ * system reset. It only returns on failure.
+ *
+ * @retval OT_ERROR_NOT_CAPABLE  No bootloader is installed.
+ * @retval OT_ERROR_FAILED       The bootloader request could not be stored.
+ *
+ */
+otError nrf5BootloaderEnter(void);
+
+/**
+ * Check whether the bootloader ignored the request of the last reset into it.
+ *
+ * @retval TRUE   The device rebooted into the application with the bootloader request still pending.
+ * @retval FALSE  No bootloader request was pending at boot.
+ *
+ */
+bool nrf5BootloaderEntryFailed(void);
+
 /**
  * Initialization of Radio driver.
  *
@@ -128,74 +170,1112 @@ void nrf5RadioProcess(otInstance *aInstance);
 void nrf5RadioClearPendingEvents(void);
 
 /**
- * Initialization of hardware crypto engine.
+ * Function for checking if the radio has no operation in progress and no scheduled reception or transmission window
+ * (delayed operation or CSL sample) within the given time.
+ *
+ * @param[in]  aDuration  Time [us] counted from now.
  *
  */
-void nrf5CryptoInit(void);
+bool nrf5RadioIsIdleFor(uint32_t aDuration);
 
 /**
- * Deinitialization of hardware crypto engine.
+ * This structure represents statistics of the per-neighbor transmit power control.
  *
  */
-void nrf5CryptoDeinit(void);
+typedef struct
+{
+    uint32_t mUpdates;        ///< Number of RSSI samples taken from received frames and ACKs.
+    uint32_t mDecreases;      ///< Number of transmit power decreases for a neighbor.
+    uint32_t mIncreases;      ///< Number of transmit power increases for a neighbor due to a weaker link.
+    uint32_t mNoAckRestores;  ///< Number of times the full power was restored after a missing ACK.
+    uint32_t mReducedFrames;  ///< Number of frames transmitted with a reduced power.
+    uint32_t mFullFrames;     ///< Number of frames transmitted with the power set for the channel.
+    uint32_t mReductionTotal; ///< Sum of the power reductions [dB] of all frames transmitted with a reduced power.
+} PlatformRadioTpcStats;
 
 /**
- * Function for erasing page in flash.
+ * This structure represents the transmit power control state of a neighbor.
  *
  */
-otError nrf5FlashPageErase(uint32_t aAddress);
+typedef struct
+{
+    otMacAddress mAddress; ///< Address of the neighbor.
+    int8_t       mRssi;    ///< Average RSSI [dBm] of frames received from the neighbor.
+    uint8_t      mLqi;     ///< Average LQI of frames received from the neighbor.
+    int8_t       mTxPower; ///< Transmit power [dBm] used for frames to the neighbor.
+} PlatformRadioTpcNeighbor;
 
 /**
- * Function for checking state of flash driver.
+ * Function for getting statistics of the transmit power control.
  *
  */
-bool nrf5FlashIsBusy(void);
+void nrf5RadioTpcStatsGet(PlatformRadioTpcStats *aStats);
 
 /**
- * Function for writing data into flash.
+ * Function for resetting statistics and forgetting the neighbors of the transmit power control.
  *
  */
-otError nrf5FlashWrite(uint32_t aAddress, const uint8_t *aData, uint32_t aSize);
+void nrf5RadioTpcReset(void);
 
 /**
- * Initialization of temperature controller.
+ * Function for getting the transmit power control state of a neighbor.
+ *
+ * @param[in]   aIndex     Index of the neighbor entry.
+ * @param[out]  aNeighbor  State of the neighbor.
+ *
+ * @retval OT_ERROR_NONE          Successfully retrieved.
+ * @retval OT_ERROR_NOT_FOUND     The entry is not used.
+ * @retval OT_ERROR_INVALID_ARGS  The index is out of range.
  *
  */
-void nrf5TempInit(void);
+otError nrf5RadioTpcNeighborGet(uint8_t aIndex, PlatformRadioTpcNeighbor *aNeighbor);
 
 /**
- * Deinitialization of temperature controller.
+ * This structure represents CCA statistics and the noise floor of a channel.
  *
  */
-void nrf5TempDeinit(void);
+typedef struct
+{
+    uint32_t mBusy;       ///< Number of transmissions that failed because CCA reported a busy channel.
+    uint32_t mIdle;       ///< Number of transmissions started after CCA reported an idle channel.
+    int8_t   mNoiseFloor; ///< Tracked noise floor [dBm], OT_RADIO_RSSI_INVALID if not known.
+    int8_t   mThreshold;  ///< Adaptive CCA threshold [dBm], OT_RADIO_RSSI_INVALID if not used.
+} PlatformRadioCcaChannelStats;
 
 /**
- * Function for processing temperature controller.
+ * Function for getting CCA statistics and the noise floor of a channel.
+ *
+ * @param[in]   aChannel  Channel number.
+ * @param[out]  aStats    Statistics of the channel.
+ *
+ * @retval OT_ERROR_NONE          Successfully retrieved.
+ * @retval OT_ERROR_INVALID_ARGS  The channel is out of range.
  *
  */
-void nrf5TempProcess(void);
+otError nrf5RadioCcaChannelStatsGet(uint8_t aChannel, PlatformRadioCcaChannelStats *aStats);
 
 /**
- * Function for measuring internal temperature.
+ * Function for resetting CCA statistics and the tracked noise floor of all channels.
  *
- * @return Temperature value measured.
+ */
+void nrf5RadioCcaStatsReset(void);
+
+/**
+ * Function for setting the CCA ED threshold in radio driver units.
+ *
+ * The threshold replaces the one set with otPlatRadioSetCcaEnergyDetectThreshold(), and is used on channels without
+ * an adaptive CCA threshold.
+ *
+ * @param[in]  aEdThreshold  ED threshold in radio driver units.
  *
  */
-int32_t nrf5TempGet(void);
+void nrf5RadioCcaEdThresholdSet(uint8_t aEdThreshold);
 
-#if SOFTDEVICE_PRESENT
 /**
- * Function for translating SoftDevice error into OpenThread's one.
+ * Function for enabling or disabling the adaptive CCA threshold.
+ *
+ * When disabled, the threshold set with otPlatRadioSetCcaEnergyDetectThreshold() is restored.
+ *
+ * @param[in]  aEnable  Whether the adaptive CCA threshold is enabled.
+ *
+ * @retval OT_ERROR_NONE         Successfully changed.
+ * @retval OT_ERROR_NOT_CAPABLE  RADIO_CONFIG_CCA_ADAPTIVE_ENABLE is not set.
  *
  */
-otError nrf5SdErrorToOtError(uint32_t aSdError);
+otError nrf5RadioCcaAdaptiveSet(bool aEnable);
 
 /**
- * Function for processing SoftDevice SoC events in flash module.
+ * Function for checking whether the adaptive CCA threshold is enabled.
  *
  */
-void nrf5SdSocFlashProcess(uint32_t aEvtId);
-#endif // SOFTDEVICE_PRESENT
+bool nrf5RadioCcaAdaptiveIsEnabled(void);
+
+/**
+ * This structure represents the link estimate of a neighbor.
+ *
+ */
+typedef struct
+{
+    otMacAddress mAddress;        ///< Address of the neighbor.
+    int8_t       mRssi;           ///< Moving average of RSSI [dBm] of frames and ACKs received from the neighbor.
+    uint8_t      mLqi;            ///< Moving average of LQI of frames and ACKs received from the neighbor.
+    uint16_t     mFrameErrorRate; ///< Estimated rate of frames from the neighbor lost to CRC errors, 0xffff for 100%.
+    uint16_t     mAckRate;        ///< Rate of frames to the neighbor that were acknowledged, 0xffff for 100%.
+    uint32_t     mLastHeard;      ///< Time [ms] when a frame or an ACK was last received from the neighbor.
+    uint32_t     mRxFrames;       ///< Number of frames and ACKs received from the neighbor.
+    uint32_t     mRxCrcErrors;    ///< Number of CRC errors attributed to the neighbor.
+    uint32_t     mTxFrames;       ///< Number of frames to the neighbor that requested an ACK.
+    uint32_t     mTxAcked;        ///< Number of frames to the neighbor that were acknowledged.
+} PlatformLinkInfo;
+
+/**
+ * Function for forgetting all neighbors of the link estimator.
+ *
+ */
+void nrf5LinkEstimatorReset(void);
+
+/**
+ * Function for updating the link estimate of a neighbor with a frame or an ACK received from it.
+ *
+ * @param[in]  aAddress  Source address of the frame.
+ * @param[in]  aRssi     RSSI [dBm] of the frame.
+ * @param[in]  aLqi      LQI of the frame.
+ *
+ */
+void nrf5LinkEstimatorRxFrame(const otMacAddress *aAddress, int8_t aRssi, uint8_t aLqi);
+
+/**
+ * Function for noting a frame received with a CRC error.
+ *
+ * The error is attributed to the neighbor from which a frame is received next within
+ * RADIO_CONFIG_LINK_ESTIMATOR_CRC_ERROR_WINDOW.
+ *
+ */
+void nrf5LinkEstimatorRxCrcError(void);
+
+/**
+ * Function for updating the link estimate of a neighbor with the result of a transmission requesting an ACK.
+ *
+ * @param[in]  aAddress  Destination address of the frame.
+ * @param[in]  aAcked    Whether the frame was acknowledged.
+ *
+ */
+void nrf5LinkEstimatorTxDone(const otMacAddress *aAddress, bool aAcked);
+
+/**
+ * Function for replacing RSSI and LQI of a frame with their moving averages including the frame.
+ *
+ * The link estimate is not updated. The values are left unchanged if the neighbor is not tracked.
+ *
+ * @param[in]     aAddress  Source address of the frame.
+ * @param[inout]  aRssi     RSSI [dBm] of the frame.
+ * @param[inout]  aLqi      LQI of the frame.
+ *
+ */
+void nrf5LinkEstimatorSmooth(const otMacAddress *aAddress, int8_t *aRssi, uint8_t *aLqi);
+
+/**
+ * Function for getting the link estimate of a neighbor.
+ *
+ * @param[in]   aAddress  Address of the neighbor.
+ * @param[out]  aInfo     Link estimate of the neighbor.
+ *
+ * @retval OT_ERROR_NONE         Successfully retrieved.
+ * @retval OT_ERROR_NOT_FOUND    The neighbor is not tracked.
+ * @retval OT_ERROR_NOT_CAPABLE  RADIO_CONFIG_LINK_ESTIMATOR_ENABLE is not set.
+ *
+ */
+otError nrf5LinkEstimatorGet(const otMacAddress *aAddress, PlatformLinkInfo *aInfo);
+
+/**
+ * Function for getting the link estimate of a neighbor by the index of its entry.
+ *
+ * @param[in]   aIndex  Index of the neighbor entry.
+ * @param[out]  aInfo   Link estimate of the neighbor.
+ *
+ * @retval OT_ERROR_NONE          Successfully retrieved.
+ * @retval OT_ERROR_NOT_FOUND     The entry is not used.
+ * @retval OT_ERROR_INVALID_ARGS  The index is out of range.
+ * @retval OT_ERROR_NOT_CAPABLE   RADIO_CONFIG_LINK_ESTIMATOR_ENABLE is not set.
+ *
+ */
+otError nrf5LinkEstimatorGetByIndex(uint8_t aIndex, PlatformLinkInfo *aInfo);
+
+/**
+ * This structure represents the number of frames queued for a child, shared with the radio interrupt.
+ *
+ */
+typedef struct
+{
+    otMacAddress      mAddress; ///< Address of the child, entries of type OT_MAC_ADDRESS_TYPE_NONE are skipped.
+    volatile uint16_t mFrames;  ///< Number of frames queued for the child.
+} PlatformRadioPendingQueue;
+
+/**
+ * This structure represents the statistics of the pending bit decisions.
+ *
+ */
+typedef struct
+{
+    uint32_t mDecisions;     ///< ACKs whose pending bit was decided from the queued frame counts.
+    uint32_t mFallbacks;     ///< ACKs to sources not in the queue table, decided by the source match tables.
+    uint32_t mFalsePending;  ///< Decisions where the source match tables would have set the bit, no frame queued.
+    uint32_t mMissedPending; ///< Decisions where the source match tables would have cleared the bit, frames queued.
+} PlatformRadioPendingStats;
+
+/**
+ * Function for registering the table of frames queued for the children.
+ *
+ * With NRF_802154_ACK_DATA_PENDING_BIT_HOOK_ENABLED, the pending bit of an ACK to a child in the table is set if and
+ * only if frames are queued for it, regardless of the source match tables. The table stays owned by the caller and
+ * is read from the radio interrupt. `mFrames` may be updated at any time, `mAddress` only while its type is
+ * OT_MAC_ADDRESS_TYPE_NONE or the table is not registered.
+ *
+ * @param[in]  aQueues  Pointer to the table, NULL to decide all pending bits by the source match tables.
+ * @param[in]  aLength  Number of entries in the table.
+ *
+ * @retval OT_ERROR_NONE         Successfully registered.
+ * @retval OT_ERROR_NOT_CAPABLE  NRF_802154_ACK_DATA_PENDING_BIT_HOOK_ENABLED is not set.
+ *
+ */
+otError nrf5RadioPendingQueuesSet(PlatformRadioPendingQueue *aQueues, uint16_t aLength);
+
+/**
+ * Function for getting the statistics of the pending bit decisions.
+ *
+ * @param[out]  aStats  Statistics of the pending bit decisions.
+ *
+ */
+void nrf5RadioPendingStatsGet(PlatformRadioPendingStats *aStats);
+
+/**
+ * Function for clearing the statistics of the pending bit decisions.
+ *
+ */
+void nrf5RadioPendingStatsReset(void);
+
+/**
+ * Classes of radio operations arbitrated by the preemption policy.
+ *
+ */
+typedef enum
+{
+    kRadioOpClassIdleRx,      ///< Idle reception.
+    kRadioOpClassTx,          ///< Immediate transmission, including CSMA-CA.
+    kRadioOpClassEdCca,       ///< Energy detection and stand-alone CCA.
+    kRadioOpClassScheduledTx, ///< Delayed transmission.
+    kRadioOpClassScheduledRx, ///< Delayed reception window (e.g. CSL).
+    kRadioNumOpClasses
+} PlatformRadioOpClass;
+
+/**
+ * This structure represents the statistics of the preemption policy.
+ *
+ */
+typedef struct
+{
+    uint32_t mPreempted[kRadioNumOpClasses]; ///< Operations of the class terminated by a higher priority request.
+    uint32_t mDenied[kRadioNumOpClasses];    ///< Requests of the class denied in favor of an ongoing operation.
+} PlatformRadioPreemptionStats;
+
+/**
+ * Function for setting the priority of a class of radio operations.
+ *
+ * With NRF_802154_PREEMPTION_POLICY_ENABLED, a request of a higher priority than the ongoing operation terminates it
+ * and a request of a lower priority is denied, regardless of the termination level used by the requester.
+ *
+ * @param[in]  aClass     Class of radio operations.
+ * @param[in]  aPriority  Priority of the class, higher value wins.
+ *
+ * @retval OT_ERROR_NONE          Successfully set.
+ * @retval OT_ERROR_INVALID_ARGS  @p aClass is not a valid class.
+ * @retval OT_ERROR_NOT_CAPABLE   NRF_802154_PREEMPTION_POLICY_ENABLED is not set.
+ *
+ */
+otError nrf5RadioPreemptionPrioritySet(PlatformRadioOpClass aClass, uint8_t aPriority);
+
+/**
+ * Function for getting the priority of a class of radio operations.
+ *
+ * @param[in]   aClass     Class of radio operations.
+ * @param[out]  aPriority  Priority of the class.
+ *
+ * @retval OT_ERROR_NONE          Successfully retrieved.
+ * @retval OT_ERROR_INVALID_ARGS  @p aClass is not a valid class.
+ * @retval OT_ERROR_NOT_CAPABLE   NRF_802154_PREEMPTION_POLICY_ENABLED is not set.
+ *
+ */
+otError nrf5RadioPreemptionPriorityGet(PlatformRadioOpClass aClass, uint8_t *aPriority);
+
+/**
+ * Function for getting the statistics of the preemption policy.
+ *
+ * @param[out]  aStats  Statistics of the preemption policy.
+ *
+ * @retval OT_ERROR_NONE         Successfully retrieved.
+ * @retval OT_ERROR_NOT_CAPABLE  NRF_802154_PREEMPTION_POLICY_ENABLED is not set.
+ *
+ */
+otError nrf5RadioPreemptionStatsGet(PlatformRadioPreemptionStats *aStats);
+
+/**
+ * Function for clearing the statistics of the preemption policy.
+ *
+ */
+void nrf5RadioPreemptionStatsReset(void);
+
+/**
+ * Callback function for a conflict resolved by the preemption policy.
+ *
+ * Called from the radio interrupt, so it must be short. A terminated operation is also reported as aborted by its
+ * usual completion callback, and a denied transmission fails as a channel access failure. The default implementation
+ * does nothing, an application can override it to track which requests lose arbitration.
+ *
+ * @param[in]  aRequested  Class of the requested operation.
+ * @param[in]  aOngoing    Class of the ongoing operation.
+ * @param[in]  aGranted    Whether the ongoing operation was terminated in favor of the request.
+ *
+ */
+void nrf5RadioPreemptionNotify(PlatformRadioOpClass aRequested, PlatformRadioOpClass aOngoing, bool aGranted);
+
+/**
+ * This structure represents the statistics of the HFXO pre-start and keep-warm policy.
+ *
+ */
+typedef struct
+{
+    uint32_t mPrestarts;    ///< Number of HFXO starts ahead of an alarm.
+    uint32_t mHits;         ///< Number of radio operations requested while the HFXO was kept warm and running.
+    uint32_t mMisses;       ///< Number of periods the HFXO was kept warm with no radio operation requested.
+    uint32_t mKeepWarm;     ///< Learned threshold [us] of the idle gaps the HFXO is kept warm across.
+    uint64_t mLatencySaved; ///< Sum of the HFXO ramp-up times [us] saved by the hits.
+    uint64_t mWarmTime;     ///< Time [us] the HFXO was running only to be kept warm.
+    uint64_t mExtraCharge;  ///< Estimated charge [nC] drawn by the HFXO while kept warm.
+} PlatformRadioHfxoStats;
+
+/**
+ * Function for getting the statistics of the HFXO pre-start and keep-warm policy.
+ *
+ * With NRF_802154_HFCLK_WARM_ENABLED, the HFXO is kept running after the radio goes to sleep for a threshold learned
+ * from the idle gaps between radio operations, and started ahead of the next alarm of the stack
+ * (RADIO_CONFIG_HFXO_PRESTART_ALARM), so that a radio operation requested meanwhile does not wait for the crystal.
+ *
+ * @param[out]  aStats  Statistics of the HFXO policy.
+ *
+ * @retval OT_ERROR_NONE         Successfully retrieved.
+ * @retval OT_ERROR_NOT_CAPABLE  NRF_802154_HFCLK_WARM_ENABLED is not set.
+ *
+ */
+otError nrf5RadioHfxoStatsGet(PlatformRadioHfxoStats *aStats);
+
+/**
+ * Function for clearing the statistics of the HFXO pre-start and keep-warm policy.
+ *
+ */
+void nrf5RadioHfxoStatsReset(void);
+
+/**
+ * Number of MAC key indexes whose frame counters and usage are tracked. The previous, current and next keys always
+ * occupy distinct slots.
+ *
+ */
+#define NRF5_RADIO_KEY_SLOTS 4
+
+/**
+ * This structure represents the usage of a MAC key.
+ *
+ */
+typedef struct
+{
+    uint8_t  mKeyId;        ///< Key index (Key ID Mode 1), 0 if the slot was never used.
+    uint32_t mFrameCounter; ///< Next frame counter to be used with the key.
+    uint32_t mFrames;       ///< Number of frames secured with the key.
+    uint32_t mEnhAcks;      ///< Number of Enh-ACKs secured with the key.
+} PlatformRadioKeyUsage;
+
+/**
+ * This structure represents the statistics of the MAC keys used by the radio.
+ *
+ */
+typedef struct
+{
+    uint32_t              mRotations;                  ///< Number of key index changes by one.
+    uint32_t              mUnknownKeyIds;              ///< Enh-ACKs not secured for a key index not known to the radio.
+    PlatformRadioKeyUsage mKeys[NRF5_RADIO_KEY_SLOTS]; ///< Usage of the keys by the key index modulo the slots.
+} PlatformRadioKeyStats;
+
+/**
+ * Function for getting the statistics of the MAC keys used by the radio.
+ *
+ * @param[out]  aStats  Statistics of the MAC keys.
+ *
+ * @retval OT_ERROR_NONE         Successfully retrieved.
+ * @retval OT_ERROR_NOT_CAPABLE  The radio does not secure frames (Thread 1.1).
+ *
+ */
+otError nrf5RadioKeyStatsGet(PlatformRadioKeyStats *aStats);
+
+/**
+ * Function for clearing the usage counters of the MAC keys.
+ *
+ */
+void nrf5RadioKeyStatsReset(void);
+
+/**
+ * Callback function for a MAC frame counter reaching RADIO_CONFIG_MAC_FRAME_COUNTER_WATERMARK.
+ *
+ * Called once when a frame counter passes the watermark, either from the radio interrupt or from the thread context,
+ * so it must be short. The default implementation does nothing, an application can override it to trigger a key
+ * rotation before the frame counter is exhausted.
+ *
+ * @param[in]  aKeyId         Key index (Key ID Mode 1) of the frame counter.
+ * @param[in]  aFrameCounter  Value of the frame counter.
+ *
+ */
+void nrf5RadioFrameCounterWatermarkReached(uint8_t aKeyId, uint32_t aFrameCounter);
+
+/**
+ * This structure represents the quality of a channel.
+ *
+ */
+typedef struct
+{
+    uint16_t mOccupancy;    ///< Rate of energy samples and CCAs finding the channel occupied, 0xffff for 100%.
+    uint16_t mCrcErrorRate; ///< Rate of frames received with a CRC error, 0xffff for 100%.
+    int8_t   mEnergy;       ///< Moving average of energy samples [dBm], OT_RADIO_RSSI_INVALID if not sampled.
+    uint32_t mEdSamples;    ///< Number of energy samples.
+    uint32_t mCcaBusy;      ///< Number of CCAs that found the channel busy.
+    uint32_t mCcaIdle;      ///< Number of CCAs that found the channel idle.
+    uint32_t mRxFrames;     ///< Number of frames received.
+    uint32_t mRxCrcErrors;  ///< Number of frames received with a CRC error.
+    uint32_t mLastUpdate;   ///< Time [ms] of the last observation of the channel.
+} PlatformChannelQuality;
+
+/**
+ * Function for clearing the channel map.
+ *
+ */
+void nrf5ChannelMapReset(void);
+
+/**
+ * Function for updating the channel map with an energy detection sample.
+ *
+ * @param[in]  aChannel  Channel of the sample.
+ * @param[in]  aEnergy   Detected energy [dBm].
+ *
+ */
+void nrf5ChannelMapEdSample(uint8_t aChannel, int8_t aEnergy);
+
+/**
+ * Function for updating the channel map with the result of a CCA.
+ *
+ * @param[in]  aChannel  Channel of the CCA.
+ * @param[in]  aBusy     Whether the channel was found busy.
+ *
+ */
+void nrf5ChannelMapCcaResult(uint8_t aChannel, bool aBusy);
+
+/**
+ * Function for updating the channel map with a received frame.
+ *
+ * @param[in]  aChannel   Channel of the frame.
+ * @param[in]  aCrcError  Whether the frame was received with a CRC error.
+ *
+ */
+void nrf5ChannelMapRxResult(uint8_t aChannel, bool aCrcError);
+
+/**
+ * Function for getting the quality of a channel.
+ *
+ * @param[in]   aChannel  Channel to get the quality of.
+ * @param[out]  aQuality  Quality of the channel.
+ *
+ * @retval OT_ERROR_NONE          Successfully retrieved.
+ * @retval OT_ERROR_INVALID_ARGS  The channel is not a 2.4 GHz O-QPSK channel.
+ * @retval OT_ERROR_NOT_CAPABLE   RADIO_CONFIG_CHANNEL_MAP_ENABLE is not set.
+ *
+ */
+otError nrf5ChannelMapGet(uint8_t aChannel, PlatformChannelQuality *aQuality);
+
+/**
+ * Function for selecting the channel of best quality.
+ *
+ * Channels that were not observed yet are not selected. The channel with the lowest sum of occupancy and CRC error
+ * rate is selected.
+ *
+ * @param[in]   aChannelMask  Mask of the channels to select from, bit N for channel N.
+ * @param[out]  aChannel      Selected channel.
+ *
+ * @retval OT_ERROR_NONE         Successfully selected.
+ * @retval OT_ERROR_NOT_FOUND    None of the channels was observed.
+ * @retval OT_ERROR_NOT_CAPABLE  RADIO_CONFIG_CHANNEL_MAP_ENABLE is not set.
+ *
+ */
+otError nrf5ChannelMapBestChannelGet(uint32_t aChannelMask, uint8_t *aChannel);
+
+/**
+ * Initialization of hardware crypto engine.
+ *
+ */
+void nrf5CryptoInit(void);
+
+/**
+ * Deinitialization of hardware crypto engine.
+ *
+ */
+void nrf5CryptoDeinit(void);
+
+/**
+ * Function for erasing page in flash.
+ *
+ */
+otError nrf5FlashPageErase(uint32_t aAddress);
+
+/**
+ * Function for checking state of flash driver. The driver is busy while erases or writes are queued.
+ *
+ */
+bool nrf5FlashIsBusy(void);
+
+/**
+ * Function for writing data into flash.
+ *
+ */
+otError nrf5FlashWrite(uint32_t aAddress, const uint8_t *aData, uint32_t aSize);
+
+/**
+ * Function for reading data from flash, including the data of erases and writes still queued.
+ *
+ */
+void nrf5FlashRead(uint32_t aAddress, void *aData, uint32_t aSize);
+
+/**
+ * Function for executing queued flash erases and writes in the gaps between radio windows.
+ *
+ */
+void nrf5FlashProcess(void);
+
+/**
+ * Function for completing all queued flash erases and writes.
+ *
+ */
+void nrf5FlashFlush(void);
+
+/**
+ * Wear statistics of the settings area in flash.
+ *
+ */
+typedef struct
+{
+    bool     mTracked;         ///< Erase counts are kept in page headers, see PLATFORM_FLASH_WEAR_LEVELING_ENABLE.
+    uint16_t mPageCount;       ///< Number of pages of the settings area.
+    uint32_t mEraseCountMin;   ///< Lowest erase count of a page.
+    uint32_t mEraseCountMax;   ///< Highest erase count of a page.
+    uint32_t mEraseCountTotal; ///< Sum of the erase counts of all pages.
+    uint32_t mErasesSinceBoot; ///< Number of page erases since boot.
+} PlatformFlashWearStats;
+
+/**
+ * Function for getting wear statistics of the settings area.
+ *
+ */
+void nrf5FlashWearStatsGet(PlatformFlashWearStats *aStats);
+
+/**
+ * Function for getting the erase count of a page of the settings area.
+ *
+ * @param[in]   aPage        Index of the page within the settings area.
+ * @param[out]  aEraseCount  Number of times the page has been erased.
+ *
+ * @retval OT_ERROR_NONE          Successfully retrieved.
+ * @retval OT_ERROR_INVALID_ARGS  The page does not exist.
+ * @retval OT_ERROR_NOT_CAPABLE   Erase counts are not tracked.
+ *
+ */
+otError nrf5FlashWearPageEraseCountGet(uint16_t aPage, uint32_t *aEraseCount);
+
+/**
+ * This structure represents statistics of the scheduling of flash operations around radio windows.
+ *
+ */
+typedef struct
+{
+    uint32_t mOperations;    ///< Number of scheduled parts of erases and writes.
+    uint32_t mPostponed;     ///< Number of parts postponed because of an upcoming radio window.
+    uint32_t mForced;        ///< Number of parts executed after waiting for the maximum delay.
+    uint32_t mDelayTotal;    ///< Total time [us] parts were postponed.
+    uint32_t mDelayMax;      ///< Longest time [us] a part was postponed.
+    uint32_t mPartialErases; ///< Number of page erases split into partial erases.
+} PlatformFlashSchedulerStats;
+
+/**
+ * Function for getting statistics of the flash operation scheduling.
+ *
+ */
+void nrf5FlashSchedulerStatsGet(PlatformFlashSchedulerStats *aStats);
+
+/**
+ * Function for resetting statistics of the flash operation scheduling.
+ *
+ */
+void nrf5FlashSchedulerStatsReset(void);
+
+/**
+ * Function for starting a settings erase or write. The parts of the operation share the maximum delay, see
+ * PLATFORM_FLASH_SCHEDULER_MAX_DELAY_US.
+ *
+ */
+void nrf5FlashSchedulerOperationStart(void);
+
+#if PLATFORM_FLASH_QSPI_ENABLE
+/**
+ * Initialization of QSPI external flash.
+ *
+ */
+void nrf5QspiFlashInit(void);
+
+/**
+ * Function for checking if a QSPI external flash operation is in progress.
+ *
+ */
+bool nrf5QspiFlashIsBusy(void);
+
+/**
+ * Function for starting erase of sectors in QSPI external flash.
+ *
+ * The erase continues in background, subsequent operations wait for its completion.
+ *
+ */
+otError nrf5QspiFlashErase(uint32_t aAddress, uint32_t aSize);
+
+/**
+ * Function for writing data into QSPI external flash.
+ *
+ * The last part of the data is programmed in background, subsequent operations wait for its completion.
+ *
+ */
+otError nrf5QspiFlashWrite(uint32_t aAddress, const uint8_t *aData, uint32_t aSize);
+
+/**
+ * Function for reading data from QSPI external flash.
+ *
+ */
+otError nrf5QspiFlashRead(uint32_t aAddress, uint8_t *aData, uint32_t aSize);
+#endif // PLATFORM_FLASH_QSPI_ENABLE
+
+/**
+ * Initialization of temperature controller.
+ *
+ */
+void nrf5TempInit(void);
+
+/**
+ * Deinitialization of temperature controller.
+ *
+ */
+void nrf5TempDeinit(void);
+
+/**
+ * Function for processing temperature controller.
+ *
+ */
+void nrf5TempProcess(void);
+
+/**
+ * Function for measuring internal temperature.
+ *
+ * @return Temperature value measured.
+ *
+ */
+int32_t nrf5TempGet(void);
+
+#if SOFTDEVICE_PRESENT
+/**
+ * Function for translating SoftDevice error into OpenThread's one.
+ *
+ */
+otError nrf5SdErrorToOtError(uint32_t aSdError);
+
+/**
+ * Function for processing SoftDevice SoC events in flash module.
+ *
+ */
+void nrf5SdSocFlashProcess(uint32_t aEvtId);
+#endif // SOFTDEVICE_PRESENT
+
+/**
+ * Liveness checks supervised by the watchdog.
+ *
+ */
+typedef enum
+{
+    kWatchdogCheckNone,      ///< No check (no failure recorded).
+    kWatchdogCheckRadio,     ///< Radio driver reports the result of a requested operation.
+    kWatchdogCheckTransport, ///< Serial transport completes a started transmission.
+    kWatchdogCheckAlarm,     ///< An armed alarm fires.
+    kWatchdogNumChecks
+} PlatformWatchdogCheck;
+
+/**
+ * Initialization of the watchdog.
+ *
+ */
+void nrf5WatchdogInit(void);
+
+/**
+ * Deinitialization of the watchdog.
+ *
+ */
+void nrf5WatchdogDeinit(void);
+
+/**
+ * Function for processing the watchdog. Feeds the watchdog if all liveness checks pass.
+ *
+ */
+void nrf5WatchdogProcess(void);
+
+/**
+ * Function for arming a liveness check. The check fails if it is not disarmed within @p aTimeoutMs.
+ *
+ * @note This function can be called from interrupt context.
+ *
+ */
+void nrf5WatchdogCheckArm(PlatformWatchdogCheck aCheck, uint32_t aTimeoutMs);
+
+/**
+ * Function for disarming a liveness check.
+ *
+ * @note This function can be called from interrupt context.
+ *
+ */
+void nrf5WatchdogCheckDisarm(PlatformWatchdogCheck aCheck);
+
+/**
+ * Function for pausing the watchdog supervision during long blocking operations, e.g. flash page erase.
+ *
+ */
+void nrf5WatchdogPause(void);
+
+/**
+ * Function for resuming the watchdog supervision paused with @ref nrf5WatchdogPause.
+ *
+ */
+void nrf5WatchdogResume(void);
+
+/**
+ * Function for getting the liveness check that caused the last watchdog reset.
+ *
+ * @returns The failed check, or @ref kWatchdogCheckNone if the last reset was not caused by a failed check.
+ *
+ */
+PlatformWatchdogCheck nrf5WatchdogLastFailedCheckGet(void);
+
+/**
+ * Function for getting the name of a liveness check.
+ *
+ */
+const char *nrf5WatchdogCheckToString(PlatformWatchdogCheck aCheck);
+
+/**
+ * Boot milestones recorded after reset.
+ *
+ */
+typedef enum
+{
+    kBootMilestoneLfclk,     ///< Low frequency clock is running and the RTC has been started.
+    kBootMilestoneHfclk,     ///< High frequency crystal oscillator is running.
+    kBootMilestoneEntropy,   ///< First random word is available.
+    kBootMilestoneTransport, ///< Serial transport is ready to exchange data with the host.
+    kBootMilestoneInitDone,  ///< otSysInit() has returned.
+    kBootNumMilestones
+} PlatformBootMilestone;
+
+/**
+ * Value returned by @ref nrf5BootMilestoneTimeGet for a milestone that has not been reached yet.
+ *
+ */
+#define NRF5_BOOT_TIME_INVALID UINT32_MAX
+
+/**
+ * Function for recording that a boot milestone has been reached. Only the first call for a milestone is recorded.
+ *
+ * @note This function can be called from interrupt context.
+ *
+ */
+void nrf5BootMilestoneReached(PlatformBootMilestone aMilestone);
+
+/**
+ * Function for getting the time at which a boot milestone has been reached.
+ *
+ * @returns Time in microseconds counted from the entry to otSysInit(), or @ref NRF5_BOOT_TIME_INVALID.
+ *
+ */
+uint32_t nrf5BootMilestoneTimeGet(PlatformBootMilestone aMilestone);
+
+/**
+ * Function for getting the name of a boot milestone.
+ *
+ */
+const char *nrf5BootMilestoneToString(PlatformBootMilestone aMilestone);
+
+/**
+ * Size of the SHA-256 digest of a staged image.
+ *
+ */
+#define NRF5_IMAGE_STAGING_DIGEST_SIZE 32
+
+/**
+ * States of the firmware image staging.
+ *
+ */
+typedef enum
+{
+    kImageStagingDisabled,  ///< Image staging is not enabled or the slot configuration is invalid.
+    kImageStagingIdle,      ///< No image is being staged.
+    kImageStagingStarting,  ///< The progress record is being prepared.
+    kImageStagingResuming,  ///< The image written before a reset is being rehashed.
+    kImageStagingReceiving, ///< The image is being written.
+    kImageStagingComplete,  ///< The image is staged and its digest is recorded.
+} PlatformImageStagingState;
+
+/**
+ * Firmware image staging status.
+ *
+ */
+typedef struct
+{
+    PlatformImageStagingState mState;
+    uint32_t                  mImageSize;      ///< Size of the staged image.
+    uint32_t                  mOffset;         ///< Offset of the next image byte to write.
+    uint32_t                  mEraseDeferrals; ///< Number of page erases deferred due to radio activity.
+    uint8_t                   mDigest[NRF5_IMAGE_STAGING_DIGEST_SIZE]; ///< SHA-256 digest of a complete image.
+} PlatformImageStagingStatus;
+
+/**
+ * Initialization of the power management. Configures the instruction cache, the regulators and the RAM power.
+ *
+ */
+void nrf5PowerInit(void);
+
+/**
+ * Deinitialization of the power management.
+ *
+ */
+void nrf5PowerDeinit(void);
+
+/**
+ * Initialization of the firmware image staging. Resumes staging interrupted by a reset.
+ *
+ */
+void nrf5ImageStagingInit(void);
+
+/**
+ * Function for processing the firmware image staging. Erases pages of the slot in background.
+ *
+ */
+void nrf5ImageStagingProcess(void);
+
+#if IMAGE_STAGING_ENABLE
+/**
+ * Function for starting to stage a new firmware image. Discards a previously staged image.
+ *
+ * @param[in]  aImageSize  Size of the image.
+ *
+ * @retval OT_ERROR_NONE          Successfully started.
+ * @retval OT_ERROR_INVALID_ARGS  The image does not fit into the slot.
+ * @retval OT_ERROR_NOT_CAPABLE   The slot configuration is invalid.
+ *
+ */
+otError nrf5ImageStagingBegin(uint32_t aImageSize);
+
+/**
+ * Function for writing a chunk of the firmware image.
+ *
+ * Chunks must be written in order, starting from the offset reported by @ref nrf5ImageStagingStatusGet after a
+ * reset. Chunks should be a multiple of 4 bytes and must not exceed (IMAGE_STAGING_ERASE_AHEAD_PAGES - 1) pages.
+ *
+ * @retval OT_ERROR_NONE           Successfully written.
+ * @retval OT_ERROR_BUSY           The pages for the chunk are not erased yet, retry later.
+ * @retval OT_ERROR_INVALID_ARGS   The offset is not the next one expected or the chunk exceeds the image.
+ * @retval OT_ERROR_INVALID_STATE  No image is being staged.
+ *
+ */
+otError nrf5ImageStagingWrite(uint32_t aOffset, const uint8_t *aData, uint32_t aLength);
+
+/**
+ * Function for completing the firmware image staging once the whole image is written.
+ *
+ * @param[out]  aDigest  Buffer for the SHA-256 digest of the image, may be NULL.
+ *
+ */
+otError nrf5ImageStagingFinish(uint8_t *aDigest);
+
+/**
+ * Function for aborting the firmware image staging.
+ *
+ */
+void nrf5ImageStagingAbort(void);
+
+/**
+ * Function for getting the firmware image staging status.
+ *
+ */
+void nrf5ImageStagingStatusGet(PlatformImageStagingStatus *aStatus);
+#endif // IMAGE_STAGING_ENABLE
+
+/**
+ * Usage statistics of one size class of the mbedtls memory pool.
+ *
+ */
+typedef struct
+{
+    uint16_t mBlockSize;  ///< Size of a block.
+    uint16_t mBlockCount; ///< Number of blocks.
+    uint16_t mInUse;      ///< Number of blocks currently allocated.
+    uint16_t mPeak;       ///< Highest number of blocks allocated at once.
+    uint32_t mAllocs;     ///< Number of allocations served from this size class.
+    uint32_t mFailures;   ///< Number of requests fitting this size class that found it exhausted.
+} PlatformMbedtlsPoolBinStats;
+
+/**
+ * Usage statistics of the mbedtls memory pool.
+ *
+ */
+typedef struct
+{
+    uint32_t mHeapFallbacks; ///< Number of requests served from the OpenThread heap.
+    uint32_t mFailures;      ///< Number of requests that could not be served.
+} PlatformMbedtlsPoolStats;
+
+#if MBEDTLS_POOL_ENABLE
+/**
+ * Initialization of the mbedtls memory pool. All blocks must be free.
+ *
+ */
+void nrf5MbedtlsPoolInit(void);
+
+/**
+ * Function for allocating zeroed memory for mbedtls, compatible with mbedtls_platform_set_calloc_free().
+ *
+ */
+void *nrf5MbedtlsPoolCAlloc(size_t aCount, size_t aSize);
+
+/**
+ * Function for releasing memory allocated with @ref nrf5MbedtlsPoolCAlloc.
+ *
+ */
+void nrf5MbedtlsPoolFree(void *aPointer);
+
+/**
+ * Function for getting the number of size classes of the mbedtls memory pool.
+ *
+ */
+uint8_t nrf5MbedtlsPoolBinCount(void);
+
+/**
+ * Function for getting the usage statistics of a size class of the mbedtls memory pool.
+ *
+ * @param[in]   aBin    Index of the size class, smallest first.
+ * @param[out]  aStats  Statistics of the size class.
+ *
+ * @retval OT_ERROR_NONE          Successfully retrieved.
+ * @retval OT_ERROR_INVALID_ARGS  The size class does not exist.
+ *
+ */
+otError nrf5MbedtlsPoolBinStatsGet(uint8_t aBin, PlatformMbedtlsPoolBinStats *aStats);
+
+/**
+ * Function for getting the overall usage statistics of the mbedtls memory pool.
+ *
+ */
+void nrf5MbedtlsPoolStatsGet(PlatformMbedtlsPoolStats *aStats);
+
+/**
+ * Function for resetting the allocation counters and peaks of the mbedtls memory pool.
+ *
+ */
+void nrf5MbedtlsPoolStatsReset(void);
+#endif // MBEDTLS_POOL_ENABLE
+
+/**
+ * Causes of a crash saved in the crash dump.
+ *
+ */
+typedef enum
+{
+    kCrashReasonNone,        ///< No crash dump.
+    kCrashReasonHardFault,   ///< HardFault exception.
+    kCrashReasonAssert,      ///< Failed assertion.
+    kCrashReasonAppError,    ///< Error reported by the nRF5 SDK or the SoftDevice.
+    kCrashReasonPureVirtual, ///< Call of a pure virtual function.
+} PlatformCrashReason;
+
+/**
+ * Number of registers saved in the crash dump: R0-R3, R12, LR, PC and xPSR, in the exception stack frame order.
+ *
+ */
+#define NRF5_CRASH_DUMP_REGISTERS 8
+
+/**
+ * Size of the tail of the source file name saved in the crash dump of a failed assertion.
+ *
+ */
+#define NRF5_CRASH_DUMP_FILE_SIZE 32
+
+/**
+ * Crash dump retained across the reset following a crash.
+ *
+ */
+typedef struct
+{
+    uint32_t mReason;                                          ///< A @ref PlatformCrashReason.
+    uint32_t mUptime;                                          ///< Time [ms] from boot to the crash.
+    uint32_t mRegisters[NRF5_CRASH_DUMP_REGISTERS];            ///< Registers at the crash.
+    uint32_t mSp;                                              ///< Stack pointer at the crash.
+    uint32_t mExcReturn;                                       ///< EXC_RETURN of a HardFault.
+    uint32_t mCfsr;                                            ///< Configurable Fault Status Register.
+    uint32_t mHfsr;                                            ///< HardFault Status Register.
+    uint32_t mMmfar;                                           ///< MemManage Fault Address Register.
+    uint32_t mBfar;                                            ///< BusFault Address Register.
+    uint32_t mInfo[2];                                         ///< Line of an assertion, or SDK error id and info.
+    char     mFile[NRF5_CRASH_DUMP_FILE_SIZE];                 ///< Tail of the source file name of an assertion.
+    uint32_t mRadioState;                                      ///< Radio driver state.
+    uint32_t mStackSize;                                       ///< Number of valid words in @p mStack.
+    uint32_t mStack[PLATFORM_CRASH_DUMP_STACK_WORDS];          ///< Words from the top of the stack.
+    uint32_t mRadioLogSize;                                    ///< Number of valid entries in @p mRadioLog.
+    uint32_t mRadioLog[PLATFORM_CRASH_DUMP_RADIO_LOG_ENTRIES]; ///< Radio driver log entries, oldest first.
+} PlatformCrashDump;
+
+/**
+ * Initialization of the crash dump. Validates the dump retained across the reset.
+ *
+ */
+void nrf5CrashDumpInit(void);
+
+/**
+ * Function for getting the crash dump retained across the reset.
+ *
+ * @returns A pointer to the crash dump, or NULL if there is none.
+ *
+ */
+const PlatformCrashDump *nrf5CrashDumpGet(void);
+
+/**
+ * Function for getting the raw bytes of the crash dump retained across the reset, for transfer to the host.
+ *
+ * @param[out]  aLength  A pointer to the size of the crash dump in bytes, set to 0 if there is none.
+ *
+ * @returns A pointer to the crash dump, or NULL if there is none.
+ *
+ */
+const uint8_t *nrf5CrashDumpRawGet(uint16_t *aLength);
+
+/**
+ * Function for clearing the crash dump retained across the reset.
+ *
+ */
+void nrf5CrashDumpClear(void);
+
+/**
+ * Function for getting the cause of the crash that caused the last reset.
+ *
+ * @returns The cause of the crash, or @ref kCrashReasonNone if the last reset was not caused by a crash.
+ *
+ */
+PlatformCrashReason nrf5CrashLastReasonGet(void);
+
+/**
+ * Function for saving a crash dump and resetting the device.
+ *
+ * Without PLATFORM_CRASH_DUMP_ENABLE, the function does nothing and returns.
+ *
+ * @param[in]  aReason  The cause of the crash.
+ * @param[in]  aInfo0   Line of an assertion, or id of an SDK error.
+ * @param[in]  aInfo1   Info of an SDK error.
+ * @param[in]  aFile    Source file name of an assertion, or NULL.
+ *
+ */
+void nrf5CrashDumpSave(PlatformCrashReason aReason, uint32_t aInfo0, uint32_t aInfo1, const char *aFile);
 
 int8_t nrf5GetChannelMaxTransmitPower(uint8_t aChannel);
 
@@ -0,0 +1,78 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the power management platform-specific functions.
+ *
+ */
+
+#ifndef PLATFORM_POWER_H_
+#define PLATFORM_POWER_H_
+
+#include <stdint.h>
+
+/** @brief Low power modes used while idle. */
+typedef enum
+{
+    OT_SYS_POWER_MODE_CONST_LATENCY, /**< CPU sleep in constant latency mode, for short idle periods. */
+    OT_SYS_POWER_MODE_LOW_POWER,     /**< CPU sleep in low power mode. */
+    OT_SYS_POWER_MODE_COUNT,
+} otSysPowerMode;
+
+/** @brief Power management statistics. */
+typedef struct
+{
+    uint64_t activeTime;                         /**< Time spent outside of idle in microseconds. */
+    uint64_t residency[OT_SYS_POWER_MODE_COUNT]; /**< Time spent idle in each mode in microseconds. */
+    uint32_t entries[OT_SYS_POWER_MODE_COUNT];   /**< Number of idle periods spent in each mode. */
+} otSysPowerStats;
+
+/**
+ * Function for putting the CPU to sleep until the next event.
+ *
+ * The low power mode is selected from the time to the next scheduled alarm, including the radio driver timers.
+ * The function returns immediately if an interrupt occurred since it was last called, so it is meant to be called
+ * from the main loop once tasklets and drivers have been processed.
+ *
+ */
+void otSysPowerIdle(void);
+
+/**
+ * Function used to get power management statistics.
+ *
+ */
+void otSysPowerStatsGet(otSysPowerStats *aStats);
+
+/**
+ * Function used to reset power management statistics.
+ *
+ */
+void otSysPowerStatsReset(void);
+
+#endif // PLATFORM_POWER_H_
@@ -44,6 +44,7 @@
 #define PLATFORM_SOFTDEVICE_RAAL_TIMESLOT_DEFAULT_TIMEOUT 6400
 #define PLATFORM_SOFTDEVICE_RAAL_TIMESLOT_DEFAULT_MAX_LENGTH 120000000
 #define PLATFORM_SOFTDEVICE_RAAL_DEFAULT_LF_CLK_ACCURACY_PPM 500
+#define PLATFORM_SOFTDEVICE_RAAL_TIMESLOT_DEFAULT_ADAPTIVE_MAX_LENGTH 0
 
 /** @brief RAAL Softdevice configuration parameters. */
 typedef struct
@@ -57,8 +58,22 @@ typedef struct
     uint16_t timeslotSafeMargin; /**< Safe margin before timeslot is finished and nrf_raal_timeslot_ended should be
                                     called in microseconds. */
     uint16_t lfClkAccuracyPpm;   /**< Clock accuracy in ppm unit. */
+    uint32_t timeslotAdaptiveMaxLength; /**< Maximum timeslot length the module grows requests and extensions to while
+                                           the radio is active, in microseconds. Value not greater than timeslotLength,
+                                           including 0, disables adaptive timeslot length. */
 } otSysSoftdeviceRaalConfigParams;
 
+/** @brief RAAL Softdevice statistics. */
+typedef struct
+{
+    uint64_t grantedTime;       /**< Total timeslot time granted by the SoftDevice in microseconds. */
+    uint32_t grantedCount;      /**< Number of granted timeslots. */
+    uint32_t deniedCount;       /**< Number of timeslot requests blocked or canceled by the SoftDevice. */
+    uint32_t extendFailedCount; /**< Number of timeslot extensions denied by the SoftDevice. */
+    uint32_t preemptedCount;    /**< Number of timeslots ended by the safe margin after a denied extension. */
+    uint32_t timeslotLength;    /**< Current timeslot length requested by the module in microseconds. */
+} otSysSoftdeviceRaalStats;
+
 /**
  * Function for processing SoftDevice SoC events.
  *
@@ -71,4 +86,10 @@ void otSysSoftdeviceSocEvtHandler(uint32_t aEvtId);
  */
 void otSysSoftdeviceRaalConfig(const otSysSoftdeviceRaalConfigParams *aConfig);
 
+/**
+ * Function used to get statistics of Softdevice RAAL timeslots.
+ *
+ */
+void otSysSoftdeviceRaalStatsGet(otSysSoftdeviceRaalStats *aStats);
+
 #endif // PLATFORM_SOFTDEVICE_H_
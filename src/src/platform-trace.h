@@ -0,0 +1,117 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the platform-specific functions of the binary event trace.
+ *
+ */
+
+#ifndef PLATFORM_TRACE_H_
+#define PLATFORM_TRACE_H_
+
+#include <stdint.h>
+
+/**
+ * Events recorded in the trace. The values are part of the trace format decoded by `script/trace-decode`.
+ *
+ */
+typedef enum
+{
+    kTraceEventLost                = 0,  ///< Entries were lost, the parameter is their number.
+    kTraceEventRadioSleep          = 1,  ///< Radio sleep requested.
+    kTraceEventRadioReceive        = 2,  ///< Receive requested, the parameter is the channel.
+    kTraceEventRadioTransmit       = 3,  ///< Transmit requested, the parameter is the channel and the PSDU length.
+    kTraceEventRadioTxStarted      = 4,  ///< Frame transmission started.
+    kTraceEventRadioTransmitted    = 5,  ///< Frame transmitted, the parameter is the ACK length.
+    kTraceEventRadioTransmitFailed = 6,  ///< Frame transmission failed, the parameter is the driver error.
+    kTraceEventRadioReceived       = 7,  ///< Frame received, the parameter is the PSDU length.
+    kTraceEventRadioReceiveFailed  = 8,  ///< Frame reception failed, the parameter is the driver error.
+    kTraceEventRadioTxAckStarted   = 9,  ///< ACK transmission started, the parameter is the ACK length.
+    kTraceEventRadioEnergyScan     = 10, ///< Energy scan requested, the parameter is the channel.
+    kTraceEventRadioEnergyDetected = 11, ///< Energy scan finished, the parameter is the energy level.
+    kTraceEventAlarmMilliFired     = 12, ///< Millisecond alarm fired.
+    kTraceEventAlarmMicroFired     = 13, ///< Microsecond alarm fired.
+    kTraceEventFlashErase          = 14, ///< Settings swap erase started, the parameter is the swap index.
+    kTraceEventFlashWrite          = 15, ///< Settings write started, the parameter is the size.
+    kTraceEventFlashDone           = 16, ///< Settings erase or write finished.
+    kTraceEventRadioScanAborted    = 17, ///< Energy scan aborted, the parameter is the driver error.
+} PlatformTraceEvent;
+
+/**
+ * Entry of the trace.
+ *
+ */
+typedef struct
+{
+    uint32_t mTimestamp; ///< RTC counter [1/32768 s] with the overflows in the upper bits.
+    uint16_t mEvent;     ///< A @ref PlatformTraceEvent.
+    uint16_t mParam;     ///< Event parameter.
+} PlatformTraceEntry;
+
+/**
+ * Initialization of the trace.
+ *
+ */
+void nrf5TraceInit(void);
+
+/**
+ * Function for recording an event in the trace. May be called from any context, overwrites the oldest entry when the
+ * trace is full.
+ *
+ * @param[in]  aEvent  The event.
+ * @param[in]  aParam  The event parameter.
+ *
+ */
+void nrf5TraceRecord(PlatformTraceEvent aEvent, uint16_t aParam);
+
+/**
+ * Function for reading and removing the oldest entries from the trace. If entries were lost since the last read, a
+ * @ref kTraceEventLost entry is returned first.
+ *
+ * @param[out]  aEntries     A pointer to the buffer for the entries.
+ * @param[in]   aMaxEntries  The size of the buffer in entries, at least two.
+ *
+ * @returns The number of entries read.
+ *
+ */
+uint16_t nrf5TraceRead(PlatformTraceEntry *aEntries, uint16_t aMaxEntries);
+
+/**
+ * Function for getting the number of entries lost since boot, overwritten before they were read.
+ *
+ */
+uint32_t nrf5TraceLostGet(void);
+
+/**
+ * Function for draining the trace to RTT, called from the main loop.
+ *
+ */
+void nrf5TraceProcess(void);
+
+#endif // PLATFORM_TRACE_H_
@@ -0,0 +1,300 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the idle and low power management.
+ *
+ */
+
+#include <openthread-core-config.h>
+#include <openthread/config.h>
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <utils/code_utils.h>
+
+#include <nrf.h>
+
+#include "platform-nrf5.h"
+#include "platform-power.h"
+
+#if SOFTDEVICE_PRESENT
+#include "softdevice.h"
+#endif
+
+// clang-format off
+#define RAM_BASE_ADDRESS            0x20000000UL
+#define RAM_SMALL_BLOCKS            8            ///< Number of RAM blocks made of small sections.
+#define RAM_SMALL_SECTION_SIZE      0x1000UL     ///< Size of a section of the blocks RAM0..RAM7.
+#define RAM_SMALL_SECTIONS          2            ///< Number of sections in each of the blocks RAM0..RAM7.
+#define RAM_LARGE_SECTION_SIZE      0x8000UL     ///< Size of a section of the block RAM8 (nRF52833, nRF52840).
+// clang-format on
+
+static bool            sConstLatency; ///< Constant latency mode is active.
+static uint64_t        sWakeTime;     ///< Time of the last return from idle.
+static otSysPowerStats sStats;
+
+#if SOFTDEVICE_PRESENT
+static bool isSoftdeviceEnabled(void)
+{
+    uint8_t enabled = 0;
+
+    (void)sd_softdevice_is_enabled(&enabled);
+
+    return enabled != 0;
+}
+#endif
+
+static void setConstLatency(bool aEnable)
+{
+    if (aEnable == sConstLatency)
+    {
+        return;
+    }
+
+    sConstLatency = aEnable;
+
+#if SOFTDEVICE_PRESENT
+    if (isSoftdeviceEnabled())
+    {
+        (void)sd_power_mode_set(aEnable ? NRF_POWER_MODE_CONSTLAT : NRF_POWER_MODE_LOWPWR);
+        return;
+    }
+#endif
+
+    if (aEnable)
+    {
+        NRF_POWER->TASKS_CONSTLAT = 1;
+    }
+    else
+    {
+        NRF_POWER->TASKS_LOWPWR = 1;
+    }
+}
+
+static void waitForEvent(void)
+{
+#if SOFTDEVICE_PRESENT
+    if (isSoftdeviceEnabled())
+    {
+        (void)sd_app_evt_wait();
+        return;
+    }
+#endif
+
+    // Returns immediately if an interrupt occurred since the last call, so no event can be missed.
+    __WFE();
+}
+
+static void regulatorsInit(void)
+{
+#if DCDC_ENABLE
+#if SOFTDEVICE_PRESENT
+    if (isSoftdeviceEnabled())
+    {
+        (void)sd_power_dcdc_mode_set(NRF_POWER_DCDC_ENABLE);
+    }
+    else
+#endif
+    {
+        NRF_POWER->DCDCEN = 1;
+    }
+#endif
+
+#if DCDC_HV_ENABLE
+#if SOFTDEVICE_PRESENT
+    if (isSoftdeviceEnabled())
+    {
+        (void)sd_power_dcdc0_mode_set(NRF_POWER_DCDC_ENABLE);
+    }
+    else
+#endif
+    {
+        NRF_POWER->DCDCEN0 = 1;
+    }
+#endif
+}
+
+static void icacheInit(void)
+{
+#if defined(NVMC_ICACHECNF_CACHEEN_Msk) && PLATFORM_POWER_ICACHE_ENABLE
+    NRF_NVMC->ICACHECNF = NVMC_ICACHECNF_CACHEEN_Enabled;
+#endif
+}
+
+#if PLATFORM_POWER_RAM_UNUSED_OFF && defined(__GNUC__)
+extern uint32_t __HeapBase;
+extern uint32_t __HeapLimit;
+extern uint32_t __StackLimit;
+
+/**
+ * Replaces the `_sbrk()` of libnosys, which lets the heap grow up to the stack, so that the heap never reaches the
+ * RAM sections powered off by ramInit().
+ *
+ */
+void *_sbrk(ptrdiff_t aIncrement)
+{
+    static uint8_t *sBreak = (uint8_t *)&__HeapBase;
+    uint8_t        *previous;
+
+    if (aIncrement > (uint8_t *)&__HeapLimit - sBreak || aIncrement < (uint8_t *)&__HeapBase - sBreak)
+    {
+        errno = ENOMEM;
+        return (void *)-1;
+    }
+
+    previous = sBreak;
+    sBreak += aIncrement;
+
+    return previous;
+}
+
+static uint32_t ramSectionGet(uint32_t aAddress, uint8_t *aBlock, uint8_t *aSection)
+{
+    uint32_t offset = aAddress - RAM_BASE_ADDRESS;
+    uint32_t size;
+
+    // The blocks RAM0..RAM7 are laid out the same on all the supported SoCs, the nRF52811 has RAM0..RAM2 only.
+    if (offset < RAM_SMALL_BLOCKS * RAM_SMALL_SECTIONS * RAM_SMALL_SECTION_SIZE)
+    {
+        size      = RAM_SMALL_SECTION_SIZE;
+        *aBlock   = offset / (RAM_SMALL_SECTIONS * RAM_SMALL_SECTION_SIZE);
+        *aSection = (offset / RAM_SMALL_SECTION_SIZE) % RAM_SMALL_SECTIONS;
+    }
+    else
+    {
+        offset -= RAM_SMALL_BLOCKS * RAM_SMALL_SECTIONS * RAM_SMALL_SECTION_SIZE;
+        size      = RAM_LARGE_SECTION_SIZE;
+        *aBlock   = RAM_SMALL_BLOCKS;
+        *aSection = offset / RAM_LARGE_SECTION_SIZE;
+    }
+
+    return size;
+}
+
+static void ramInit(void)
+{
+    uint32_t address = (uint32_t)&__HeapLimit;
+    uint32_t end     = (uint32_t)&__StackLimit;
+
+    while (address < end)
+    {
+        uint8_t  block;
+        uint8_t  section;
+        uint32_t size  = ramSectionGet(address, &block, &section);
+        uint32_t start = address - ((address - RAM_BASE_ADDRESS) % size);
+        uint32_t mask  = (POWER_RAM_POWER_S0POWER_Msk | POWER_RAM_POWER_S0RETENTION_Msk) << section;
+
+        address = start + size;
+
+        // Only sections lying entirely in the unused area are powered off.
+        if (start < (uint32_t)&__HeapLimit || address > end)
+        {
+            continue;
+        }
+
+#if SOFTDEVICE_PRESENT
+        if (isSoftdeviceEnabled())
+        {
+            (void)sd_power_ram_power_clr(block, mask);
+        }
+        else
+#endif
+        {
+            NRF_POWER->RAM[block].POWERCLR = mask;
+        }
+    }
+}
+#else
+static void ramInit(void)
+{
+}
+#endif
+
+void nrf5PowerInit(void)
+{
+    icacheInit();
+    regulatorsInit();
+    ramInit();
+
+    sConstLatency = true;
+    setConstLatency(false);
+
+    // The alarm time base starts from zero when the alarm driver is initialized.
+    memset(&sStats, 0, sizeof(sStats));
+    sWakeTime = 0;
+}
+
+void nrf5PowerDeinit(void)
+{
+    setConstLatency(false);
+}
+
+void otSysPowerIdle(void)
+{
+    uint64_t       deadline = nrf5AlarmGetNextDeadline();
+    otSysPowerMode mode     = OT_SYS_POWER_MODE_LOW_POWER;
+    uint64_t       sleepTime;
+
+    // Neither the alarms nor the boot milestones count time asleep until the RTC is started, so the CPU stays awake
+    // until LFCLK is running. It happens once per boot.
+    otEXPECT(nrf5BootMilestoneTimeGet(kBootMilestoneLfclk) != NRF5_BOOT_TIME_INVALID);
+
+    if (deadline < PLATFORM_POWER_CONSTLAT_THRESHOLD_US)
+    {
+        mode = OT_SYS_POWER_MODE_CONST_LATENCY;
+    }
+
+    setConstLatency(mode == OT_SYS_POWER_MODE_CONST_LATENCY);
+
+    sleepTime = nrf5AlarmGetCurrentTime();
+    waitForEvent();
+
+    sStats.activeTime += sleepTime - sWakeTime;
+    sWakeTime = nrf5AlarmGetCurrentTime();
+    sStats.residency[mode] += sWakeTime - sleepTime;
+    sStats.entries[mode]++;
+
+exit:
+    return;
+}
+
+void otSysPowerStatsGet(otSysPowerStats *aStats)
+{
+    *aStats = sStats;
+}
+
+void otSysPowerStatsReset(void)
+{
+    memset(&sStats, 0, sizeof(sStats));
+}
@@ -79,6 +79,8 @@
 
 #define RSSI_SETTLE_TIME_US   40           ///< RSSI settle time in microseconds.
 #define SAFE_DELTA            1000         ///< A safe value for the `dt` parameter of delayed operations.
+#define IDLE_GUARD_TIME_US    5000         ///< Margin around scheduled radio windows kept free of CPU stalls.
+#define ED_MIN_TIME_US        128          ///< Duration of a single energy detection period in microseconds.
 
 #define CSL_UNCERT            20           ///< The Uncertainty of the scheduling CSL of transmission by the parent, in ±10 us units.
 
@@ -116,9 +118,80 @@ static int8_t   sLnaGain    = 0;
 static uint16_t sRegionCode = 0;
 
 static uint32_t sEnergyDetectionTime;
+static uint32_t sEnergyDetectionStart;
 static uint8_t  sEnergyDetectionChannel;
 static int8_t   sEnergyDetected;
 
+#if RADIO_CONFIG_TPC_ENABLE
+enum
+{
+    kTpcAverageShift = 3, // Weight of a new sample in the moving averages is 1/8.
+    kTpcRssiFracBits = 4, // Number of fractional bits of the RSSI moving average.
+};
+
+typedef struct
+{
+    otMacAddress mAddress;  // Address of the neighbor, OT_MAC_ADDRESS_TYPE_NONE if the entry is free.
+    int16_t      mRssi;     // Average RSSI with kTpcRssiFracBits fractional bits.
+    uint8_t      mLqi;      // Average LQI.
+    int8_t       mTxPower;  // Transmit power [dBm] for frames to the neighbor.
+    uint32_t     mLastUsed; // Value of sTpcUseCount when the entry was last used.
+} RadioTpcNeighbor;
+
+static RadioTpcNeighbor      sTpcNeighbors[RADIO_CONFIG_TPC_NEIGHBORS];
+static uint32_t              sTpcUseCount;
+static PlatformRadioTpcStats sTpcStats;
+#endif // RADIO_CONFIG_TPC_ENABLE
+
+#if NRF_802154_ACK_DATA_PENDING_BIT_HOOK_ENABLED
+static PlatformRadioPendingQueue *volatile sPendingQueues;
+static volatile uint16_t                   sPendingQueuesLength;
+static PlatformRadioPendingStats           sPendingStats;
+#endif
+
+#if NRF_802154_HFCLK_WARM_ENABLED
+enum
+{
+    kHfxoGapShift = 2, // Weight of a new idle gap in the learned keep-warm threshold is 1/4.
+};
+
+static bool     sHfxoRadioIdle;     // Whether the radio sleeps since sHfxoRadioIdleTime.
+static uint32_t sHfxoRadioIdleTime; // Time [us] the radio went to sleep.
+static uint32_t sHfxoKeepWarm;      // Learned threshold [us] of the idle gaps the HFXO is kept warm across.
+#endif
+
+#if RADIO_CONFIG_CCA_ADAPTIVE_ENABLE
+enum
+{
+    kCcaFloorFracBits  = 4,         // Number of fractional bits of the noise floor.
+    kCcaFloorFallShift = 1,         // Weight of a sample below the noise floor is 1/2.
+    kCcaFloorRiseShift = 5,         // Weight of a sample above the noise floor is 1/32.
+    kCcaFloorInvalid   = INT16_MIN, // Noise floor of a channel that was not sampled yet.
+};
+#endif
+
+typedef struct
+{
+    uint32_t mBusy; // Number of transmissions failed because CCA reported a busy channel.
+    uint32_t mIdle; // Number of transmissions started after CCA reported an idle channel.
+#if RADIO_CONFIG_CCA_ADAPTIVE_ENABLE
+    int16_t mNoiseFloor; // Noise floor with kCcaFloorFracBits fractional bits.
+#endif
+} RadioCcaChannel;
+
+static RadioCcaChannel sCcaChannels[OT_RADIO_2P4GHZ_OQPSK_CHANNEL_MAX - OT_RADIO_2P4GHZ_OQPSK_CHANNEL_MIN + 1];
+static uint8_t         sCcaEdThreshold; // ED threshold set with otPlatRadioSetCcaEnergyDetectThreshold().
+static bool            sTransmitCca;    // Whether CCA is performed before the current transmission.
+
+#if RADIO_CONFIG_CCA_ADAPTIVE_ENABLE
+static bool     sCcaAdaptive;
+static uint64_t sCcaLastSample;
+#endif
+
+#if RADIO_CONFIG_CHANNEL_MAP_ENABLE
+static uint64_t sChannelMapLastSample;
+#endif
+
 #if OPENTHREAD_CONFIG_MAC_CSL_RECEIVER_ENABLE
 static uint32_t      sCslPeriod;
 static uint32_t      sCslSampleTime;
@@ -139,15 +212,38 @@ typedef enum
 static uint32_t sPendingEvents;
 
 #if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
-static uint32_t         sMacFrameCounter;
-static uint32_t         sPrevMacFrameCounter;
-static uint8_t          sKeyId;
-static otMacKeyMaterial sPrevKey;
-static otMacKeyMaterial sCurrKey;
-static otMacKeyMaterial sNextKey;
+// Keys are double-buffered: the thread context fills the inactive set and publishes it by switching the index, so
+// the radio interrupt always reads a complete set without locking.
+typedef struct
+{
+    uint8_t          mKeyId; // Key index of the current key.
+    otMacKeyMaterial mPrevKey;
+    otMacKeyMaterial mCurrKey;
+    otMacKeyMaterial mNextKey;
+} RadioKeySet;
+
+static RadioKeySet      sKeySets[2];
+static volatile uint8_t sKeySetActive;
+
+// Frame counters are kept per key index (modulo the number of slots) rather than per role, so a key rotation by one
+// only clears the counter of the new key while the counter of the previous key keeps running.
+static volatile uint32_t     sMacFrameCounters[NRF5_RADIO_KEY_SLOTS];
+static PlatformRadioKeyStats sKeyStats;
+
+static inline uint8_t keySlot(uint8_t aKeyId)
+{
+    return aKeyId % NRF5_RADIO_KEY_SLOTS;
+}
+
 static bool             sAckedWithSecEnhAck;
 static uint32_t         sAckFrameCounter;
 static uint8_t          sAckKeyId;
+
+static bool     sReceiveAtScheduled;
+static uint32_t sReceiveAtStart;
+static uint32_t sReceiveAtEnd;
+static bool     sTransmitAtScheduled;
+static uint32_t sTransmitAtTime;
 #endif
 
 static int8_t GetTransmitPowerForChannel(uint8_t aChannel)
@@ -167,6 +263,375 @@ static int8_t GetTransmitPowerForChannel(uint8_t aChannel)
     return power;
 }
 
+#if RADIO_CONFIG_TPC_ENABLE || NRF_802154_ACK_DATA_PENDING_BIT_HOOK_ENABLED
+static bool macAddressEqual(const otMacAddress *aFirst, const otMacAddress *aSecond)
+{
+    bool equal = false;
+
+    if (aFirst->mType == aSecond->mType)
+    {
+        switch (aFirst->mType)
+        {
+        case OT_MAC_ADDRESS_TYPE_SHORT:
+            equal = (aFirst->mAddress.mShortAddress == aSecond->mAddress.mShortAddress);
+            break;
+
+        case OT_MAC_ADDRESS_TYPE_EXTENDED:
+            equal = (memcmp(&aFirst->mAddress.mExtAddress, &aSecond->mAddress.mExtAddress, sizeof(otExtAddress)) == 0);
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    return equal;
+}
+#endif
+
+#if RADIO_CONFIG_TPC_ENABLE
+static RadioTpcNeighbor *tpcNeighborFind(const otMacAddress *aAddress, bool aCreate)
+{
+    RadioTpcNeighbor *neighbor = NULL;
+    RadioTpcNeighbor *oldest   = &sTpcNeighbors[0];
+
+    otEXPECT(aAddress->mType == OT_MAC_ADDRESS_TYPE_EXTENDED ||
+             (aAddress->mType == OT_MAC_ADDRESS_TYPE_SHORT && aAddress->mAddress.mShortAddress != 0xffff));
+
+    for (size_t i = 0; i < otARRAY_LENGTH(sTpcNeighbors); i++)
+    {
+        if (macAddressEqual(&sTpcNeighbors[i].mAddress, aAddress))
+        {
+            neighbor = &sTpcNeighbors[i];
+            break;
+        }
+
+        // Free entries are reused first, then the least recently used one.
+        if (oldest->mAddress.mType != OT_MAC_ADDRESS_TYPE_NONE &&
+            (sTpcNeighbors[i].mAddress.mType == OT_MAC_ADDRESS_TYPE_NONE ||
+             sTpcNeighbors[i].mLastUsed < oldest->mLastUsed))
+        {
+            oldest = &sTpcNeighbors[i];
+        }
+    }
+
+    if (neighbor == NULL && aCreate)
+    {
+        neighbor = oldest;
+        memset(neighbor, 0, sizeof(*neighbor));
+        neighbor->mAddress = *aAddress;
+        neighbor->mTxPower = OT_RADIO_POWER_INVALID;
+    }
+
+    otEXPECT(neighbor != NULL);
+    neighbor->mLastUsed = ++sTpcUseCount;
+
+exit:
+    return neighbor;
+}
+
+/**
+ * Update the link estimate of a neighbor with a frame received from it.
+ *
+ * The neighbor is assumed to transmit with the power set for the channel. The power needed to reach it is then lower
+ * than that power by the RSSI excess over the receive sensitivity increased by the link margin.
+ *
+ */
+static void tpcLinkUpdate(const otMacAddress *aAddress, int8_t aRssi, uint8_t aLqi)
+{
+    RadioTpcNeighbor *neighbor     = tpcNeighborFind(aAddress, true);
+    int16_t           channelPower = GetTransmitPowerForChannel(nrf_802154_channel_get());
+    int16_t           target;
+
+    otEXPECT(neighbor != NULL);
+
+    if (neighbor->mTxPower == OT_RADIO_POWER_INVALID)
+    {
+        neighbor->mRssi    = (int16_t)(aRssi * (1 << kTpcRssiFracBits));
+        neighbor->mLqi     = aLqi;
+        neighbor->mTxPower = (int8_t)channelPower;
+    }
+    else
+    {
+        neighbor->mRssi += (aRssi * (1 << kTpcRssiFracBits) - neighbor->mRssi) / (1 << kTpcAverageShift);
+        neighbor->mLqi = (uint8_t)(neighbor->mLqi + (aLqi - neighbor->mLqi) / (1 << kTpcAverageShift));
+    }
+
+    sTpcStats.mUpdates++;
+
+    target = channelPower - ((neighbor->mRssi >> kTpcRssiFracBits) -
+                             (NRF528XX_RECEIVE_SENSITIVITY + RADIO_CONFIG_TPC_LINK_MARGIN));
+
+    if (target < RADIO_CONFIG_TPC_MIN_POWER)
+    {
+        target = RADIO_CONFIG_TPC_MIN_POWER;
+    }
+
+    if (target > channelPower || neighbor->mLqi < RADIO_CONFIG_TPC_MIN_LQI)
+    {
+        target = channelPower;
+    }
+
+    if (target > neighbor->mTxPower)
+    {
+        neighbor->mTxPower = (int8_t)target;
+        sTpcStats.mIncreases++;
+    }
+    else if (target <= neighbor->mTxPower - RADIO_CONFIG_TPC_HYSTERESIS)
+    {
+        neighbor->mTxPower = (int8_t)target;
+        sTpcStats.mDecreases++;
+    }
+
+exit:
+    return;
+}
+
+static void tpcTxNoAck(const otRadioFrame *aFrame)
+{
+    otMacAddress      address;
+    RadioTpcNeighbor *neighbor;
+    int8_t            channelPower = GetTransmitPowerForChannel(aFrame->mChannel);
+
+    otEXPECT(otMacFrameGetDstAddr(aFrame, &address) == OT_ERROR_NONE);
+    neighbor = tpcNeighborFind(&address, false);
+    otEXPECT(neighbor != NULL && neighbor->mTxPower < channelPower);
+
+    neighbor->mTxPower = channelPower;
+    sTpcStats.mNoAckRestores++;
+
+exit:
+    return;
+}
+
+static int8_t tpcTxPowerGet(const otRadioFrame *aFrame)
+{
+    otMacAddress            address;
+    const RadioTpcNeighbor *neighbor;
+    int8_t                  channelPower = GetTransmitPowerForChannel(aFrame->mChannel);
+    int8_t                  power        = channelPower;
+
+    if (otMacFrameGetDstAddr(aFrame, &address) == OT_ERROR_NONE)
+    {
+        CRITICAL_REGION_ENTER();
+
+        neighbor = tpcNeighborFind(&address, false);
+
+        if (neighbor != NULL && neighbor->mTxPower < channelPower)
+        {
+            power = neighbor->mTxPower;
+        }
+
+        CRITICAL_REGION_EXIT();
+    }
+
+    if (power < channelPower)
+    {
+        sTpcStats.mReducedFrames++;
+        sTpcStats.mReductionTotal += (uint32_t)(channelPower - power);
+    }
+    else
+    {
+        sTpcStats.mFullFrames++;
+    }
+
+    return power;
+}
+
+static void tpcTxDone(void)
+{
+    nrf_802154_tx_power_frame_set(INT8_MAX);
+}
+#endif // RADIO_CONFIG_TPC_ENABLE
+
+static RadioCcaChannel *ccaChannelGet(uint8_t aChannel)
+{
+    RadioCcaChannel *channel = NULL;
+
+    if (aChannel >= OT_RADIO_2P4GHZ_OQPSK_CHANNEL_MIN && aChannel <= OT_RADIO_2P4GHZ_OQPSK_CHANNEL_MAX)
+    {
+        channel = &sCcaChannels[aChannel - OT_RADIO_2P4GHZ_OQPSK_CHANNEL_MIN];
+    }
+
+    return channel;
+}
+
+static void ccaTransmitCount(nrf_802154_tx_error_t aError)
+{
+    RadioCcaChannel *channel = ccaChannelGet(sTransmitFrame.mChannel);
+
+    otEXPECT(sTransmitCca && channel != NULL);
+
+    switch (aError)
+    {
+    case NRF_802154_TX_ERROR_NONE:
+    case NRF_802154_TX_ERROR_INVALID_ACK:
+    case NRF_802154_TX_ERROR_NO_MEM:
+    case NRF_802154_TX_ERROR_NO_ACK:
+        channel->mIdle++;
+        break;
+
+    case NRF_802154_TX_ERROR_BUSY_CHANNEL:
+        channel->mBusy++;
+        break;
+
+    default:
+        break;
+    }
+
+exit:
+    return;
+}
+
+#if RADIO_CONFIG_CCA_ADAPTIVE_ENABLE
+static int8_t ccaAdaptiveThresholdGet(const RadioCcaChannel *aChannel)
+{
+    int16_t threshold = (aChannel->mNoiseFloor >> kCcaFloorFracBits) + RADIO_CONFIG_CCA_ADAPTIVE_MARGIN;
+
+    if (threshold < NRF528XX_MIN_CCA_ED_THRESHOLD)
+    {
+        threshold = NRF528XX_MIN_CCA_ED_THRESHOLD;
+    }
+    else if (threshold > RADIO_CONFIG_CCA_ADAPTIVE_MAX_THRESHOLD)
+    {
+        threshold = RADIO_CONFIG_CCA_ADAPTIVE_MAX_THRESHOLD;
+    }
+
+    return (int8_t)threshold;
+}
+#endif
+
+/**
+ * Apply the CCA energy detection threshold for a channel, keeping the configured CCA mode.
+ *
+ */
+static void ccaThresholdApply(uint8_t aChannel)
+{
+    nrf_802154_cca_cfg_t ccaConfig;
+    uint8_t              edThreshold = sCcaEdThreshold;
+
+#if RADIO_CONFIG_CCA_ADAPTIVE_ENABLE
+    const RadioCcaChannel *channel = ccaChannelGet(aChannel);
+
+    if (sCcaAdaptive && channel != NULL && channel->mNoiseFloor != kCcaFloorInvalid)
+    {
+        edThreshold = nrf_802154_ccaedthres_from_dbm_calculate(ccaAdaptiveThresholdGet(channel));
+    }
+#else
+    OT_UNUSED_VARIABLE(aChannel);
+#endif
+
+    nrf_802154_cca_cfg_get(&ccaConfig);
+    otEXPECT(ccaConfig.ed_threshold != edThreshold);
+
+    ccaConfig.ed_threshold = edThreshold;
+    nrf_802154_cca_cfg_set(&ccaConfig);
+
+exit:
+    return;
+}
+
+#if RADIO_CONFIG_CCA_ADAPTIVE_ENABLE
+/**
+ * Update the noise floor of a channel with an RSSI or energy detection sample.
+ *
+ * The floor follows lower samples quickly and higher ones slowly, so that frames on the channel barely move it while
+ * a lasting increase of the noise is still tracked.
+ *
+ */
+static void ccaNoiseFloorUpdate(uint8_t aChannel, int8_t aSample)
+{
+    RadioCcaChannel *channel = ccaChannelGet(aChannel);
+    int16_t          sample  = (int16_t)(aSample * (1 << kCcaFloorFracBits));
+
+    otEXPECT(channel != NULL);
+
+    if (channel->mNoiseFloor == kCcaFloorInvalid)
+    {
+        channel->mNoiseFloor = sample;
+    }
+    else if (sample < channel->mNoiseFloor)
+    {
+        channel->mNoiseFloor += (sample - channel->mNoiseFloor) / (1 << kCcaFloorFallShift);
+    }
+    else
+    {
+        channel->mNoiseFloor += (sample - channel->mNoiseFloor) / (1 << kCcaFloorRiseShift);
+    }
+
+    if (aChannel == nrf_802154_channel_get())
+    {
+        ccaThresholdApply(aChannel);
+    }
+
+exit:
+    return;
+}
+#endif // RADIO_CONFIG_CCA_ADAPTIVE_ENABLE
+
+#if RADIO_CONFIG_CCA_ADAPTIVE_ENABLE || RADIO_CONFIG_CHANNEL_MAP_ENABLE
+/**
+ * Sample the energy on the receive channel while the radio is idle in receive state.
+ *
+ * The noise floor of the adaptive CCA threshold and the channel map keep their own sample intervals, but share a
+ * single measurement whenever both are due.
+ *
+ */
+static void idleRssiSample(void)
+{
+    uint64_t now    = nrf5AlarmGetCurrentTime();
+    bool     ccaDue = false;
+    bool     mapDue = false;
+    uint8_t  channel;
+    int8_t   rssi;
+
+#if RADIO_CONFIG_CCA_ADAPTIVE_ENABLE
+    ccaDue = sCcaAdaptive && (now - sCcaLastSample) >= RADIO_CONFIG_CCA_ADAPTIVE_SAMPLE_INTERVAL * US_PER_MS;
+#endif
+#if RADIO_CONFIG_CHANNEL_MAP_ENABLE
+    mapDue = (now - sChannelMapLastSample) >= RADIO_CONFIG_CHANNEL_MAP_SAMPLE_INTERVAL * US_PER_MS;
+#endif
+
+    otEXPECT(ccaDue || mapDue);
+    otEXPECT(nrf_802154_state_get() == NRF_802154_STATE_RECEIVE);
+
+    channel = nrf_802154_channel_get();
+
+#if RADIO_CONFIG_CCA_ADAPTIVE_ENABLE
+    if (ccaDue)
+    {
+        sCcaLastSample = now;
+    }
+#endif
+#if RADIO_CONFIG_CHANNEL_MAP_ENABLE
+    if (mapDue)
+    {
+        sChannelMapLastSample = now;
+    }
+#endif
+
+    otEXPECT(nrf_802154_rssi_measure_begin());
+    rssi = nrf_802154_rssi_last_get();
+    otEXPECT(rssi != NRF_802154_RSSI_INVALID);
+
+#if RADIO_CONFIG_CCA_ADAPTIVE_ENABLE
+    if (ccaDue)
+    {
+        ccaNoiseFloorUpdate(channel, rssi);
+    }
+#endif
+#if RADIO_CONFIG_CHANNEL_MAP_ENABLE
+    if (mapDue)
+    {
+        nrf5ChannelMapEdSample(channel, rssi);
+    }
+#endif
+
+exit:
+    return;
+}
+#endif // RADIO_CONFIG_CCA_ADAPTIVE_ENABLE || RADIO_CONFIG_CHANNEL_MAP_ENABLE
+
 static void dataInit(void)
 {
     sDisabled = true;
@@ -191,7 +656,21 @@ static void dataInit(void)
 
     memset(&sAckFrame, 0, sizeof(sAckFrame));
 
-    sPrevMacFrameCounter = 0;
+#if RADIO_CONFIG_TPC_ENABLE
+    nrf5RadioTpcReset();
+#endif
+
+    nrf5RadioCcaStatsReset();
+#if RADIO_CONFIG_CCA_ADAPTIVE_ENABLE
+    sCcaAdaptive = true;
+#endif
+
+    nrf5LinkEstimatorReset();
+    nrf5ChannelMapReset();
+
+#if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
+    sMacFrameCounters[keySlot((uint8_t)(sKeySets[sKeySetActive].mKeyId - 1))] = 0;
+#endif
 }
 
 static void convertShortAddress(uint8_t *aTo, uint16_t aFrom)
@@ -256,37 +735,129 @@ static inline void clearPendingEvents(void)
     } while (__STREXW(pendingEvents, (uint32_t *)&sPendingEvents));
 }
 
-#if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
-static void txAckProcessSecurity(uint8_t *aAckFrame)
+#if NRF_802154_HFCLK_WARM_ENABLED
+static void hfxoRadioSleep(void)
 {
-    otRadioFrame      ackFrame;
-    otMacKeyMaterial *key = NULL;
-    uint8_t           keyId;
+    uint32_t now      = otPlatAlarmMicroGetNow();
+    uint32_t prestart = 0;
 
-    sAckedWithSecEnhAck = false;
-    otEXPECT(aAckFrame[SECURITY_ENABLED_OFFSET] & SECURITY_ENABLED_BIT);
+#if RADIO_CONFIG_HFXO_PRESTART_ALARM
+    uint64_t deadline = nrf5AlarmGetNextStackDeadline();
 
-    memset(&ackFrame, 0, sizeof(ackFrame));
-    ackFrame.mPsdu   = &aAckFrame[1];
-    ackFrame.mLength = aAckFrame[0];
+    // The stack often transmits when its alarm fires (e.g. a data poll), so have the HFXO ready by then. Scheduled
+    // receptions and transmissions are pre-started by the radio driver itself.
+    if (deadline > 0 && deadline < INT32_MAX)
+    {
+        prestart = (uint32_t)deadline;
+    }
+#endif
 
-    keyId = otMacFrameGetKeyId(&ackFrame);
+    sHfxoRadioIdle     = true;
+    sHfxoRadioIdleTime = now;
 
-    otEXPECT(otMacFrameIsKeyIdMode1(&ackFrame) && keyId != 0);
+    nrf_802154_hfclk_warm_request(now, sHfxoKeepWarm, prestart, RADIO_CONFIG_HFXO_PRESTART_HOLD);
+}
+
+static void hfxoRadioWake(void)
+{
+    uint32_t gap;
+    int32_t  target = 0;
+
+    otEXPECT(sHfxoRadioIdle);
+    sHfxoRadioIdle = false;
+
+    gap = otPlatAlarmMicroGetNow() - sHfxoRadioIdleTime;
+
+    // Idle gaps short enough to keep the HFXO warm across pull the threshold up to them with a margin, longer gaps
+    // pull it down to zero, so the HFXO is kept warm only while radio operations follow each other closely.
+    if (gap <= RADIO_CONFIG_HFXO_KEEP_WARM_MAX)
+    {
+        target = (int32_t)(gap + gap / 2);
+
+        if (target > RADIO_CONFIG_HFXO_KEEP_WARM_MAX)
+        {
+            target = RADIO_CONFIG_HFXO_KEEP_WARM_MAX;
+        }
+    }
+
+    sHfxoKeepWarm = (uint32_t)((int32_t)sHfxoKeepWarm + ((target - (int32_t)sHfxoKeepWarm) >> kHfxoGapShift));
+
+exit:
+    return;
+}
+#endif // NRF_802154_HFCLK_WARM_ENABLED
+
+#if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
+static uint32_t frameCounterAllocate(uint8_t aKeyId)
+{
+    volatile uint32_t *counter = &sMacFrameCounters[keySlot(aKeyId)];
+    uint32_t           frameCounter;
+
+    do
+    {
+        frameCounter = __LDREXW((uint32_t *)counter);
+    } while (__STREXW(frameCounter + 1, (uint32_t *)counter));
+
+    if (frameCounter == RADIO_CONFIG_MAC_FRAME_COUNTER_WATERMARK)
+    {
+        nrf5RadioFrameCounterWatermarkReached(aKeyId, frameCounter);
+    }
+
+    return frameCounter;
+}
+
+static const otMacKeyMaterial *keyFind(const RadioKeySet *aKeySet, uint8_t aKeyId)
+{
+    const otMacKeyMaterial *key = NULL;
 
-    if (keyId == sKeyId)
+    if (aKeyId == aKeySet->mKeyId)
     {
-        key              = &sCurrKey;
-        sAckFrameCounter = sMacFrameCounter++;
+        key = &aKeySet->mCurrKey;
     }
-    else if (keyId == sKeyId - 1)
+    else if (aKeyId == aKeySet->mKeyId - 1)
     {
-        key              = &sPrevKey;
-        sAckFrameCounter = sPrevMacFrameCounter++;
+        key = &aKeySet->mPrevKey;
     }
-    else if (keyId == sKeyId + 1)
+    else if (aKeyId == aKeySet->mKeyId + 1)
+    {
+        key = &aKeySet->mNextKey;
+    }
+
+    return key;
+}
+
+static const otMacKeyMaterial *transmitKeyGet(otRadioFrame *aFrame)
+{
+    // The key may have rotated since the frame counter was set, so secure the frame with the key it names.
+    const RadioKeySet      *keySet = &sKeySets[sKeySetActive];
+    const otMacKeyMaterial *key    = keyFind(keySet, otMacFrameGetKeyId(aFrame));
+
+    return (key != NULL) ? key : &keySet->mCurrKey;
+}
+
+static void txAckProcessSecurity(uint8_t *aAckFrame)
+{
+    const RadioKeySet      *keySet = &sKeySets[sKeySetActive];
+    otRadioFrame            ackFrame;
+    const otMacKeyMaterial *key;
+    uint8_t                 keyId;
+
+    sAckedWithSecEnhAck = false;
+    otEXPECT(aAckFrame[SECURITY_ENABLED_OFFSET] & SECURITY_ENABLED_BIT);
+
+    memset(&ackFrame, 0, sizeof(ackFrame));
+    ackFrame.mPsdu   = &aAckFrame[1];
+    ackFrame.mLength = aAckFrame[0];
+
+    keyId = otMacFrameGetKeyId(&ackFrame);
+
+    otEXPECT(otMacFrameIsKeyIdMode1(&ackFrame) && keyId != 0);
+
+    key = keyFind(keySet, keyId);
+    otEXPECT_ACTION(key != NULL, sKeyStats.mUnknownKeyIds++);
+
+    if (key == &keySet->mNextKey)
     {
-        key = &sNextKey;
         // Openthread does not maintain future frame counter.
         // Mac frame counter would be overwritten after key rotation leading to
         // frames being dropped due to counter value lower than in acks.
@@ -294,9 +865,11 @@ static void txAckProcessSecurity(uint8_t *aAckFrame)
     }
     else
     {
-        otEXPECT(false);
+        sAckFrameCounter = frameCounterAllocate(keyId);
     }
 
+    sKeyStats.mKeys[keySlot(keyId)].mEnhAcks++;
+
     sAckKeyId           = keyId;
     sAckedWithSecEnhAck = true;
 
@@ -366,11 +939,20 @@ void otPlatRadioSetShortAddress(otInstance *aInstance, uint16_t aShortAddress)
 
 void nrf5RadioInit(void)
 {
+    nrf_802154_cca_cfg_t ccaConfig;
+
     dataInit();
 #if OPENTHREAD_CONFIG_MLE_LINK_METRICS_SUBJECT_ENABLE
     otLinkMetricsInit(NRF528XX_RECEIVE_SENSITIVITY);
 #endif
     nrf_802154_init();
+    nrf_802154_cca_cfg_get(&ccaConfig);
+    sCcaEdThreshold = ccaConfig.ed_threshold;
+    nrf_802154_rx_filter_frame_types_set(RADIO_CONFIG_RX_FILTER_FRAME_TYPES);
+    nrf_802154_rx_filter_beacon_req_interval_set(RADIO_CONFIG_RX_FILTER_BEACON_REQUEST_INTERVAL);
+#if NRF_802154_ANT_DIVERSITY_ENABLED
+    nrf_802154_antenna_diversity_mode_set(RADIO_CONFIG_ANT_DIVERSITY_MODE);
+#endif
 }
 
 void nrf5RadioDeinit(void)
@@ -378,6 +960,8 @@ void nrf5RadioDeinit(void)
     nrf_802154_sleep();
     nrf_802154_deinit();
     sPendingEvents = 0;
+
+    nrf5WatchdogCheckDisarm(kWatchdogCheckRadio);
 }
 
 void nrf5RadioClearPendingEvents(void)
@@ -473,10 +1057,15 @@ otError otPlatRadioSleep(otInstance *aInstance)
 {
     OT_UNUSED_VARIABLE(aInstance);
 
+    nrf5TraceRecord(kTraceEventRadioSleep, 0);
+
     if (nrf_802154_sleep_if_idle() == NRF_802154_SLEEP_ERROR_NONE)
     {
         nrf5FemDisable();
         clearPendingEvents();
+#if NRF_802154_HFCLK_WARM_ENABLED
+        hfxoRadioSleep();
+#endif
     }
     else
     {
@@ -493,11 +1082,19 @@ otError otPlatRadioReceive(otInstance *aInstance, uint8_t aChannel)
 
     bool result;
 
+    nrf5TraceRecord(kTraceEventRadioReceive, aChannel);
+
     nrf_802154_channel_set(aChannel);
+#if RADIO_CONFIG_CCA_ADAPTIVE_ENABLE
+    ccaThresholdApply(aChannel);
+#endif
     if (nrf_802154_state_get() == NRF_802154_STATE_SLEEP)
     {
         // Enable FEM before RADIO leaving SLEEP state.
         nrf5FemEnable();
+#if NRF_802154_HFCLK_WARM_ENABLED
+        hfxoRadioWake();
+#endif
     }
 
     nrf_802154_tx_power_set(GetTransmitPowerForChannel(aChannel));
@@ -518,6 +1115,13 @@ otError otPlatRadioReceiveAt(otInstance *aInstance, uint8_t aChannel, uint32_t a
     result = nrf_802154_receive_at(aStart - SAFE_DELTA, SAFE_DELTA, aDuration, aChannel);
     clearPendingEvents();
 
+    if (result)
+    {
+        sReceiveAtScheduled = true;
+        sReceiveAtStart     = aStart;
+        sReceiveAtEnd       = aStart + aDuration;
+    }
+
     return result ? OT_ERROR_NONE : OT_ERROR_FAILED;
 }
 #endif
@@ -529,26 +1133,60 @@ otError otPlatRadioTransmit(otInstance *aInstance, otRadioFrame *aFrame)
 
     aFrame->mPsdu[-1] = aFrame->mLength;
 
+    nrf5TraceRecord(kTraceEventRadioTransmit, (uint16_t)((aFrame->mChannel << 8) | aFrame->mLength));
+
+    nrf5WatchdogCheckArm(kWatchdogCheckRadio, WATCHDOG_RADIO_TIMEOUT_MS);
+
     if (nrf_802154_state_get() == NRF_802154_STATE_SLEEP)
     {
         // Enable FEM before RADIO leaving SLEEP state.
         nrf5FemEnable();
+#if NRF_802154_HFCLK_WARM_ENABLED
+        hfxoRadioWake();
+#endif
     }
 
+#if RADIO_CONFIG_TPC_ENABLE
+    // Limits only the frame itself; ACKs sent while it waits for the channel keep the channel power.
+    nrf_802154_tx_power_frame_set(tpcTxPowerGet(aFrame));
+#endif
+
+#if RADIO_CONFIG_CCA_ADAPTIVE_ENABLE
+    ccaThresholdApply(aFrame->mChannel);
+#endif
+    sTransmitCca = aFrame->mInfo.mTxInfo.mCsmaCaEnabled;
+
 #if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
     if (otMacFrameIsSecurityEnabled(aFrame) && otMacFrameIsKeyIdMode1(aFrame) && !aFrame->mInfo.mTxInfo.mIsARetx)
     {
-        otMacFrameSetKeyId(aFrame, sKeyId);
-        otMacFrameSetFrameCounter(aFrame, sMacFrameCounter++);
+        uint8_t keyId = sKeySets[sKeySetActive].mKeyId;
+
+        otMacFrameSetKeyId(aFrame, keyId);
+        otMacFrameSetFrameCounter(aFrame, frameCounterAllocate(keyId));
+        sKeyStats.mKeys[keySlot(keyId)].mFrames++;
     }
 
     if (aFrame->mInfo.mTxInfo.mTxDelay != 0)
     {
+        sTransmitCca = true;
+
         if (!nrf_802154_transmit_raw_at(&aFrame->mPsdu[-1], true, aFrame->mInfo.mTxInfo.mTxDelayBaseTime,
                                         aFrame->mInfo.mTxInfo.mTxDelay, aFrame->mChannel))
         {
             error = OT_ERROR_INVALID_STATE;
         }
+        else
+        {
+            int32_t untilStart;
+
+            sTransmitAtScheduled = true;
+            sTransmitAtTime      = aFrame->mInfo.mTxInfo.mTxDelayBaseTime + aFrame->mInfo.mTxInfo.mTxDelay;
+
+            // The result is only due once the transmission has started at the scheduled time.
+            untilStart = (int32_t)(sTransmitAtTime - (uint32_t)otPlatTimeGet());
+            nrf5WatchdogCheckArm(kWatchdogCheckRadio,
+                                 (untilStart > 0 ? (uint32_t)untilStart / US_PER_MS : 0) + WATCHDOG_RADIO_TIMEOUT_MS);
+        }
     }
     else
 #endif
@@ -568,6 +1206,14 @@ otError otPlatRadioTransmit(otInstance *aInstance, otRadioFrame *aFrame)
     clearPendingEvents();
     otPlatRadioTxStarted(aInstance, aFrame);
 
+    if (!result || (error != OT_ERROR_NONE))
+    {
+        nrf5WatchdogCheckDisarm(kWatchdogCheckRadio);
+#if RADIO_CONFIG_TPC_ENABLE
+        tpcTxDone();
+#endif
+    }
+
     if (!result)
     {
         setPendingEvent(kPendingEventChannelAccessFailure);
@@ -724,13 +1370,19 @@ otError otPlatRadioEnergyScan(otInstance *aInstance, uint8_t aScanChannel, uint1
 {
     OT_UNUSED_VARIABLE(aInstance);
 
+    nrf5TraceRecord(kTraceEventRadioEnergyScan, aScanChannel);
+
     sEnergyDetectionTime    = (uint32_t)aScanDuration * 1000UL;
     sEnergyDetectionChannel = aScanChannel;
 
+    nrf5WatchdogCheckArm(kWatchdogCheckRadio, aScanDuration + WATCHDOG_RADIO_TIMEOUT_MS);
+
     clearPendingEvents();
 
     nrf_802154_channel_set(aScanChannel);
 
+    sEnergyDetectionStart = otPlatAlarmMicroGetNow();
+
     if (nrf_802154_energy_detection(sEnergyDetectionTime))
     {
         resetPendingEvent(kPendingEventEnergyDetectionStart);
@@ -779,8 +1431,7 @@ otError otPlatRadioGetCcaEnergyDetectThreshold(otInstance *aInstance, int8_t *aT
 {
     OT_UNUSED_VARIABLE(aInstance);
 
-    otError              error = OT_ERROR_NONE;
-    nrf_802154_cca_cfg_t ccaConfig;
+    otError error = OT_ERROR_NONE;
 
     if (aThreshold == NULL)
     {
@@ -788,9 +1439,8 @@ otError otPlatRadioGetCcaEnergyDetectThreshold(otInstance *aInstance, int8_t *aT
     }
     else
     {
-        nrf_802154_cca_cfg_get(&ccaConfig);
         // The radio driver has no function to convert ED threshold to dBm
-        *aThreshold = (int8_t)ccaConfig.ed_threshold + NRF528XX_MIN_CCA_ED_THRESHOLD - sLnaGain;
+        *aThreshold = (int8_t)sCcaEdThreshold + NRF528XX_MIN_CCA_ED_THRESHOLD - sLnaGain;
     }
 
     return error;
@@ -800,8 +1450,7 @@ otError otPlatRadioSetCcaEnergyDetectThreshold(otInstance *aInstance, int8_t aTh
 {
     OT_UNUSED_VARIABLE(aInstance);
 
-    otError              error = OT_ERROR_NONE;
-    nrf_802154_cca_cfg_t ccaConfig;
+    otError error = OT_ERROR_NONE;
 
     aThreshold += sLnaGain;
 
@@ -812,11 +1461,7 @@ otError otPlatRadioSetCcaEnergyDetectThreshold(otInstance *aInstance, int8_t aTh
     }
     else
     {
-        memset(&ccaConfig, 0, sizeof(ccaConfig));
-        ccaConfig.mode         = NRF_RADIO_CCA_MODE_ED;
-        ccaConfig.ed_threshold = nrf_802154_ccaedthres_from_dbm_calculate(aThreshold);
-
-        nrf_802154_cca_cfg_set(&ccaConfig);
+        nrf5RadioCcaEdThresholdSet(nrf_802154_ccaedthres_from_dbm_calculate(aThreshold));
     }
 
     return error;
@@ -964,6 +1609,13 @@ void nrf5RadioProcess(otInstance *aInstance)
     {
         resetPendingEvent(kPendingEventEnergyDetected);
 
+#if RADIO_CONFIG_CCA_ADAPTIVE_ENABLE
+        ccaNoiseFloorUpdate(sEnergyDetectionChannel, sEnergyDetected);
+#endif
+#if RADIO_CONFIG_CHANNEL_MAP_ENABLE
+        nrf5ChannelMapEdSample(sEnergyDetectionChannel, sEnergyDetected);
+#endif
+
         otPlatRadioEnergyScanDone(aInstance, sEnergyDetected);
     }
 
@@ -973,6 +1625,27 @@ void nrf5RadioProcess(otInstance *aInstance)
         {
             nrf5FemDisable();
             resetPendingEvent(kPendingEventSleep);
+#if NRF_802154_HFCLK_WARM_ENABLED
+            hfxoRadioSleep();
+#endif
+        }
+        else
+        {
+            isEventPending = true;
+        }
+    }
+
+    if (isPendingEventSet(kPendingEventEnergyDetectionStart))
+    {
+        nrf_802154_channel_set(sEnergyDetectionChannel);
+
+        sEnergyDetectionStart = otPlatAlarmMicroGetNow();
+
+        if (nrf_802154_energy_detection(sEnergyDetectionTime))
+        {
+            resetPendingEvent(kPendingEventEnergyDetectionStart);
+            nrf5WatchdogCheckArm(kWatchdogCheckRadio,
+                                 (uint32_t)(sEnergyDetectionTime / US_PER_MS) + WATCHDOG_RADIO_TIMEOUT_MS);
         }
         else
         {
@@ -980,130 +1653,556 @@ void nrf5RadioProcess(otInstance *aInstance)
         }
     }
 
-    if (isPendingEventSet(kPendingEventEnergyDetectionStart))
-    {
-        nrf_802154_channel_set(sEnergyDetectionChannel);
+#if RADIO_CONFIG_CCA_ADAPTIVE_ENABLE || RADIO_CONFIG_CHANNEL_MAP_ENABLE
+    idleRssiSample();
+#endif
+
+    if (isEventPending)
+    {
+        otSysEventSignalPending();
+    }
+}
+
+void nrf_802154_received_timestamp_raw(uint8_t *p_data, int8_t power, uint8_t lqi, uint32_t time)
+{
+    otRadioFrame *receivedFrame = NULL;
+
+    nrf5TraceRecord(kTraceEventRadioReceived, p_data[0]);
+
+    for (uint32_t i = 0; i < NRF_802154_RX_BUFFERS; i++)
+    {
+        if (sReceivedFrames[i].mPsdu == NULL)
+        {
+            receivedFrame = &sReceivedFrames[i];
+
+            memset(receivedFrame, 0, sizeof(*receivedFrame));
+            break;
+        }
+    }
+
+    assert(receivedFrame != NULL);
+
+    receivedFrame->mPsdu               = &p_data[1];
+    receivedFrame->mLength             = p_data[0];
+    receivedFrame->mInfo.mRxInfo.mRssi = power;
+    receivedFrame->mInfo.mRxInfo.mLqi  = lqi;
+    receivedFrame->mChannel            = nrf_802154_channel_get();
+
+#if RADIO_CONFIG_CHANNEL_MAP_ENABLE
+    nrf5ChannelMapRxResult(receivedFrame->mChannel, false);
+#endif
+
+#if RADIO_CONFIG_TPC_ENABLE || RADIO_CONFIG_LINK_ESTIMATOR_ENABLE
+    {
+        otMacAddress srcAddress;
+
+        if (otMacFrameGetSrcAddr(receivedFrame, &srcAddress) == OT_ERROR_NONE)
+        {
+#if RADIO_CONFIG_TPC_ENABLE
+            tpcLinkUpdate(&srcAddress, power, lqi);
+#endif
+#if RADIO_CONFIG_LINK_ESTIMATOR_ENABLE
+            nrf5LinkEstimatorRxFrame(&srcAddress, power, lqi);
+#endif
+        }
+    }
+#endif
+
+    // Inform if this frame was acknowledged with frame pending set.
+    if (p_data[ACK_REQUEST_OFFSET] & ACK_REQUEST_BIT)
+    {
+        receivedFrame->mInfo.mRxInfo.mAckedWithFramePending = sAckedWithFramePending;
+    }
+    else
+    {
+        receivedFrame->mInfo.mRxInfo.mAckedWithFramePending = false;
+    }
+
+    // Get the timestamp when the SFD was received.
+#if !NRF_802154_TX_STARTED_NOTIFY_ENABLED
+#error "NRF_802154_TX_STARTED_NOTIFY_ENABLED is required!"
+#endif
+    uint32_t offset =
+        (int32_t)otPlatAlarmMicroGetNow() - (int32_t)nrf_802154_first_symbol_timestamp_get(time, p_data[0]);
+    receivedFrame->mInfo.mRxInfo.mTimestamp = nrf5AlarmGetCurrentTime() - offset;
+
+    sAckedWithFramePending = false;
+
+#if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
+    // Inform if this frame was acknowledged with secured Enh-ACK.
+    if (p_data[ACK_REQUEST_OFFSET] & ACK_REQUEST_BIT && otMacFrameIsVersion2015(receivedFrame))
+    {
+        receivedFrame->mInfo.mRxInfo.mAckedWithSecEnhAck = sAckedWithSecEnhAck;
+        receivedFrame->mInfo.mRxInfo.mAckFrameCounter    = sAckFrameCounter;
+        receivedFrame->mInfo.mRxInfo.mAckKeyId           = sAckKeyId;
+    }
+
+    sAckedWithSecEnhAck = false;
+#endif
+
+    otSysEventSignalPending();
+}
+
+void nrf_802154_receive_failed(nrf_802154_rx_error_t error)
+{
+    nrf5TraceRecord(kTraceEventRadioReceiveFailed, error);
+
+    switch (error)
+    {
+    case NRF_802154_RX_ERROR_INVALID_FRAME:
+    case NRF_802154_RX_ERROR_DELAYED_TIMEOUT:
+        sReceiveError = OT_ERROR_NO_FRAME_RECEIVED;
+        break;
+
+    case NRF_802154_RX_ERROR_INVALID_FCS:
+        sReceiveError = OT_ERROR_FCS;
+#if RADIO_CONFIG_LINK_ESTIMATOR_ENABLE
+        nrf5LinkEstimatorRxCrcError();
+#endif
+#if RADIO_CONFIG_CHANNEL_MAP_ENABLE
+        nrf5ChannelMapRxResult(nrf_802154_channel_get(), true);
+#endif
+        break;
+
+    case NRF_802154_RX_ERROR_INVALID_DEST_ADDR:
+        sReceiveError = OT_ERROR_DESTINATION_ADDRESS_FILTERED;
+        break;
+
+    case NRF_802154_RX_ERROR_RUNTIME:
+    case NRF_802154_RX_ERROR_TIMESLOT_ENDED:
+    case NRF_802154_RX_ERROR_ABORTED:
+    case NRF_802154_RX_ERROR_DELAYED_TIMESLOT_DENIED:
+    case NRF_802154_RX_ERROR_INVALID_LENGTH:
+    case NRF_802154_RX_ERROR_DELAYED_ABORTED:
+        sReceiveError = OT_ERROR_FAILED;
+        break;
+
+    default:
+        assert(false);
+    }
+
+    sAckedWithFramePending = false;
+#if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
+    sAckedWithSecEnhAck = false;
+#endif
+
+#if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
+    if ((error == NRF_802154_RX_ERROR_DELAYED_TIMEOUT) || (error == NRF_802154_RX_ERROR_TIMESLOT_ENDED))
+    {
+        sReceiveError = OT_ERROR_NONE;
+        setPendingEvent(kPendingEventSleep);
+    }
+    else
+#endif
+    {
+        setPendingEvent(kPendingEventReceiveFailed);
+    }
+}
+
+#if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
+static bool windowIsNear(bool *aScheduled, uint32_t aStart, uint32_t aEnd, uint32_t aNow, uint32_t aDuration)
+{
+    bool near = false;
+
+    otEXPECT(*aScheduled);
+
+    // Forget windows which ended long ago, so that the 32-bit time comparison below stays valid.
+    otEXPECT_ACTION((int32_t)(aEnd - aNow) > -IDLE_GUARD_TIME_US, *aScheduled = false);
+
+    near = ((int32_t)(aStart - aNow) < (int32_t)(aDuration + IDLE_GUARD_TIME_US));
+
+exit:
+    return near;
+}
+#endif
+
+bool nrf5RadioIsIdleFor(uint32_t aDuration)
+{
+    bool               idle  = false;
+    nrf_802154_state_t state = nrf_802154_state_get();
+
+    otEXPECT((state == NRF_802154_STATE_SLEEP) || (state == NRF_802154_STATE_RECEIVE));
+
+#if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
+    {
+        uint32_t now = otPlatAlarmMicroGetNow();
+
+        otEXPECT(!windowIsNear(&sReceiveAtScheduled, sReceiveAtStart, sReceiveAtEnd, now, aDuration));
+        otEXPECT(!windowIsNear(&sTransmitAtScheduled, sTransmitAtTime, sTransmitAtTime, now, aDuration));
+
+#if OPENTHREAD_CONFIG_MAC_CSL_RECEIVER_ENABLE
+        if (sCslPeriod > 0)
+        {
+            uint32_t cslPeriodInUs = sCslPeriod * OT_US_PER_TEN_SYMBOLS;
+            uint32_t untilSample =
+                (cslPeriodInUs - (now % cslPeriodInUs) + (sCslSampleTime % cslPeriodInUs)) % cslPeriodInUs;
+
+            // The next CSL sample window is scheduled by the MAC shortly before it opens, account for it already.
+            otEXPECT(untilSample > aDuration + IDLE_GUARD_TIME_US);
+            otEXPECT(cslPeriodInUs - untilSample > IDLE_GUARD_TIME_US);
+        }
+#endif
+    }
+#endif
+
+    idle = true;
+
+exit:
+    return idle;
+}
+
+#if RADIO_CONFIG_TPC_ENABLE
+void nrf5RadioTpcStatsGet(PlatformRadioTpcStats *aStats)
+{
+    CRITICAL_REGION_ENTER();
+    *aStats = sTpcStats;
+    CRITICAL_REGION_EXIT();
+}
+
+void nrf5RadioTpcReset(void)
+{
+    CRITICAL_REGION_ENTER();
+
+    memset(sTpcNeighbors, 0, sizeof(sTpcNeighbors));
+    memset(&sTpcStats, 0, sizeof(sTpcStats));
+    sTpcUseCount = 0;
+
+    CRITICAL_REGION_EXIT();
+}
+
+otError nrf5RadioTpcNeighborGet(uint8_t aIndex, PlatformRadioTpcNeighbor *aNeighbor)
+{
+    otError error = OT_ERROR_NONE;
+
+    otEXPECT_ACTION(aIndex < otARRAY_LENGTH(sTpcNeighbors), error = OT_ERROR_INVALID_ARGS);
+
+    CRITICAL_REGION_ENTER();
+
+    if (sTpcNeighbors[aIndex].mAddress.mType == OT_MAC_ADDRESS_TYPE_NONE)
+    {
+        error = OT_ERROR_NOT_FOUND;
+    }
+    else
+    {
+        aNeighbor->mAddress = sTpcNeighbors[aIndex].mAddress;
+        aNeighbor->mRssi    = (int8_t)(sTpcNeighbors[aIndex].mRssi >> kTpcRssiFracBits);
+        aNeighbor->mLqi     = sTpcNeighbors[aIndex].mLqi;
+        aNeighbor->mTxPower = sTpcNeighbors[aIndex].mTxPower;
+    }
+
+    CRITICAL_REGION_EXIT();
+
+exit:
+    return error;
+}
+#else  // RADIO_CONFIG_TPC_ENABLE
+void nrf5RadioTpcStatsGet(PlatformRadioTpcStats *aStats)
+{
+    memset(aStats, 0, sizeof(*aStats));
+}
+
+void nrf5RadioTpcReset(void)
+{
+}
+
+otError nrf5RadioTpcNeighborGet(uint8_t aIndex, PlatformRadioTpcNeighbor *aNeighbor)
+{
+    OT_UNUSED_VARIABLE(aIndex);
+    OT_UNUSED_VARIABLE(aNeighbor);
+
+    return OT_ERROR_NOT_CAPABLE;
+}
+#endif // RADIO_CONFIG_TPC_ENABLE
+
+otError nrf5RadioCcaChannelStatsGet(uint8_t aChannel, PlatformRadioCcaChannelStats *aStats)
+{
+    otError                error   = OT_ERROR_NONE;
+    const RadioCcaChannel *channel = ccaChannelGet(aChannel);
+
+    otEXPECT_ACTION(channel != NULL, error = OT_ERROR_INVALID_ARGS);
+
+    aStats->mBusy       = channel->mBusy;
+    aStats->mIdle       = channel->mIdle;
+    aStats->mNoiseFloor = OT_RADIO_RSSI_INVALID;
+    aStats->mThreshold  = OT_RADIO_RSSI_INVALID;
+
+#if RADIO_CONFIG_CCA_ADAPTIVE_ENABLE
+    if (channel->mNoiseFloor != kCcaFloorInvalid)
+    {
+        aStats->mNoiseFloor = (int8_t)(channel->mNoiseFloor >> kCcaFloorFracBits);
+
+        if (sCcaAdaptive)
+        {
+            aStats->mThreshold = ccaAdaptiveThresholdGet(channel);
+        }
+    }
+#endif
+
+exit:
+    return error;
+}
+
+void nrf5RadioCcaStatsReset(void)
+{
+    memset(sCcaChannels, 0, sizeof(sCcaChannels));
+
+#if RADIO_CONFIG_CCA_ADAPTIVE_ENABLE
+    for (size_t i = 0; i < otARRAY_LENGTH(sCcaChannels); i++)
+    {
+        sCcaChannels[i].mNoiseFloor = kCcaFloorInvalid;
+    }
+#endif
+}
+
+void nrf5RadioCcaEdThresholdSet(uint8_t aEdThreshold)
+{
+    sCcaEdThreshold = aEdThreshold;
+    ccaThresholdApply(nrf_802154_channel_get());
+}
+
+#if RADIO_CONFIG_CCA_ADAPTIVE_ENABLE
+otError nrf5RadioCcaAdaptiveSet(bool aEnable)
+{
+    sCcaAdaptive = aEnable;
+    ccaThresholdApply(nrf_802154_channel_get());
+
+    return OT_ERROR_NONE;
+}
+
+bool nrf5RadioCcaAdaptiveIsEnabled(void)
+{
+    return sCcaAdaptive;
+}
+#else  // RADIO_CONFIG_CCA_ADAPTIVE_ENABLE
+otError nrf5RadioCcaAdaptiveSet(bool aEnable)
+{
+    OT_UNUSED_VARIABLE(aEnable);
+
+    return OT_ERROR_NOT_CAPABLE;
+}
+
+bool nrf5RadioCcaAdaptiveIsEnabled(void)
+{
+    return false;
+}
+#endif // RADIO_CONFIG_CCA_ADAPTIVE_ENABLE
+
+#if NRF_802154_ACK_DATA_PENDING_BIT_HOOK_ENABLED
+otError nrf5RadioPendingQueuesSet(PlatformRadioPendingQueue *aQueues, uint16_t aLength)
+{
+    CRITICAL_REGION_ENTER();
+
+    sPendingQueues       = (aLength > 0) ? aQueues : NULL;
+    sPendingQueuesLength = aLength;
+
+    CRITICAL_REGION_EXIT();
+
+    return OT_ERROR_NONE;
+}
+
+void nrf5RadioPendingStatsGet(PlatformRadioPendingStats *aStats)
+{
+    CRITICAL_REGION_ENTER();
+    *aStats = sPendingStats;
+    CRITICAL_REGION_EXIT();
+}
+
+void nrf5RadioPendingStatsReset(void)
+{
+    CRITICAL_REGION_ENTER();
+    memset(&sPendingStats, 0, sizeof(sPendingStats));
+    CRITICAL_REGION_EXIT();
+}
+#else  // NRF_802154_ACK_DATA_PENDING_BIT_HOOK_ENABLED
+otError nrf5RadioPendingQueuesSet(PlatformRadioPendingQueue *aQueues, uint16_t aLength)
+{
+    OT_UNUSED_VARIABLE(aQueues);
+    OT_UNUSED_VARIABLE(aLength);
+
+    return OT_ERROR_NOT_CAPABLE;
+}
+
+void nrf5RadioPendingStatsGet(PlatformRadioPendingStats *aStats)
+{
+    memset(aStats, 0, sizeof(*aStats));
+}
+
+void nrf5RadioPendingStatsReset(void)
+{
+}
+#endif // NRF_802154_ACK_DATA_PENDING_BIT_HOOK_ENABLED
+
+#if NRF_802154_PREEMPTION_POLICY_ENABLED
+otError nrf5RadioPreemptionPrioritySet(PlatformRadioOpClass aClass, uint8_t aPriority)
+{
+    otError error = OT_ERROR_NONE;
+
+    otEXPECT_ACTION(aClass < kRadioNumOpClasses, error = OT_ERROR_INVALID_ARGS);
 
-        if (nrf_802154_energy_detection(sEnergyDetectionTime))
-        {
-            resetPendingEvent(kPendingEventEnergyDetectionStart);
-        }
-        else
-        {
-            isEventPending = true;
-        }
-    }
+    nrf_802154_preemption_priority_set((nrf_802154_op_class_t)aClass, aPriority);
 
-    if (isEventPending)
-    {
-        otSysEventSignalPending();
-    }
+exit:
+    return error;
 }
 
-void nrf_802154_received_timestamp_raw(uint8_t *p_data, int8_t power, uint8_t lqi, uint32_t time)
+otError nrf5RadioPreemptionPriorityGet(PlatformRadioOpClass aClass, uint8_t *aPriority)
 {
-    otRadioFrame *receivedFrame = NULL;
+    otError error = OT_ERROR_NONE;
 
-    for (uint32_t i = 0; i < NRF_802154_RX_BUFFERS; i++)
-    {
-        if (sReceivedFrames[i].mPsdu == NULL)
-        {
-            receivedFrame = &sReceivedFrames[i];
+    otEXPECT_ACTION(aClass < kRadioNumOpClasses, error = OT_ERROR_INVALID_ARGS);
 
-            memset(receivedFrame, 0, sizeof(*receivedFrame));
-            break;
-        }
-    }
+    *aPriority = nrf_802154_preemption_priority_get((nrf_802154_op_class_t)aClass);
 
-    assert(receivedFrame != NULL);
+exit:
+    return error;
+}
 
-    receivedFrame->mPsdu               = &p_data[1];
-    receivedFrame->mLength             = p_data[0];
-    receivedFrame->mInfo.mRxInfo.mRssi = power;
-    receivedFrame->mInfo.mRxInfo.mLqi  = lqi;
-    receivedFrame->mChannel            = nrf_802154_channel_get();
+otError nrf5RadioPreemptionStatsGet(PlatformRadioPreemptionStats *aStats)
+{
+    nrf_802154_preemption_stats_t stats;
 
-    // Inform if this frame was acknowledged with frame pending set.
-    if (p_data[ACK_REQUEST_OFFSET] & ACK_REQUEST_BIT)
-    {
-        receivedFrame->mInfo.mRxInfo.mAckedWithFramePending = sAckedWithFramePending;
-    }
-    else
+    nrf_802154_preemption_stats_get(&stats);
+
+    for (uint8_t i = 0; i < kRadioNumOpClasses; i++)
     {
-        receivedFrame->mInfo.mRxInfo.mAckedWithFramePending = false;
+        aStats->mPreempted[i] = stats.preempted[i];
+        aStats->mDenied[i]    = stats.denied[i];
     }
 
-    // Get the timestamp when the SFD was received.
-#if !NRF_802154_TX_STARTED_NOTIFY_ENABLED
-#error "NRF_802154_TX_STARTED_NOTIFY_ENABLED is required!"
-#endif
-    uint32_t offset =
-        (int32_t)otPlatAlarmMicroGetNow() - (int32_t)nrf_802154_first_symbol_timestamp_get(time, p_data[0]);
-    receivedFrame->mInfo.mRxInfo.mTimestamp = nrf5AlarmGetCurrentTime() - offset;
+    return OT_ERROR_NONE;
+}
 
-    sAckedWithFramePending = false;
+void nrf5RadioPreemptionStatsReset(void)
+{
+    nrf_802154_preemption_stats_reset();
+}
 
-#if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
-    // Inform if this frame was acknowledged with secured Enh-ACK.
-    if (p_data[ACK_REQUEST_OFFSET] & ACK_REQUEST_BIT && otMacFrameIsVersion2015(receivedFrame))
-    {
-        receivedFrame->mInfo.mRxInfo.mAckedWithSecEnhAck = sAckedWithSecEnhAck;
-        receivedFrame->mInfo.mRxInfo.mAckFrameCounter    = sAckFrameCounter;
-        receivedFrame->mInfo.mRxInfo.mAckKeyId           = sAckKeyId;
-    }
+void nrf_802154_preemption_notify(nrf_802154_op_class_t requested, nrf_802154_op_class_t ongoing, bool granted)
+{
+    nrf5RadioPreemptionNotify((PlatformRadioOpClass)requested, (PlatformRadioOpClass)ongoing, granted);
+}
+#else  // NRF_802154_PREEMPTION_POLICY_ENABLED
+otError nrf5RadioPreemptionPrioritySet(PlatformRadioOpClass aClass, uint8_t aPriority)
+{
+    OT_UNUSED_VARIABLE(aClass);
+    OT_UNUSED_VARIABLE(aPriority);
 
-    sAckedWithSecEnhAck = false;
-#endif
+    return OT_ERROR_NOT_CAPABLE;
+}
 
-    otSysEventSignalPending();
+otError nrf5RadioPreemptionPriorityGet(PlatformRadioOpClass aClass, uint8_t *aPriority)
+{
+    OT_UNUSED_VARIABLE(aClass);
+    OT_UNUSED_VARIABLE(aPriority);
+
+    return OT_ERROR_NOT_CAPABLE;
 }
 
-void nrf_802154_receive_failed(nrf_802154_rx_error_t error)
+otError nrf5RadioPreemptionStatsGet(PlatformRadioPreemptionStats *aStats)
 {
-    switch (error)
-    {
-    case NRF_802154_RX_ERROR_INVALID_FRAME:
-    case NRF_802154_RX_ERROR_DELAYED_TIMEOUT:
-        sReceiveError = OT_ERROR_NO_FRAME_RECEIVED;
-        break;
+    memset(aStats, 0, sizeof(*aStats));
 
-    case NRF_802154_RX_ERROR_INVALID_FCS:
-        sReceiveError = OT_ERROR_FCS;
-        break;
+    return OT_ERROR_NOT_CAPABLE;
+}
 
-    case NRF_802154_RX_ERROR_INVALID_DEST_ADDR:
-        sReceiveError = OT_ERROR_DESTINATION_ADDRESS_FILTERED;
-        break;
+void nrf5RadioPreemptionStatsReset(void)
+{
+}
+#endif // NRF_802154_PREEMPTION_POLICY_ENABLED
 
-    case NRF_802154_RX_ERROR_RUNTIME:
-    case NRF_802154_RX_ERROR_TIMESLOT_ENDED:
-    case NRF_802154_RX_ERROR_ABORTED:
-    case NRF_802154_RX_ERROR_DELAYED_TIMESLOT_DENIED:
-    case NRF_802154_RX_ERROR_INVALID_LENGTH:
-    case NRF_802154_RX_ERROR_DELAYED_ABORTED:
-        sReceiveError = OT_ERROR_FAILED;
-        break;
+#if NRF_802154_HFCLK_WARM_ENABLED
+otError nrf5RadioHfxoStatsGet(PlatformRadioHfxoStats *aStats)
+{
+    nrf_802154_hfclk_warm_stats_t stats;
 
-    default:
-        assert(false);
-    }
+    nrf_802154_hfclk_warm_stats_get(&stats);
 
-    sAckedWithFramePending = false;
-#if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
-    sAckedWithSecEnhAck = false;
-#endif
+    aStats->mPrestarts    = stats.prestarts;
+    aStats->mHits         = stats.hits;
+    aStats->mMisses       = stats.misses;
+    aStats->mKeepWarm     = sHfxoKeepWarm;
+    aStats->mLatencySaved = stats.latency_saved;
+    aStats->mWarmTime     = stats.warm_time;
+    aStats->mExtraCharge  = stats.warm_time * RADIO_CONFIG_HFXO_CURRENT / 1000;
+
+    return OT_ERROR_NONE;
+}
+
+void nrf5RadioHfxoStatsReset(void)
+{
+    nrf_802154_hfclk_warm_stats_reset();
+}
+#else  // NRF_802154_HFCLK_WARM_ENABLED
+otError nrf5RadioHfxoStatsGet(PlatformRadioHfxoStats *aStats)
+{
+    memset(aStats, 0, sizeof(*aStats));
+
+    return OT_ERROR_NOT_CAPABLE;
+}
+
+void nrf5RadioHfxoStatsReset(void)
+{
+}
+#endif // NRF_802154_HFCLK_WARM_ENABLED
 
 #if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
-    if ((error == NRF_802154_RX_ERROR_DELAYED_TIMEOUT) || (error == NRF_802154_RX_ERROR_TIMESLOT_ENDED))
+otError nrf5RadioKeyStatsGet(PlatformRadioKeyStats *aStats)
+{
+    CRITICAL_REGION_ENTER();
+
+    *aStats = sKeyStats;
+
+    for (uint8_t i = 0; i < NRF5_RADIO_KEY_SLOTS; i++)
     {
-        sReceiveError = OT_ERROR_NONE;
-        setPendingEvent(kPendingEventSleep);
+        aStats->mKeys[i].mFrameCounter = sMacFrameCounters[i];
     }
-    else
-#endif
+
+    CRITICAL_REGION_EXIT();
+
+    return OT_ERROR_NONE;
+}
+
+void nrf5RadioKeyStatsReset(void)
+{
+    CRITICAL_REGION_ENTER();
+
+    sKeyStats.mRotations     = 0;
+    sKeyStats.mUnknownKeyIds = 0;
+
+    for (uint8_t i = 0; i < NRF5_RADIO_KEY_SLOTS; i++)
     {
-        setPendingEvent(kPendingEventReceiveFailed);
+        sKeyStats.mKeys[i].mFrames  = 0;
+        sKeyStats.mKeys[i].mEnhAcks = 0;
     }
+
+    CRITICAL_REGION_EXIT();
+}
+#else  // OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
+otError nrf5RadioKeyStatsGet(PlatformRadioKeyStats *aStats)
+{
+    memset(aStats, 0, sizeof(*aStats));
+
+    return OT_ERROR_NOT_CAPABLE;
+}
+
+void nrf5RadioKeyStatsReset(void)
+{
+}
+#endif // OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
+
+OT_TOOL_WEAK void nrf5RadioFrameCounterWatermarkReached(uint8_t aKeyId, uint32_t aFrameCounter)
+{
+    OT_UNUSED_VARIABLE(aKeyId);
+    OT_UNUSED_VARIABLE(aFrameCounter);
+}
+
+OT_TOOL_WEAK void nrf5RadioPreemptionNotify(PlatformRadioOpClass aRequested,
+                                            PlatformRadioOpClass aOngoing,
+                                            bool                 aGranted)
+{
+    OT_UNUSED_VARIABLE(aRequested);
+    OT_UNUSED_VARIABLE(aOngoing);
+    OT_UNUSED_VARIABLE(aGranted);
 }
 
 #if OPENTHREAD_CONFIG_MAC_CSL_RECEIVER_ENABLE
@@ -1130,6 +2229,8 @@ void nrf_802154_tx_ack_started(uint8_t *p_data, int8_t power, uint8_t lqi)
 
     OT_UNUSED_VARIABLE(ackFrame);
 
+    nrf5TraceRecord(kTraceEventRadioTxAckStarted, p_data[0]);
+
     ackFrame.mPsdu   = (uint8_t *)(p_data + 1);
     ackFrame.mLength = p_data[0];
 
@@ -1147,6 +2248,9 @@ void nrf_802154_tx_ack_started(uint8_t *p_data, int8_t power, uint8_t lqi)
 
 #if OPENTHREAD_CONFIG_MLE_LINK_METRICS_SUBJECT_ENABLE
     otMacFrameGetDstAddr(&ackFrame, &macAddress);
+#if RADIO_CONFIG_LINK_ESTIMATOR_ENABLE && RADIO_CONFIG_LINK_ESTIMATOR_ENH_ACK
+    nrf5LinkEstimatorSmooth(&macAddress, &power, &lqi);
+#endif
     if ((linkMetricsDataLen = otLinkMetricsEnhAckGenData(&macAddress, lqi, power, linkMetricsData)) > 0)
     {
         otMacFrameSetEnhAckProbingIe(&ackFrame, linkMetricsData, linkMetricsDataLen);
@@ -1157,6 +2261,54 @@ void nrf_802154_tx_ack_started(uint8_t *p_data, int8_t power, uint8_t lqi)
 #endif
 }
 
+#if NRF_802154_ACK_DATA_PENDING_BIT_HOOK_ENABLED
+bool nrf_802154_ack_pending_bit_decide(const uint8_t *p_frame, bool table_pending)
+{
+    PlatformRadioPendingQueue *queues  = sPendingQueues;
+    PlatformRadioPendingQueue *queue   = NULL;
+    uint16_t                   length  = sPendingQueuesLength;
+    bool                       pending = table_pending;
+    otRadioFrame               frame;
+    otMacAddress               srcAddress;
+
+    otEXPECT(queues != NULL);
+
+    frame.mPsdu   = (uint8_t *)(p_frame + 1);
+    frame.mLength = p_frame[0];
+    otEXPECT(otMacFrameGetSrcAddr(&frame, &srcAddress) == OT_ERROR_NONE);
+
+    for (uint16_t i = 0; i < length; i++)
+    {
+        if (macAddressEqual(&queues[i].mAddress, &srcAddress))
+        {
+            queue = &queues[i];
+            break;
+        }
+    }
+
+    otEXPECT_ACTION(queue != NULL, sPendingStats.mFallbacks++);
+
+    pending = (queue->mFrames > 0);
+    sPendingStats.mDecisions++;
+
+    // The source match tables lag behind the queues, count how often their answer would have been wrong.
+    if (pending != table_pending)
+    {
+        if (table_pending)
+        {
+            sPendingStats.mFalsePending++;
+        }
+        else
+        {
+            sPendingStats.mMissedPending++;
+        }
+    }
+
+exit:
+    return pending;
+}
+#endif // NRF_802154_ACK_DATA_PENDING_BIT_HOOK_ENABLED
+
 void nrf_802154_transmitted_timestamp_raw(const uint8_t *aFrame,
                                           uint8_t       *aAckPsdu,
                                           int8_t         aPower,
@@ -1166,6 +2318,9 @@ void nrf_802154_transmitted_timestamp_raw(const uint8_t *aFrame,
     OT_UNUSED_VARIABLE(aFrame); // For ARM gcc
     assert(aFrame == sTransmitPsdu);
 
+    nrf5TraceRecord(kTraceEventRadioTransmitted, (aAckPsdu == NULL) ? 0 : aAckPsdu[0]);
+    nrf5WatchdogCheckDisarm(kWatchdogCheckRadio);
+
     if (aAckPsdu == NULL)
     {
         sAckFrame.mPsdu = NULL;
@@ -1181,8 +2336,29 @@ void nrf_802154_transmitted_timestamp_raw(const uint8_t *aFrame,
         sAckFrame.mInfo.mRxInfo.mRssi      = aPower;
         sAckFrame.mInfo.mRxInfo.mLqi       = aLqi;
         sAckFrame.mChannel                 = nrf_802154_channel_get();
+
+#if RADIO_CONFIG_TPC_ENABLE || RADIO_CONFIG_LINK_ESTIMATOR_ENABLE
+        otMacAddress dstAddress;
+
+        if (otMacFrameGetDstAddr(&sTransmitFrame, &dstAddress) == OT_ERROR_NONE)
+        {
+#if RADIO_CONFIG_TPC_ENABLE
+            tpcLinkUpdate(&dstAddress, aPower, aLqi);
+#endif
+#if RADIO_CONFIG_LINK_ESTIMATOR_ENABLE
+            nrf5LinkEstimatorRxFrame(&dstAddress, aPower, aLqi);
+            nrf5LinkEstimatorTxDone(&dstAddress, true);
+#endif
+        }
+#endif
     }
 
+#if RADIO_CONFIG_TPC_ENABLE
+    tpcTxDone();
+#endif
+
+    ccaTransmitCount(NRF_802154_TX_ERROR_NONE);
+
     setPendingEvent(kPendingEventFrameTransmitted);
 }
 
@@ -1191,6 +2367,32 @@ void nrf_802154_transmit_failed(const uint8_t *aFrame, nrf_802154_tx_error_t err
     OT_UNUSED_VARIABLE(aFrame); // For ARM gcc
     assert(aFrame == sTransmitPsdu);
 
+    nrf5TraceRecord(kTraceEventRadioTransmitFailed, error);
+    nrf5WatchdogCheckDisarm(kWatchdogCheckRadio);
+
+#if RADIO_CONFIG_TPC_ENABLE
+    if (error == NRF_802154_TX_ERROR_NO_ACK)
+    {
+        tpcTxNoAck(&sTransmitFrame);
+    }
+
+    tpcTxDone();
+#endif
+
+#if RADIO_CONFIG_LINK_ESTIMATOR_ENABLE
+    if (error == NRF_802154_TX_ERROR_NO_ACK || error == NRF_802154_TX_ERROR_INVALID_ACK)
+    {
+        otMacAddress dstAddress;
+
+        if (otMacFrameGetDstAddr(&sTransmitFrame, &dstAddress) == OT_ERROR_NONE)
+        {
+            nrf5LinkEstimatorTxDone(&dstAddress, false);
+        }
+    }
+#endif
+
+    ccaTransmitCount(error);
+
     switch (error)
     {
     case NRF_802154_TX_ERROR_BUSY_CHANNEL:
@@ -1213,11 +2415,45 @@ void nrf_802154_transmit_failed(const uint8_t *aFrame, nrf_802154_tx_error_t err
 
 void nrf_802154_energy_detected(uint8_t result)
 {
+    nrf5TraceRecord(kTraceEventRadioEnergyDetected, result);
+
     sEnergyDetected = nrf_802154_dbm_from_energy_level_calculate(result);
 
+    nrf5WatchdogCheckDisarm(kWatchdogCheckRadio);
+
     setPendingEvent(kPendingEventEnergyDetected);
 }
 
+void nrf_802154_energy_detection_failed(nrf_802154_ed_error_t error)
+{
+    uint32_t elapsed = otPlatAlarmMicroGetNow() - sEnergyDetectionStart;
+
+    nrf5TraceRecord(kTraceEventRadioScanAborted, error);
+
+    // The scan was preempted by an operation of a higher priority, resume it for the remaining time so that the
+    // stack still gets its result.
+    if (sEnergyDetectionTime > elapsed + ED_MIN_TIME_US)
+    {
+        sEnergyDetectionTime -= elapsed;
+    }
+    else
+    {
+        sEnergyDetectionTime = ED_MIN_TIME_US;
+    }
+
+    setPendingEvent(kPendingEventEnergyDetectionStart);
+}
+
+#if RADIO_CONFIG_CHANNEL_MAP_ENABLE
+void nrf_802154_csma_ca_cca_done(const uint8_t *p_frame, bool channel_free)
+{
+    OT_UNUSED_VARIABLE(p_frame); // For ARM gcc
+    assert(p_frame == sTransmitPsdu);
+
+    nrf5ChannelMapCcaResult(sTransmitFrame.mChannel, !channel_free);
+}
+#endif
+
 int8_t otPlatRadioGetReceiveSensitivity(otInstance *aInstance)
 {
     OT_UNUSED_VARIABLE(aInstance);
@@ -1233,6 +2469,8 @@ void nrf_802154_tx_started(const uint8_t *aFrame)
     assert(aFrame == sTransmitPsdu);
     OT_UNUSED_VARIABLE(aFrame);
 
+    nrf5TraceRecord(kTraceEventRadioTxStarted, 0);
+
 #if OPENTHREAD_CONFIG_MAC_CSL_RECEIVER_ENABLE
     if ((sCslPeriod > 0) && !sTransmitFrame.mInfo.mTxInfo.mIsARetx)
     {
@@ -1264,7 +2502,7 @@ void nrf_802154_tx_started(const uint8_t *aFrame)
     otEXPECT(otMacFrameIsSecurityEnabled(&sTransmitFrame) && otMacFrameIsKeyIdMode1(&sTransmitFrame) &&
              !sTransmitFrame.mInfo.mTxInfo.mIsSecurityProcessed);
 
-    sTransmitFrame.mInfo.mTxInfo.mAesKey = &sCurrKey;
+    sTransmitFrame.mInfo.mTxInfo.mAesKey = transmitKeyGet(&sTransmitFrame);
 
     processSecurity = true;
 #endif // OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
@@ -1300,6 +2538,17 @@ uint64_t otPlatRadioGetNow(otInstance *aInstance)
 }
 
 #if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
+static void keySlotAssign(uint8_t aKeyId)
+{
+    PlatformRadioKeyUsage *usage = &sKeyStats.mKeys[keySlot(aKeyId)];
+
+    if (usage->mKeyId != aKeyId)
+    {
+        memset(usage, 0, sizeof(*usage));
+        usage->mKeyId = aKeyId;
+    }
+}
+
 void otPlatRadioSetMacKey(otInstance             *aInstance,
                           uint8_t                 aKeyIdMode,
                           uint8_t                 aKeyId,
@@ -1311,43 +2560,82 @@ void otPlatRadioSetMacKey(otInstance             *aInstance,
     OT_UNUSED_VARIABLE(aInstance);
     OT_UNUSED_VARIABLE(aKeyIdMode);
 
+    uint8_t      index  = sKeySetActive ^ 1;
+    RadioKeySet *keySet = &sKeySets[index];
+    uint8_t      keyId  = sKeySets[sKeySetActive].mKeyId;
+
     assert(aKeyType == OT_KEY_TYPE_LITERAL_KEY);
     assert(aPrevKey != NULL && aCurrKey != NULL && aNextKey != NULL);
 
-    CRITICAL_REGION_ENTER();
+    // Only the radio interrupt reads the keys and it never runs concurrently with the thread context, so the
+    // inactive set is not in use.
+    keySet->mKeyId   = aKeyId;
+    keySet->mPrevKey = *aPrevKey;
+    keySet->mCurrKey = *aCurrKey;
+    keySet->mNextKey = *aNextKey;
+
+    if (aKeyId == (uint8_t)(keyId + 1))
+    {
+        // The counter of the new key is not used until the switch, as the interrupt secures ACKs with the next key
+        // with a zero frame counter. The counter of the former key keeps running as the counter of the previous key.
+        sMacFrameCounters[keySlot(aKeyId)] = 0;
+        sKeyStats.mRotations++;
+    }
+    else if (aKeyId != keyId)
+    {
+        // Any other key change carries the frame counter over to the new current and previous keys.
+        CRITICAL_REGION_ENTER();
+        sMacFrameCounters[keySlot(aKeyId)]                = sMacFrameCounters[keySlot(keyId)];
+        sMacFrameCounters[keySlot((uint8_t)(aKeyId - 1))] = sMacFrameCounters[keySlot(keyId)];
+        CRITICAL_REGION_EXIT();
+    }
 
-    sKeyId               = aKeyId;
-    sPrevKey             = *aPrevKey;
-    sCurrKey             = *aCurrKey;
-    sNextKey             = *aNextKey;
-    sPrevMacFrameCounter = sMacFrameCounter;
+    keySlotAssign((uint8_t)(aKeyId - 1));
+    keySlotAssign(aKeyId);
+    keySlotAssign((uint8_t)(aKeyId + 1));
 
-    CRITICAL_REGION_EXIT();
+    __DMB();
+    sKeySetActive = index;
 }
 
 void otPlatRadioSetMacFrameCounter(otInstance *aInstance, uint32_t aMacFrameCounter)
 {
     OT_UNUSED_VARIABLE(aInstance);
 
-    CRITICAL_REGION_ENTER();
+    uint8_t            keyId   = sKeySets[sKeySetActive].mKeyId;
+    volatile uint32_t *counter = &sMacFrameCounters[keySlot(keyId)];
 
-    sMacFrameCounter = aMacFrameCounter;
+    if (*counter < RADIO_CONFIG_MAC_FRAME_COUNTER_WATERMARK &&
+        aMacFrameCounter > RADIO_CONFIG_MAC_FRAME_COUNTER_WATERMARK)
+    {
+        nrf5RadioFrameCounterWatermarkReached(keyId, aMacFrameCounter);
+    }
 
-    CRITICAL_REGION_EXIT();
+    *counter = aMacFrameCounter;
 }
 
 void otPlatRadioSetMacFrameCounterIfLarger(otInstance *aInstance, uint32_t aMacFrameCounter)
 {
     OT_UNUSED_VARIABLE(aInstance);
 
-    CRITICAL_REGION_ENTER();
+    uint8_t            keyId   = sKeySets[sKeySetActive].mKeyId;
+    volatile uint32_t *counter = &sMacFrameCounters[keySlot(keyId)];
+    uint32_t           frameCounter;
 
-    if (aMacFrameCounter > sMacFrameCounter)
+    do
+    {
+        frameCounter = __LDREXW((uint32_t *)counter);
+        otEXPECT_ACTION(aMacFrameCounter > frameCounter, __CLREX());
+    } while (__STREXW(aMacFrameCounter, (uint32_t *)counter));
+
+    if (frameCounter < RADIO_CONFIG_MAC_FRAME_COUNTER_WATERMARK &&
+        aMacFrameCounter > RADIO_CONFIG_MAC_FRAME_COUNTER_WATERMARK)
     {
-        sMacFrameCounter = aMacFrameCounter;
+        nrf5RadioFrameCounterWatermarkReached(keyId, aMacFrameCounter);
     }
 
-    CRITICAL_REGION_EXIT();
+exit:
+    return;
 }
 #endif // OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
 
@@ -1385,16 +2673,13 @@ static void updateIeData(otInstance *aInstance, otShortAddress aShortAddr, const
     convertShortAddress(shortAddr, aShortAddr);
     convertExtAddress(extAddr, aExtAddr);
 
-    if (offset > 0)
-    {
-        nrf_802154_ack_data_set(shortAddr, false, ackIeData, offset, NRF_802154_ACK_DATA_IE);
-        nrf_802154_ack_data_set(extAddr, true, ackIeData, offset, NRF_802154_ACK_DATA_IE);
-    }
-    else
-    {
-        nrf_802154_ack_data_clear(shortAddr, false, NRF_802154_ACK_DATA_IE);
-        nrf_802154_ack_data_clear(extAddr, true, NRF_802154_ACK_DATA_IE);
-    }
+    // Update both addresses of the neighbor in a single pass over the IE lists.
+    nrf_802154_ack_data_op_t ops[] = {
+        {.p_addr = shortAddr, .extended = false, .set = (offset > 0), .p_data = ackIeData, .length = (uint8_t)offset},
+        {.p_addr = extAddr, .extended = true, .set = (offset > 0), .p_data = ackIeData, .length = (uint8_t)offset},
+    };
+
+    nrf_802154_ack_data_update(ops, otARRAY_LENGTH(ops), NRF_802154_ACK_DATA_IE);
 }
 #endif // OPENTHREAD_CONFIG_MAC_CSL_RECEIVER_ENABLE || OPENTHREAD_CONFIG_MLE_LINK_METRICS_SUBJECT_ENABLE
 
@@ -100,5 +100,21 @@ void otSysSoftdeviceRaalConfig(const otSysSoftdeviceRaalConfigParams *aConfig)
     cfg.timeslot_safe_margin = aConfig->timeslotSafeMargin;
     cfg.lf_clk_accuracy_ppm  = aConfig->lfClkAccuracyPpm;
 
+    cfg.timeslot_adaptive_max_length = aConfig->timeslotAdaptiveMaxLength;
+
     nrf_raal_softdevice_config(&cfg);
 }
+
+void otSysSoftdeviceRaalStatsGet(otSysSoftdeviceRaalStats *aStats)
+{
+    nrf_raal_softdevice_stats_t stats;
+
+    nrf_raal_softdevice_stats_get(&stats);
+
+    aStats->grantedTime       = stats.granted_time_us;
+    aStats->grantedCount      = stats.granted_count;
+    aStats->deniedCount       = stats.denied_count;
+    aStats->extendFailedCount = stats.extend_failed_count;
+    aStats->preemptedCount    = stats.preempted_count;
+    aStats->timeslotLength    = stats.timeslot_length;
+}
@@ -41,6 +41,7 @@
 #include "platform-fem.h"
 #include "platform-nrf5-transport.h"
 #include "platform-nrf5.h"
+#include <app_util_platform.h>
 #include <nrf.h>
 #include <nrf_drv_clock.h>
 
@@ -57,8 +58,114 @@
 
 extern bool gPlatformPseudoResetWasRequested;
 
+static volatile uint32_t sBootMilestoneTimes[kBootNumMilestones]; ///< Times [us] of the boot milestones.
+static volatile uint32_t sBootMilestoneMask;                      ///< Boot milestones that have been reached.
+static bool              sBootHfclkRequested;                     ///< HFCLK is held by the boot sequence.
+
+static void bootHfclkHandler(nrf_drv_clock_evt_type_t aEvent)
+{
+    if (aEvent == NRF_DRV_CLOCK_EVT_HFCLK_STARTED)
+    {
+        nrf5BootMilestoneReached(kBootMilestoneHfclk);
+    }
+}
+
+static nrf_drv_clock_handler_item_t sBootHfclkHandlerItem = {
+    .p_next        = NULL,
+    .event_handler = bootHfclkHandler,
+};
+
+static void bootStart(void)
+{
+    sBootMilestoneMask = 0;
+
+    // Until LFCLK is running, boot milestones are timestamped with the CPU cycle counter. It counts wall time, as the
+    // CPU does not sleep before the RTC is started (see otSysPowerIdle()).
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    // Start HFXO now, so that it settles while the rest of the platform is initialized. The request is held until
+    // the crystal is running, after that the radio and the transport keep it on according to their own needs.
+    if (!sBootHfclkRequested)
+    {
+        sBootHfclkRequested = true;
+        nrf_drv_clock_hfclk_request(&sBootHfclkHandlerItem);
+    }
+}
+
+static void bootProcess(void)
+{
+    if (sBootHfclkRequested && (sBootMilestoneMask & (1UL << kBootMilestoneHfclk)))
+    {
+        sBootHfclkRequested = false;
+        nrf_drv_clock_hfclk_release();
+    }
+}
+
+static void bootStop(void)
+{
+    if (sBootHfclkRequested)
+    {
+        sBootHfclkRequested = false;
+        nrf_drv_clock_hfclk_release();
+    }
+}
+
+void nrf5BootMilestoneReached(PlatformBootMilestone aMilestone)
+{
+    uint32_t time;
+
+    CRITICAL_REGION_ENTER();
+
+    // The RTC is started together with the LFCLK milestone, so later milestones use the alarm time base.
+    if (sBootMilestoneMask & (1UL << kBootMilestoneLfclk))
+    {
+        time = sBootMilestoneTimes[kBootMilestoneLfclk] + (uint32_t)nrf5AlarmGetCurrentTime();
+    }
+    else
+    {
+        time = DWT->CYCCNT / (SystemCoreClock / 1000000UL);
+    }
+
+    if ((sBootMilestoneMask & (1UL << aMilestone)) == 0)
+    {
+        sBootMilestoneTimes[aMilestone] = time;
+        sBootMilestoneMask |= (1UL << aMilestone);
+    }
+
+    CRITICAL_REGION_EXIT();
+}
+
+uint32_t nrf5BootMilestoneTimeGet(PlatformBootMilestone aMilestone)
+{
+    uint32_t time = NRF5_BOOT_TIME_INVALID;
+
+    if ((aMilestone < kBootNumMilestones) && (sBootMilestoneMask & (1UL << aMilestone)))
+    {
+        time = sBootMilestoneTimes[aMilestone];
+    }
+
+    return time;
+}
+
+const char *nrf5BootMilestoneToString(PlatformBootMilestone aMilestone)
+{
+    static const char *const kMilestoneNames[] = {
+        "lfclk",     // kBootMilestoneLfclk
+        "hfclk",     // kBootMilestoneHfclk
+        "entropy",   // kBootMilestoneEntropy
+        "transport", // kBootMilestoneTransport
+        "init",      // kBootMilestoneInitDone
+    };
+
+    return (aMilestone < kBootNumMilestones) ? kMilestoneNames[aMilestone] : "unknown";
+}
+
 void __cxa_pure_virtual(void)
 {
+    nrf5CrashDumpSave(kCrashReasonPureVirtual, 0, 0, NULL);
+
     while (1)
         ;
 }
@@ -73,24 +180,26 @@ void otSysInit(int argc, char *argv[])
         otSysDeinit();
     }
 
-#if ((!SOFTDEVICE_PRESENT) && (NRF52840_XXAA))
-    // Enable I-code cache
-    NRF_NVMC->ICACHECNF = NVMC_ICACHECNF_CACHEEN_Enabled;
-#elif (DCDC_ENABLE)
-    NRF_POWER->DCDCEN = 1;
-#endif
+    nrf5PowerInit();
 
 #if !OPENTHREAD_CONFIG_ENABLE_BUILTIN_MBEDTLS_MANAGEMENT && PLATFORM_OPENTHREAD_VANILLA
+#if MBEDTLS_POOL_ENABLE
+    nrf5MbedtlsPoolInit();
+    mbedtls_platform_set_calloc_free(nrf5MbedtlsPoolCAlloc, nrf5MbedtlsPoolFree);
+#else
     mbedtls_platform_set_calloc_free(otHeapCAlloc, otHeapFree);
+#endif
     mbedtls_platform_setup(NULL);
 #endif
 
     nrf_drv_clock_init();
+    bootStart();
 
 #if (OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_PLATFORM_DEFINED)
     nrf5LogInit();
 #endif
     nrf5AlarmInit();
+    nrf5TraceInit();
     nrf5RandomInit();
     if (!gPlatformPseudoResetWasRequested)
     {
@@ -99,20 +208,27 @@ void otSysInit(int argc, char *argv[])
 #endif
     }
     nrf5TransportInit(gPlatformPseudoResetWasRequested);
+    nrf5CrashDumpInit();
     nrf5MiscInit();
+    nrf5WatchdogInit();
     nrf5RadioInit();
     nrf5TempInit();
     nrf5FemInit();
     nrf5CryptoInit();
+    nrf5ImageStagingInit();
+
+    nrf5BootMilestoneReached(kBootMilestoneInitDone);
 
     gPlatformPseudoResetWasRequested = false;
 }
 
 void otSysDeinit(void)
 {
+    nrf5PowerDeinit();
     nrf5FemDeinit();
     nrf5TempDeinit();
     nrf5RadioDeinit();
+    nrf5WatchdogDeinit();
     nrf5MiscDeinit();
     if (!gPlatformPseudoResetWasRequested)
     {
@@ -126,6 +242,7 @@ void otSysDeinit(void)
 #if (OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_PLATFORM_DEFINED)
     nrf5LogDeinit();
 #endif
+    bootStop();
 
 #if !OPENTHREAD_CONFIG_ENABLE_BUILTIN_MBEDTLS_MANAGEMENT && PLATFORM_OPENTHREAD_VANILLA
     mbedtls_platform_teardown(NULL);
@@ -143,6 +260,11 @@ void otSysProcessDrivers(otInstance *aInstance)
     nrf5TransportProcess();
     nrf5TempProcess();
     nrf5AlarmProcess(aInstance);
+    nrf5WatchdogProcess();
+    nrf5ImageStagingProcess();
+    nrf5FlashProcess();
+    nrf5TraceProcess();
+    bootProcess();
 }
 
 __WEAK void otSysEventSignalPending(void)
@@ -0,0 +1,220 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the binary trace of radio driver and platform events.
+ *
+ */
+
+#include <openthread-core-config.h>
+#include <openthread/config.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform-nrf5.h"
+
+#include <nrf.h>
+#include <utils/code_utils.h>
+
+#if PLATFORM_TRACE_RTT_ENABLE
+#include <SEGGER_RTT.h>
+#endif
+
+#if PLATFORM_TRACE_ENABLE
+
+#if (PLATFORM_TRACE_BUFFER_SIZE & (PLATFORM_TRACE_BUFFER_SIZE - 1)) != 0
+#error "PLATFORM_TRACE_BUFFER_SIZE must be a power of two"
+#endif
+
+// clang-format off
+#define TRACE_INDEX_MASK        (PLATFORM_TRACE_BUFFER_SIZE - 1)  ///< Maps a sequence number to a buffer index.
+#define TRACE_RTT_CHUNK_ENTRIES 16                               ///< Entries written to RTT at once.
+// clang-format on
+
+static PlatformTraceEntry sEntries[PLATFORM_TRACE_BUFFER_SIZE];
+static volatile uint32_t  sWriteSeq; ///< Sequence number of the next entry to record.
+static uint32_t           sReadSeq;  ///< Sequence number of the next entry to read.
+static uint32_t           sLost;     ///< Entries lost since the last read.
+static uint32_t           sLostTotal;
+
+#if PLATFORM_TRACE_RTT_ENABLE
+static uint8_t sRttBuffer[PLATFORM_TRACE_RTT_BUFFER_SIZE];
+#endif
+
+void nrf5TraceInit(void)
+{
+    sWriteSeq  = 0;
+    sReadSeq   = 0;
+    sLost      = 0;
+    sLostTotal = 0;
+
+#if PLATFORM_TRACE_RTT_ENABLE
+    SEGGER_RTT_ConfigUpBuffer(PLATFORM_TRACE_RTT_CHANNEL, "Trace", sRttBuffer, sizeof(sRttBuffer),
+                              SEGGER_RTT_MODE_NO_BLOCK_SKIP);
+#endif
+}
+
+void nrf5TraceRecord(PlatformTraceEvent aEvent, uint16_t aParam)
+{
+    uint32_t            seq;
+    PlatformTraceEntry *entry;
+
+    // Reserve the entry without masking interrupts, so that the trace does not disturb the timing it records.
+    do
+    {
+        seq = __LDREXW((uint32_t *)&sWriteSeq);
+    } while (__STREXW(seq + 1, (uint32_t *)&sWriteSeq));
+
+    entry = &sEntries[seq & TRACE_INDEX_MASK];
+
+    entry->mTimestamp = (uint32_t)nrf5AlarmGetRawCounter();
+    entry->mEvent     = (uint16_t)aEvent;
+    entry->mParam     = aParam;
+}
+
+static void skipOverwritten(uint32_t aWriteSeq)
+{
+    if (aWriteSeq - sReadSeq > PLATFORM_TRACE_BUFFER_SIZE)
+    {
+        sLost += aWriteSeq - sReadSeq - PLATFORM_TRACE_BUFFER_SIZE;
+        sReadSeq = aWriteSeq - PLATFORM_TRACE_BUFFER_SIZE;
+    }
+}
+
+uint16_t nrf5TraceRead(PlatformTraceEntry *aEntries, uint16_t aMaxEntries)
+{
+    uint16_t first = 1; // The first entry is reserved for the lost entries marker.
+    uint16_t count = 0;
+    uint32_t writeSeq;
+    uint32_t seq;
+    int32_t  torn;
+
+    otEXPECT(aMaxEntries > 1);
+
+    writeSeq = sWriteSeq;
+    skipOverwritten(writeSeq);
+
+    for (seq = sReadSeq; (seq != writeSeq) && (first + count < aMaxEntries); seq++)
+    {
+        aEntries[first + count++] = sEntries[seq & TRACE_INDEX_MASK];
+    }
+
+    // Entries recorded from interrupts while copying may have overwritten the oldest copied ones, drop them.
+    torn = (int32_t)(sWriteSeq - PLATFORM_TRACE_BUFFER_SIZE - sReadSeq);
+
+    if (torn > 0)
+    {
+        if (torn > count)
+        {
+            torn = count;
+        }
+
+        sLost += (uint32_t)torn;
+        first += (uint16_t)torn;
+        count -= (uint16_t)torn;
+    }
+
+    sReadSeq = seq;
+
+    if (sLost > 0)
+    {
+        first--;
+        aEntries[first].mTimestamp = (count > 0) ? aEntries[first + 1].mTimestamp : (uint32_t)nrf5AlarmGetRawCounter();
+        aEntries[first].mEvent     = kTraceEventLost;
+        aEntries[first].mParam     = (sLost > UINT16_MAX) ? UINT16_MAX : (uint16_t)sLost;
+        count++;
+
+        sLostTotal += sLost;
+        sLost = 0;
+    }
+
+    if (first > 0)
+    {
+        memmove(aEntries, &aEntries[first], count * sizeof(aEntries[0]));
+    }
+
+exit:
+    return count;
+}
+
+uint32_t nrf5TraceLostGet(void)
+{
+    return sLostTotal + sLost;
+}
+
+void nrf5TraceProcess(void)
+{
+#if PLATFORM_TRACE_RTT_ENABLE
+    PlatformTraceEntry entries[TRACE_RTT_CHUNK_ENTRIES];
+    uint16_t           count;
+
+    while ((count = nrf5TraceRead(entries, TRACE_RTT_CHUNK_ENTRIES)) > 0)
+    {
+        // The channel skips whole writes that do not fit, the host stays aligned to entries.
+        if (SEGGER_RTT_Write(PLATFORM_TRACE_RTT_CHANNEL, entries, count * sizeof(entries[0])) == 0)
+        {
+            sLost += count;
+            break;
+        }
+    }
+#endif
+}
+
+#else // PLATFORM_TRACE_ENABLE
+
+void nrf5TraceInit(void)
+{
+}
+
+void nrf5TraceRecord(PlatformTraceEvent aEvent, uint16_t aParam)
+{
+    OT_UNUSED_VARIABLE(aEvent);
+    OT_UNUSED_VARIABLE(aParam);
+}
+
+uint16_t nrf5TraceRead(PlatformTraceEntry *aEntries, uint16_t aMaxEntries)
+{
+    OT_UNUSED_VARIABLE(aEntries);
+    OT_UNUSED_VARIABLE(aMaxEntries);
+
+    return 0;
+}
+
+uint32_t nrf5TraceLostGet(void)
+{
+    return 0;
+}
+
+void nrf5TraceProcess(void)
+{
+}
+
+#endif // PLATFORM_TRACE_ENABLE
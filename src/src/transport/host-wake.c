@@ -0,0 +1,348 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements waking the host processor with a GPIO.
+ *
+ */
+
+#include <openthread-core-config.h>
+#include <openthread/config.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <utils/code_utils.h>
+#include <openthread/platform/alarm-micro.h>
+#include <openthread/platform/toolchain.h>
+
+#include "openthread-system.h"
+#include "platform-nrf5-transport.h"
+#include "transport-drivers.h"
+#include <app_util_platform.h>
+#include <hal/nrf_gpio.h>
+#include <hal/nrf_gpiote.h>
+#include <timer_scheduler/nrf_802154_timer_sched.h>
+
+#if HOST_WAKE_ENABLE && (HOST_WAKE_PIN == HOST_WAKE_PIN_NONE)
+#error "HOST_WAKE_PIN must be set for the board when HOST_WAKE_ENABLE is set"
+#endif
+
+#define US_PER_MS 1000UL
+
+typedef enum
+{
+    kHostWakeIdle,    ///< Host wake pin is deasserted, transmissions are allowed.
+    kHostWakePending, ///< Wake-up requested, waiting until the pin has been deasserted long enough.
+    kHostWakeWaiting, ///< Host wake pin is asserted, waiting for the host to become ready.
+    kHostWakeAwake,   ///< Host is ready (or timed out), the pin is kept asserted for the minimum assert time.
+} HostWakeState;
+
+static volatile HostWakeState sState = kHostWakeIdle;
+static volatile bool          sHostActivity;
+static uint32_t               sAssertTime;
+static uint32_t               sDeassertTime;
+static uint64_t               sLatencySumUs;
+static PlatformHostWakeStats  sStats;
+static nrf_802154_timer_t     sTimer;
+
+static void update(void);
+
+static void pinWrite(bool aAsserted)
+{
+    nrf_gpio_pin_write(HOST_WAKE_PIN, aAsserted ? HOST_WAKE_ACTIVE_LEVEL : !HOST_WAKE_ACTIVE_LEVEL);
+}
+
+static bool isHostReady(void)
+{
+    bool ready = sHostActivity;
+
+#if HOST_WAKE_READY_PIN != HOST_WAKE_READY_PIN_NONE
+    ready = ready || (nrf_gpio_pin_read(HOST_WAKE_READY_PIN) == HOST_WAKE_READY_ACTIVE_LEVEL);
+#endif
+
+    return ready;
+}
+
+static void handleTimer(void *aContext)
+{
+    OT_UNUSED_VARIABLE(aContext);
+
+    update();
+    otSysEventSignalPending();
+}
+
+/**
+ * Arm the timer and the host ready pin sense for the next transition of the current state, so that the state machine
+ * advances and held transmissions resume even if nothing else wakes the CPU.
+ *
+ */
+static void transitionArm(uint32_t aNow)
+{
+    uint32_t deadline;
+
+    switch (sState)
+    {
+    case kHostWakePending:
+        deadline = sDeassertTime + HOST_WAKE_DEASSERT_TIME_MS * US_PER_MS;
+        break;
+
+    case kHostWakeWaiting:
+        deadline = sAssertTime + HOST_WAKE_READY_TIMEOUT_MS * US_PER_MS;
+        break;
+
+    case kHostWakeAwake:
+        deadline = sAssertTime + HOST_WAKE_ASSERT_TIME_MS * US_PER_MS;
+        break;
+
+    default:
+        deadline = aNow;
+        break;
+    }
+
+#if HOST_WAKE_READY_PIN != HOST_WAKE_READY_PIN_NONE
+    nrf_gpio_pin_sense_t sense = HOST_WAKE_READY_ACTIVE_LEVEL ? NRF_GPIO_PIN_SENSE_HIGH : NRF_GPIO_PIN_SENSE_LOW;
+
+    // The PORT event fires as soon as the host drives the ready pin while waiting for it.
+    nrf_gpio_cfg_sense_set(HOST_WAKE_READY_PIN, (sState == kHostWakeWaiting) ? sense : NRF_GPIO_PIN_NOSENSE);
+#endif
+
+    if (sState == kHostWakeIdle)
+    {
+        nrf_802154_timer_sched_remove(&sTimer, NULL);
+    }
+    else
+    {
+        sTimer.t0        = nrf_802154_timer_sched_time_get();
+        sTimer.dt        = ((int32_t)(deadline - aNow) > 0) ? (deadline - aNow) : 0;
+        sTimer.callback  = handleTimer;
+        sTimer.p_context = NULL;
+        nrf_802154_timer_sched_add(&sTimer, true);
+    }
+}
+
+static void wakeComplete(uint32_t aNow, bool aReady)
+{
+    uint32_t latency = aNow - sAssertTime;
+
+    if (aReady)
+    {
+        sStats.mReadyCount++;
+        sLatencySumUs += latency;
+
+        if (sStats.mReadyCount == 1 || latency < sStats.mLatencyMinUs)
+        {
+            sStats.mLatencyMinUs = latency;
+        }
+
+        if (latency > sStats.mLatencyMaxUs)
+        {
+            sStats.mLatencyMaxUs = latency;
+        }
+    }
+    else
+    {
+        sStats.mTimeoutCount++;
+    }
+
+    sState = kHostWakeAwake;
+}
+
+static void update(void)
+{
+    uint32_t      now = otPlatAlarmMicroGetNow();
+    HostWakeState state;
+
+    CRITICAL_REGION_ENTER();
+
+    state = sState;
+
+    switch (sState)
+    {
+    case kHostWakePending:
+        if (now - sDeassertTime >= HOST_WAKE_DEASSERT_TIME_MS * US_PER_MS)
+        {
+            sHostActivity = false;
+            sAssertTime   = now;
+            sState        = kHostWakeWaiting;
+            sStats.mWakeCount++;
+            pinWrite(true);
+        }
+        break;
+
+    case kHostWakeWaiting:
+        if (isHostReady())
+        {
+            wakeComplete(now, true);
+        }
+        else if (now - sAssertTime >= HOST_WAKE_READY_TIMEOUT_MS * US_PER_MS)
+        {
+            wakeComplete(now, false);
+        }
+        break;
+
+    case kHostWakeAwake:
+        if (now - sAssertTime >= HOST_WAKE_ASSERT_TIME_MS * US_PER_MS)
+        {
+            sDeassertTime = now;
+            sState        = kHostWakeIdle;
+            pinWrite(false);
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    if (sState != state)
+    {
+        transitionArm(now);
+    }
+
+    CRITICAL_REGION_EXIT();
+}
+
+void nrf5HostWakeInit(void)
+{
+    otEXPECT(HOST_WAKE_ENABLE);
+
+    sState        = kHostWakeIdle;
+    sDeassertTime = otPlatAlarmMicroGetNow() - HOST_WAKE_DEASSERT_TIME_MS * US_PER_MS;
+
+    pinWrite(false);
+    nrf_gpio_cfg_output(HOST_WAKE_PIN);
+
+#if HOST_WAKE_READY_PIN != HOST_WAKE_READY_PIN_NONE
+    nrf_gpio_cfg_input(HOST_WAKE_READY_PIN, NRF_GPIO_PIN_NOPULL);
+
+    nrf_gpiote_event_clear(NRF_GPIOTE_EVENTS_PORT);
+    nrf_gpiote_int_enable(NRF_GPIOTE_INT_PORT_MASK);
+    NVIC_SetPriority(GPIOTE_IRQn, HOST_WAKE_IRQ_PRIORITY);
+    NVIC_ClearPendingIRQ(GPIOTE_IRQn);
+    NVIC_EnableIRQ(GPIOTE_IRQn);
+#endif
+
+exit:
+    return;
+}
+
+void nrf5HostWakeDeinit(void)
+{
+    otEXPECT(HOST_WAKE_ENABLE);
+
+    CRITICAL_REGION_ENTER();
+    sState = kHostWakeIdle;
+    transitionArm(otPlatAlarmMicroGetNow());
+    CRITICAL_REGION_EXIT();
+
+    pinWrite(false);
+
+#if HOST_WAKE_READY_PIN != HOST_WAKE_READY_PIN_NONE
+    NVIC_DisableIRQ(GPIOTE_IRQn);
+    nrf_gpiote_int_disable(NRF_GPIOTE_INT_PORT_MASK);
+#endif
+
+exit:
+    return;
+}
+
+void nrf5HostWakeProcess(void)
+{
+    otEXPECT(HOST_WAKE_ENABLE && sState != kHostWakeIdle);
+
+    update();
+
+exit:
+    return;
+}
+
+bool nrf5HostWakeIsTxAllowed(void)
+{
+    otEXPECT(HOST_WAKE_ENABLE && sState != kHostWakeIdle);
+
+    update();
+
+exit:
+    return (sState == kHostWakeIdle) || (sState == kHostWakeAwake);
+}
+
+void nrf5HostWakeActivity(void)
+{
+    otEXPECT(HOST_WAKE_ENABLE && sState == kHostWakeWaiting);
+
+    sHostActivity = true;
+    update();
+
+exit:
+    return;
+}
+
+void nrf5TransportWakeHost(void)
+{
+    otEXPECT(HOST_WAKE_ENABLE);
+
+    CRITICAL_REGION_ENTER();
+
+    if (sState == kHostWakeIdle)
+    {
+        sState = kHostWakePending;
+        transitionArm(otPlatAlarmMicroGetNow());
+    }
+
+    CRITICAL_REGION_EXIT();
+
+    update();
+
+exit:
+    return;
+}
+
+void nrf5TransportHostWakeStatsGet(PlatformHostWakeStats *aStats)
+{
+    CRITICAL_REGION_ENTER();
+
+    *aStats               = sStats;
+    aStats->mLatencyAvgUs = (sStats.mReadyCount > 0) ? (uint32_t)(sLatencySumUs / sStats.mReadyCount) : 0;
+
+    CRITICAL_REGION_EXIT();
+}
+
+#if HOST_WAKE_ENABLE && (HOST_WAKE_READY_PIN != HOST_WAKE_READY_PIN_NONE)
+void GPIOTE_IRQHandler(void)
+{
+    if (nrf_gpiote_event_is_set(NRF_GPIOTE_EVENTS_PORT))
+    {
+        nrf_gpiote_event_clear(NRF_GPIOTE_EVENTS_PORT);
+
+        // The host ready pin reached its active level while waiting for the host.
+        update();
+        otSysEventSignalPending();
+    }
+}
+#endif
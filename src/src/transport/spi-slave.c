@@ -37,6 +37,9 @@
 #include <openthread/platform/spi-slave.h>
 
 #include "platform-nrf5-transport.h"
+#include "platform-nrf5.h"
+#include "transport-drivers.h"
+#include <app_util_platform.h>
 #include <hal/nrf_gpio.h>
 #include <nrfx.h>
 #include <nrfx_spis.h>
@@ -55,10 +58,28 @@ static uint8_t                                  *sInputBuf               = NULL;
 static uint16_t                                  sInputBufLen            = 0;
 static bool                                      sRequestTransactionFlag = false;
 static bool                                      sFurtherProcessingFlag  = false;
+static volatile bool                             sHostIrqPending         = false;
 static otPlatSpiSlaveTransactionProcessCallback  sProcessCallback        = NULL;
 static otPlatSpiSlaveTransactionCompleteCallback sCompleteCallback       = NULL;
 static const nrfx_spis_t                         sSpiSlaveInstance       = NRFX_SPIS_INSTANCE(SPIS_INSTANCE);
 
+static void requestTransaction(void)
+{
+    CRITICAL_REGION_ENTER();
+
+    if (sHostIrqPending && nrf5HostWakeIsTxAllowed())
+    {
+        sHostIrqPending = false;
+
+        // Host IRQ pin is active low.
+        nrf_gpio_pin_clear(SPIS_PIN_HOST_IRQ);
+
+        nrf5WatchdogCheckArm(kWatchdogCheckTransport, WATCHDOG_TRANSPORT_TIMEOUT_MS);
+    }
+
+    CRITICAL_REGION_EXIT();
+}
+
 static void spisEventHandler(nrfx_spis_evt_t const *aEvent, void *aContext)
 {
     OT_UNUSED_VARIABLE(aContext);
@@ -68,15 +89,22 @@ static void spisEventHandler(nrfx_spis_evt_t const *aEvent, void *aContext)
     case NRFX_SPIS_BUFFERS_SET_DONE:
         if (sRequestTransactionFlag)
         {
-            // Host IRQ pin is active low.
-            nrf_gpio_pin_clear(SPIS_PIN_HOST_IRQ);
+            // Host IRQ is asserted once the host is ready.
+            sHostIrqPending = true;
+            requestTransaction();
         }
         break;
 
     case NRFX_SPIS_XFER_DONE:
         // Ensure Host IRQ pin is set.
+        sHostIrqPending = false;
         nrf_gpio_pin_set(SPIS_PIN_HOST_IRQ);
 
+        // The host clocked a transaction, so it is awake.
+        nrf5HostWakeActivity();
+
+        nrf5WatchdogCheckDisarm(kWatchdogCheckTransport);
+
         // Execute application callback.
         if (sCompleteCallback(sContext, sOutputBuf, sOutputBufLen, sInputBuf, sInputBufLen,
                               MAX(aEvent->rx_amount, aEvent->tx_amount)))
@@ -106,12 +134,18 @@ void nrf5SpiSlaveDeinit(void)
     sInputBuf               = NULL;
     sInputBufLen            = 0;
     sRequestTransactionFlag = false;
+    sHostIrqPending         = false;
+
+    nrf5WatchdogCheckDisarm(kWatchdogCheckTransport);
 
     otPlatSpiSlaveDisable();
 }
 
 void nrf5SpiSlaveProcess(void)
 {
+    // Request the transaction held until the host is ready.
+    requestTransaction();
+
     otEXPECT(sFurtherProcessingFlag == true);
 
     // Clear further processing flag.
@@ -162,6 +196,11 @@ otError otPlatSpiSlaveEnable(otPlatSpiSlaveTransactionCompleteCallback aComplete
     sCompleteCallback = aCompleteCallback;
     sContext          = aContext;
 
+    if (result == OT_ERROR_NONE)
+    {
+        nrf5BootMilestoneReached(kBootMilestoneTransport);
+    }
+
 exit:
     return result;
 }
@@ -35,6 +35,8 @@
 #ifndef TRANSPORT_DRIVERS_H_
 #define TRANSPORT_DRIVERS_H_
 
+#include <stdbool.h>
+
 /**
  * Initialization of UART driver.
  *
@@ -76,4 +78,37 @@ void nrf5SpiSlaveDeinit(void);
  */
 void nrf5SpiSlaveProcess(void);
 
+/**
+ * Initialization of host wake driver.
+ *
+ */
+void nrf5HostWakeInit(void);
+
+/**
+ * Deinitialization of host wake driver.
+ *
+ */
+void nrf5HostWakeDeinit(void);
+
+/**
+ * Function for processing host wake driver.
+ */
+void nrf5HostWakeProcess(void);
+
+/**
+ * Function for checking if data can be sent to the host, i.e. the host is not being woken up.
+ *
+ * @note This function can be called from interrupt context.
+ *
+ */
+bool nrf5HostWakeIsTxAllowed(void);
+
+/**
+ * Function for notifying host wake driver that data has been received from the host.
+ *
+ * @note This function can be called from interrupt context.
+ *
+ */
+void nrf5HostWakeActivity(void);
+
 #endif
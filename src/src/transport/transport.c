@@ -58,6 +58,8 @@ void nrf5TransportInit(bool aPseudoReset)
 #if (SPIS_AS_SERIAL_TRANSPORT == 1)
     nrf5SpiSlaveInit();
 #endif
+
+    nrf5HostWakeInit();
 }
 
 void nrf5TransportDeinit(bool aPseudoReset)
@@ -74,10 +76,14 @@ void nrf5TransportDeinit(bool aPseudoReset)
 #if (SPIS_AS_SERIAL_TRANSPORT == 1)
     nrf5SpiSlaveDeinit();
 #endif
+
+    nrf5HostWakeDeinit();
 }
 
 void nrf5TransportProcess(void)
 {
+    nrf5HostWakeProcess();
+
 #if ((UART_AS_SERIAL_TRANSPORT == 1) || (USB_CDC_AS_SERIAL_TRANSPORT == 1))
     nrf5UartProcess();
 #endif
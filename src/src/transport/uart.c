@@ -46,6 +46,9 @@
 #include "openthread-system.h"
 
 #include "platform-nrf5-transport.h"
+#include "platform-nrf5.h"
+#include "transport-drivers.h"
+#include <app_util_platform.h>
 #include <hal/nrf_gpio.h>
 #include <hal/nrf_uarte.h>
 #include <nrf_drv_clock.h>
@@ -61,7 +64,14 @@ bool sUartEnabled = false;
  * UART TX buffer variables.
  */
 static const uint8_t *sTransmitBuffer = NULL;
-static volatile bool  sTransmitDone   = 0;
+static uint16_t       sTransmitLength  = 0;
+static volatile bool  sTransmitStarted = false;
+static volatile bool  sTransmitDone    = 0;
+
+/**
+ * UART started flag, set once HFCLK is running and the UART instance is enabled.
+ */
+static volatile bool sUartStarted = false;
 
 /**
  * UART RX ring buffer variables.
@@ -114,6 +124,8 @@ static void processReceive(void)
 
     otEXPECT(isRxBufferEmpty() == false);
 
+    nrf5HostWakeActivity();
+
     // In case head roll back to the beginning of the buffer, notify about left
     // bytes from the end of the buffer.
     if (head < sReceiveTail)
@@ -141,6 +153,28 @@ exit:
     return;
 }
 
+/**
+ * Function for starting the transmission of the pending TX buffer, once the UART instance is started and the host
+ * is ready to receive.
+ */
+static void startTransmit(void)
+{
+    CRITICAL_REGION_ENTER();
+
+    if (sTransmitBuffer != NULL && !sTransmitStarted && sUartStarted && nrf5HostWakeIsTxAllowed())
+    {
+        sTransmitStarted = true;
+
+        nrf_uarte_event_clear(UART_INSTANCE, NRF_UARTE_EVENT_ENDTX);
+        nrf_uarte_tx_buffer_set(UART_INSTANCE, sTransmitBuffer, sTransmitLength);
+        nrf_uarte_task_trigger(UART_INSTANCE, NRF_UARTE_TASK_STARTTX);
+
+        nrf5WatchdogCheckArm(kWatchdogCheckTransport, WATCHDOG_TRANSPORT_TIMEOUT_MS);
+    }
+
+    CRITICAL_REGION_EXIT();
+}
+
 /**
  * Function for notifying application about transmission being done.
  */
@@ -151,10 +185,16 @@ static void processTransmit(void)
     if (sTransmitDone)
     {
         // Clear Transmition transaction and notify application.
-        sTransmitBuffer = NULL;
-        sTransmitDone   = false;
+        sTransmitBuffer  = NULL;
+        sTransmitStarted = false;
+        sTransmitDone    = false;
         otPlatUartSendDone();
     }
+    else
+    {
+        // Start the transmission held until the host is ready.
+        startTransmit();
+    }
 
 exit:
     return;
@@ -165,6 +205,7 @@ otError otPlatUartFlush(void)
     while (sTransmitBuffer && !sTransmitDone)
     {
         // Wait until the transmission is done
+        startTransmit();
     }
 
     processTransmit();
@@ -196,6 +237,34 @@ void nrf5UartDeinit(void)
     }
 }
 
+/**
+ * Function for handling HFCLK events. The UART instance is enabled once the crystal is running, so that the boot
+ * does not wait for it.
+ */
+static void handleHfclkEvent(nrf_drv_clock_evt_type_t aEvent)
+{
+    otEXPECT(aEvent == NRF_DRV_CLOCK_EVT_HFCLK_STARTED && sUartEnabled && !sUartStarted);
+
+    // Enable UART instance, and start RX on it.
+    nrf_uarte_enable(UART_INSTANCE);
+    nrf_uarte_task_trigger(UART_INSTANCE, NRF_UARTE_TASK_STARTRX);
+
+    sUartStarted = true;
+
+    // Start the transmission requested before the clock was running.
+    startTransmit();
+
+    nrf5BootMilestoneReached(kBootMilestoneTransport);
+
+exit:
+    return;
+}
+
+static nrf_drv_clock_handler_item_t sHfclkHandlerItem = {
+    .p_next        = NULL,
+    .event_handler = handleHfclkEvent,
+};
+
 otError otPlatUartEnable(void)
 {
     otError error = OT_ERROR_NONE;
@@ -239,19 +308,11 @@ otError otPlatUartEnable(void)
     NVIC_ClearPendingIRQ(UART_IRQN);
     NVIC_EnableIRQ(UART_IRQN);
 
-    // Start HFCLK
-    nrf_drv_clock_hfclk_request(NULL);
-
-    while (!nrf_drv_clock_hfclk_is_running())
-    {
-    }
-
-    // Enable UART instance, and start RX on it.
-    nrf_uarte_enable(UART_INSTANCE);
-    nrf_uarte_task_trigger(UART_INSTANCE, NRF_UARTE_TASK_STARTRX);
-
     sUartEnabled = true;
 
+    // Start HFCLK, UART instance is enabled by the clock handler.
+    nrf_drv_clock_hfclk_request(&sHfclkHandlerItem);
+
 exit:
     return error;
 }
@@ -275,10 +336,13 @@ otError otPlatUartDisable(void)
 
     // Disable UART instance.
     nrf_uarte_disable(UART_INSTANCE);
+    sUartStarted = false;
 
     // Release HF clock.
     nrf_drv_clock_hfclk_release();
 
+    nrf5WatchdogCheckDisarm(kWatchdogCheckTransport);
+
     sUartEnabled = false;
 
 exit:
@@ -295,12 +359,11 @@ otError otPlatUartSend(const uint8_t *aBuf, uint16_t aBufLength)
     otEXPECT_ACTION(sTransmitBuffer == NULL, error = OT_ERROR_BUSY);
 
     // Set up transmit buffer.
+    sTransmitLength = aBufLength;
     sTransmitBuffer = aBuf;
 
-    // Initiate transmission process.
-    nrf_uarte_event_clear(UART_INSTANCE, NRF_UARTE_EVENT_ENDTX);
-    nrf_uarte_tx_buffer_set(UART_INSTANCE, sTransmitBuffer, aBufLength);
-    nrf_uarte_task_trigger(UART_INSTANCE, NRF_UARTE_TASK_STARTTX);
+    // Initiate transmission process. It is deferred if HFCLK is not running yet, or the host is being woken up.
+    startTransmit();
 
 exit:
     return error;
@@ -350,6 +413,8 @@ void UARTE0_UART0_IRQHandler(void)
 
         nrf_uarte_task_trigger(UART_INSTANCE, NRF_UARTE_TASK_STOPTX);
 
+        nrf5WatchdogCheckDisarm(kWatchdogCheckTransport);
+
         otSysEventSignalPending();
     }
 }
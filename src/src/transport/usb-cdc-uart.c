@@ -52,12 +52,14 @@
 #include <openthread/platform/misc.h>
 
 #include "platform-nrf5-transport.h"
+#include "platform-nrf5.h"
 
 #include "app_usbd.h"
 #include "app_usbd_serial_num.h"
 #include "nrf_dfu_trigger_usb.h"
 #include "nrf_drv_clock.h"
 #include "nrf_drv_power.h"
+#include "nrf_gpio.h"
 #include "class/cdc/acm/app_usbd_cdc_acm.h"
 
 #if (USB_CDC_AS_SERIAL_TRANSPORT == 1)
@@ -106,13 +108,17 @@ static void cdcAcmUserEventHandler(app_usbd_class_inst_t const *aCdcAcmInstance,
         // Setup first transfer.
         (void)app_usbd_cdc_acm_read_any(&sAppCdcAcm, sRxBuffer, sizeof(sRxBuffer));
         sUsbState.mOpenTimestamp = otPlatAlarmMilliGetNow();
+        nrf5BootMilestoneReached(kBootMilestoneTransport);
         break;
 
     case APP_USBD_CDC_ACM_USER_EVT_PORT_CLOSE:
+        // A transfer interrupted by the host closing the port is not a transport failure.
+        nrf5WatchdogCheckDisarm(kWatchdogCheckTransport);
         break;
 
     case APP_USBD_CDC_ACM_USER_EVT_TX_DONE:
         sUsbState.mTransferDone = true;
+        nrf5WatchdogCheckDisarm(kWatchdogCheckTransport);
         break;
 
     case APP_USBD_CDC_ACM_USER_EVT_RX_DONE:
@@ -246,6 +252,7 @@ static void processTransmit(void)
     {
         if (app_usbd_cdc_acm_write(&sAppCdcAcm, sUsbState.mTxBuffer, sUsbState.mTxSize) == NRF_SUCCESS)
         {
+            nrf5WatchdogCheckArm(kWatchdogCheckTransport, WATCHDOG_TRANSPORT_TIMEOUT_MS);
             sUsbState.mTransferInProgress = true;
             sUsbState.mTxBuffer           = NULL;
             sUsbState.mTxSize             = 0;
@@ -310,11 +317,25 @@ void nrf5UartDeinit(void)
 
 void nrf5UartClearPendingData(void)
 {
+    nrf5WatchdogCheckDisarm(kWatchdogCheckTransport);
+
     sUsbState.mTransferInProgress = false;
     sUsbState.mTxBuffer           = NULL;
     sUsbState.mTxSize             = 0;
 }
 
+#if NRF_MODULE_ENABLED(APP_USBD_NRF_DFU_TRIGGER)
+void nrf_dfu_trigger_usb_detach(void)
+{
+    // Fall back to the pin reset of the library, which works on boards with the reset pin wired to a GPIO.
+    if (nrf5BootloaderEnter() != OT_ERROR_NONE)
+    {
+        nrf_gpio_cfg_output(BSP_SELF_PINRESET_PIN);
+        nrf_gpio_pin_clear(BSP_SELF_PINRESET_PIN);
+    }
+}
+#endif // NRF_MODULE_ENABLED(APP_USBD_NRF_DFU_TRIGGER)
+
 void nrf5UartProcess(void)
 {
     while (app_usbd_event_queue_process())
@@ -358,6 +379,7 @@ otError otPlatUartSend(const uint8_t *aBuf, uint16_t aBufLength)
     else
     {
         otEXPECT_ACTION(app_usbd_cdc_acm_write(&sAppCdcAcm, aBuf, aBufLength) == NRF_SUCCESS, error = OT_ERROR_FAILED);
+        nrf5WatchdogCheckArm(kWatchdogCheckTransport, WATCHDOG_TRANSPORT_TIMEOUT_MS);
         sUsbState.mTransferInProgress = true;
     }
 
@@ -0,0 +1,217 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the watchdog fed from the main loop after subsystem liveness checks pass.
+ *
+ */
+
+#include <openthread-core-config.h>
+#include <openthread/config.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <openthread/platform/alarm-milli.h>
+
+#include "platform-nrf5.h"
+
+#include <hal/nrf_wdt.h>
+
+// clang-format off
+#define WATCHDOG_RECORD_MAGIC   0x57444f47UL  ///< Marks a valid retained failure record ("WDOG").
+#define WATCHDOG_RELOAD_RR      NRF_WDT_RR0   ///< Reload request register used to feed the watchdog.
+#define WATCHDOG_TICKS_PER_S    32768UL       ///< The watchdog runs from the 32.768 kHz LFCLK.
+// clang-format on
+
+typedef struct
+{
+    volatile bool     mArmed;    ///< The check is waiting for an operation to complete.
+    volatile uint32_t mDeadline; ///< Time by which the check must be disarmed [ms].
+} WatchdogCheckData;
+
+typedef struct
+{
+    uint32_t mMagic;          ///< Equals @ref WATCHDOG_RECORD_MAGIC if the record is valid.
+    uint32_t mFailedCheck;    ///< The failed check.
+    uint32_t mFailedCheckInv; ///< Bitwise inversion of @p mFailedCheck.
+} WatchdogRetainedRecord;
+
+static WatchdogCheckData     sChecks[kWatchdogNumChecks];
+static PlatformWatchdogCheck sLastFailedCheck;
+static uint32_t              sPauseCount;
+static uint32_t              sPauseTimestamp;
+
+/**
+ * Failure record retained across the watchdog reset. The .noinit section is not cleared by the startup code.
+ */
+static WatchdogRetainedRecord sRetainedRecord __attribute__((section(".noinit")));
+
+static void feed(void)
+{
+    if (WATCHDOG_ENABLE)
+    {
+        nrf_wdt_reload_request_set(WATCHDOG_RELOAD_RR);
+    }
+}
+
+static bool checkHasExpired(PlatformWatchdogCheck aCheck, uint32_t aNow)
+{
+    return sChecks[aCheck].mArmed && ((int32_t)(aNow - sChecks[aCheck].mDeadline) > 0);
+}
+
+static void handleCheckFailure(PlatformWatchdogCheck aCheck)
+{
+    sRetainedRecord.mFailedCheck    = (uint32_t)aCheck;
+    sRetainedRecord.mFailedCheckInv = ~(uint32_t)aCheck;
+    sRetainedRecord.mMagic          = WATCHDOG_RECORD_MAGIC;
+    __DSB();
+
+    // Stop feeding and keep the CPU busy, so the watchdog expires even if it is configured to pause in sleep.
+    while (true)
+    {
+    }
+}
+
+void nrf5WatchdogInit(void)
+{
+    for (uint32_t i = 0; i < kWatchdogNumChecks; i++)
+    {
+        sChecks[i].mArmed = false;
+    }
+
+    sPauseCount      = 0;
+    sLastFailedCheck = kWatchdogCheckNone;
+
+    if ((sRetainedRecord.mMagic == WATCHDOG_RECORD_MAGIC) &&
+        (sRetainedRecord.mFailedCheck == ~sRetainedRecord.mFailedCheckInv) &&
+        (sRetainedRecord.mFailedCheck < kWatchdogNumChecks))
+    {
+        sLastFailedCheck = (PlatformWatchdogCheck)sRetainedRecord.mFailedCheck;
+    }
+
+    sRetainedRecord.mMagic = 0;
+
+    if (WATCHDOG_ENABLE && !nrf_wdt_started())
+    {
+        nrf_wdt_behaviour_set(WATCHDOG_BEHAVIOUR);
+        nrf_wdt_reload_value_set((WATCHDOG_TIMEOUT_MS * WATCHDOG_TICKS_PER_S) / 1000);
+        nrf_wdt_reload_request_enable(WATCHDOG_RELOAD_RR);
+        nrf_wdt_task_trigger(NRF_WDT_TASK_START);
+    }
+
+    feed();
+}
+
+void nrf5WatchdogDeinit(void)
+{
+    // The watchdog cannot be stopped. Feed it once more to give the reinitialization a full period.
+    feed();
+}
+
+void nrf5WatchdogProcess(void)
+{
+    uint32_t now;
+
+    if (!WATCHDOG_ENABLE || (sPauseCount > 0))
+    {
+        return;
+    }
+
+    now = otPlatAlarmMilliGetNow();
+
+    for (uint32_t i = kWatchdogCheckNone + 1; i < kWatchdogNumChecks; i++)
+    {
+        if (checkHasExpired((PlatformWatchdogCheck)i, now))
+        {
+            handleCheckFailure((PlatformWatchdogCheck)i);
+        }
+    }
+
+    feed();
+}
+
+void nrf5WatchdogCheckArm(PlatformWatchdogCheck aCheck, uint32_t aTimeoutMs)
+{
+    sChecks[aCheck].mDeadline = otPlatAlarmMilliGetNow() + aTimeoutMs;
+    __DMB();
+    sChecks[aCheck].mArmed = true;
+}
+
+void nrf5WatchdogCheckDisarm(PlatformWatchdogCheck aCheck)
+{
+    sChecks[aCheck].mArmed = false;
+}
+
+void nrf5WatchdogPause(void)
+{
+    if (sPauseCount++ == 0)
+    {
+        sPauseTimestamp = otPlatAlarmMilliGetNow();
+    }
+
+    feed();
+}
+
+void nrf5WatchdogResume(void)
+{
+    uint32_t pausedTime;
+
+    if ((sPauseCount == 0) || (--sPauseCount > 0))
+    {
+        return;
+    }
+
+    // Time spent paused does not count towards the liveness check deadlines.
+    pausedTime = otPlatAlarmMilliGetNow() - sPauseTimestamp;
+
+    for (uint32_t i = 0; i < kWatchdogNumChecks; i++)
+    {
+        sChecks[i].mDeadline += pausedTime;
+    }
+
+    feed();
+}
+
+PlatformWatchdogCheck nrf5WatchdogLastFailedCheckGet(void)
+{
+    return sLastFailedCheck;
+}
+
+const char *nrf5WatchdogCheckToString(PlatformWatchdogCheck aCheck)
+{
+    static const char *const kCheckNames[kWatchdogNumChecks] = {
+        [kWatchdogCheckNone]      = "none",
+        [kWatchdogCheckRadio]     = "radio",
+        [kWatchdogCheckTransport] = "transport",
+        [kWatchdogCheckAlarm]     = "alarm",
+    };
+
+    return (aCheck < kWatchdogNumChecks) ? kCheckNames[aCheck] : "unknown";
+}
@@ -131,6 +131,14 @@
 
 #endif // USB_CDC_AS_SERIAL_TRANSPORT == 1
 
+#if (PLATFORM_FLASH_QSPI_ENABLE == 1)
+
+#ifndef NRFX_QSPI_ENABLED
+#define NRFX_QSPI_ENABLED 1
+#endif
+
+#endif // PLATFORM_FLASH_QSPI_ENABLE == 1
+
 #ifndef APP_USBD_NRF_DFU_TRIGGER_ENABLED
 #define APP_USBD_NRF_DFU_TRIGGER_ENABLED 0
 #endif
@@ -38,9 +38,12 @@
 #include "nrf_802154_ack_data.h"
 
 #include <assert.h>
+#include <stddef.h>
 #include <string.h>
 
+#include "nrf.h"
 #include "mac_features/nrf_802154_frame_parser.h"
+#include "nrf_802154.h"
 #include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
 
@@ -52,7 +55,6 @@
 /// Structure representing pending bit setting variables.
 typedef struct
 {
-    bool     enabled;                                                      /// If setting pending bit is enabled.
     uint8_t  short_addr[NUM_SHORT_ADDRESSES][SHORT_ADDRESS_SIZE];          /// Array of short addresses of nodes for which there is pending data in the buffer.
     uint8_t  extended_addr[NUM_EXTENDED_ADDRESSES][EXTENDED_ADDRESS_SIZE]; /// Array of extended addresses of nodes for which there is pending data in the buffer.
     uint32_t num_of_short_addr;                                            /// Current number of short addresses of nodes for which there is pending data in the buffer.
@@ -89,9 +91,31 @@ typedef struct
     uint32_t            num_of_ext_data;                  /// Current number of extended addresses stored in @p ext_data.
 } ie_arrays_t;
 
+// Structure describing a single list of addresses.
+typedef struct
+{
+    uint8_t  * p_entries;  /// Pointer to the first entry of the list.
+    uint32_t * p_len;      /// Pointer to the current number of entries in the list.
+    uint32_t   max_len;    /// Maximum number of entries in the list.
+    uint8_t    entry_size; /// Size of a single entry of the list.
+} addr_list_t;
+
+#if NRF_802154_ACK_DATA_DOUBLE_BUFFER_ENABLED
+// Each list is double-buffered. Updates are merged from the active copy of the list into the other
+// one, which then becomes active, so that ACK generation never sees a list in the middle of an update.
+#define NUM_COPIES 2
+#else
+// Each list is updated in place with interrupts disabled.
+#define NUM_COPIES 1
+#endif
+
 // TODO: Combine below arrays to perform binary search only once per Ack generation.
-static pending_bit_arrays_t        m_pending_bit;
-static ie_arrays_t                 m_ie;
+static pending_bit_arrays_t        m_pending_bit[NUM_COPIES];
+static ie_arrays_t                 m_ie[NUM_COPIES];
+#if NRF_802154_ACK_DATA_DOUBLE_BUFFER_ENABLED
+static volatile uint8_t            m_active[2][2]; /// Active copy of each list, by data type and address length.
+#endif
+static bool                        m_pending_bit_enabled;
 static nrf_802154_src_addr_match_t m_src_matching_method;
 
 /***************************************************************************************************
@@ -187,44 +211,87 @@ static int8_t addr_compare(const uint8_t * p_first_addr,
 }
 
 /**
- * @brief Perform a binary search for an address in a list of addresses.
+ * @brief Get a list of addresses.
  *
- * @param[in]  p_addr           Pointer to an address that is searched for.
- * @param[in]  p_addr_array     Pointer to a list of addresses to be searched.
- * @param[out] p_location       If the address @p p_addr appears in the list, this is its index in the address list.
- *                              Otherwise, it is the index which @p p_addr would have if it was placed in the list
- *                              (ascending order assumed).
- * @param[in]  extended         Indication if @p p_addr is an extended or a short addresses.
- *
- * @retval true   Address @p p_addr is in the list.
- * @retval false  Address @p p_addr is not in the list.
+ * @param[in]  data_type  Type of data stored in the list.
+ * @param[in]  extended   Indication if the list holds extended or short addresses.
+ * @param[in]  active     Indication if the active copy of the list or the other one is to be returned.
+ *                        Ignored if the lists are not double-buffered.
+ * @param[out] p_list     Description of the list.
  */
-static bool addr_binary_search(const uint8_t * p_addr,
-                               const uint8_t * p_addr_array,
-                               uint32_t      * p_location,
-                               uint8_t         data_type,
-                               bool            extended)
+static void addr_list_get(uint8_t data_type, bool extended, bool active, addr_list_t * p_list)
 {
-    uint32_t addr_array_len = 0;
-    uint8_t  entry_size     = 0;
+#if NRF_802154_ACK_DATA_DOUBLE_BUFFER_ENABLED
+    uint8_t                copy          = m_active[data_type][extended] ^ (active ? 0 : 1);
+#else
+    uint8_t                copy          = 0;
+#endif
+    pending_bit_arrays_t * p_pending_bit = &m_pending_bit[copy];
+    ie_arrays_t          * p_ie          = &m_ie[copy];
 
     switch (data_type)
     {
         case NRF_802154_ACK_DATA_PENDING_BIT:
-            entry_size     = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
-            addr_array_len = extended ?
-                             m_pending_bit.num_of_ext_addr : m_pending_bit.num_of_short_addr;
+            if (extended)
+            {
+                p_list->p_entries  = (uint8_t *)p_pending_bit->extended_addr;
+                p_list->p_len      = &p_pending_bit->num_of_ext_addr;
+                p_list->max_len    = NUM_EXTENDED_ADDRESSES;
+                p_list->entry_size = EXTENDED_ADDRESS_SIZE;
+            }
+            else
+            {
+                p_list->p_entries  = (uint8_t *)p_pending_bit->short_addr;
+                p_list->p_len      = &p_pending_bit->num_of_short_addr;
+                p_list->max_len    = NUM_SHORT_ADDRESSES;
+                p_list->entry_size = SHORT_ADDRESS_SIZE;
+            }
             break;
 
         case NRF_802154_ACK_DATA_IE:
-            entry_size     = extended ? sizeof(ack_ext_ie_data_t) : sizeof(ack_short_ie_data_t);
-            addr_array_len = extended ? m_ie.num_of_ext_data : m_ie.num_of_short_data;
+            if (extended)
+            {
+                p_list->p_entries  = (uint8_t *)p_ie->ext_data;
+                p_list->p_len      = &p_ie->num_of_ext_data;
+                p_list->max_len    = NUM_EXTENDED_ADDRESSES;
+                p_list->entry_size = sizeof(ack_ext_ie_data_t);
+            }
+            else
+            {
+                p_list->p_entries  = (uint8_t *)p_ie->short_data;
+                p_list->p_len      = &p_ie->num_of_short_data;
+                p_list->max_len    = NUM_SHORT_ADDRESSES;
+                p_list->entry_size = sizeof(ack_short_ie_data_t);
+            }
             break;
 
         default:
             assert(false);
             break;
     }
+}
+
+/**
+ * @brief Perform a binary search for an address in a list of addresses.
+ *
+ * @param[in]  p_addr           Pointer to an address that is searched for.
+ * @param[in]  p_list           Pointer to a list of addresses to be searched.
+ * @param[out] p_location       If the address @p p_addr appears in the list, this is its index in the address list.
+ *                              Otherwise, it is the index which @p p_addr would have if it was placed in the list
+ *                              (ascending order assumed).
+ * @param[in]  extended         Indication if @p p_addr is an extended or a short addresses.
+ *
+ * @retval true   Address @p p_addr is in the list.
+ * @retval false  Address @p p_addr is not in the list.
+ */
+static bool addr_binary_search(const uint8_t     * p_addr,
+                               const addr_list_t * p_list,
+                               uint32_t          * p_location,
+                               bool                extended)
+{
+    const uint8_t * p_addr_array   = p_list->p_entries;
+    uint32_t        addr_array_len = *p_list->p_len;
+    uint8_t         entry_size     = p_list->entry_size;
 
     // The actual algorithm
     int32_t  low      = 0;
@@ -293,32 +360,17 @@ static bool addr_index_find(const uint8_t * p_addr,
                             uint8_t         data_type,
                             bool            extended)
 {
-    uint8_t * p_addr_array;
-    bool      valid_data_type = true;
+    addr_list_t list;
 
-    switch (data_type)
-    {
-        case NRF_802154_ACK_DATA_PENDING_BIT:
-            p_addr_array = extended ? (uint8_t *)m_pending_bit.extended_addr :
-                           (uint8_t *)m_pending_bit.short_addr;
-            break;
-
-        case NRF_802154_ACK_DATA_IE:
-            p_addr_array = extended ? (uint8_t *)m_ie.ext_data : (uint8_t *)m_ie.short_data;
-            break;
-
-        default:
-            valid_data_type = false;
-            assert(false);
-            break;
-    }
-
-    if (!valid_data_type)
+    if ((data_type != NRF_802154_ACK_DATA_PENDING_BIT) && (data_type != NRF_802154_ACK_DATA_IE))
     {
+        assert(false);
         return false;
     }
 
-    return addr_binary_search(p_addr, p_addr_array, p_location, data_type, extended);
+    addr_list_get(data_type, extended, true, &list);
+
+    return addr_binary_search(p_addr, &list, p_location, extended);
 }
 
 /**
@@ -336,7 +388,7 @@ static bool addr_match_thread(const uint8_t * p_frame)
     const uint8_t * p_src_addr = nrf_802154_frame_parser_src_addr_get(p_frame, &extended);
 
     // The pending bit is set by default.
-    if (!m_pending_bit.enabled || (NULL == p_src_addr))
+    if (!m_pending_bit_enabled || (NULL == p_src_addr))
     {
         return true;
     }
@@ -361,7 +413,7 @@ static bool addr_match_zigbee(const uint8_t * p_frame)
     bool                               ret   = false;
 
     // If ack data generator module is disabled do not perform check, return true by default.
-    if (!m_pending_bit.enabled)
+    if (!m_pending_bit_enabled)
     {
         return true;
     }
@@ -422,181 +474,336 @@ static bool addr_match_standard_compliant(const uint8_t * p_frame)
 }
 
 /**
- * @brief Add an address to the address list in ascending order.
+ * @brief Write an entry of a list of addresses set by an operation.
  *
- * @param[in]  p_addr           Pointer to the address to be added.
- * @param[in]  location         Index of the location where @p p_addr should be added.
- * @param[in]  extended         Indication if @p p_addr is an extended or a short addresses.
+ * @param[out] p_entry    Pointer to the entry to be written.
+ * @param[in]  p_op       Pointer to the operation setting the entry.
+ * @param[in]  data_type  Type of data stored in the list.
  *
- * @retval true   Address @p p_addr has been added to the list successfully.
- * @retval false  Address @p p_addr could not be added to the list.
+ * @retval true   Entry has been written successfully.
+ * @retval false  Data set by @p p_op does not fit in the entry.
  */
-static bool addr_add(const uint8_t * p_addr, uint32_t location, uint8_t data_type, bool extended)
+static bool entry_write(uint8_t * p_entry, const nrf_802154_ack_data_op_t * p_op, uint8_t data_type)
 {
-    uint32_t * p_addr_array_len;
-    uint32_t   max_addr_array_len;
-    uint8_t  * p_addr_array;
-    uint8_t    entry_size;
-    bool       valid_data_type = true;
+    ie_data_t * p_ie_data;
 
-    switch (data_type)
+    if ((data_type == NRF_802154_ACK_DATA_IE) && (p_op->length > NRF_802154_MAX_ACK_IE_SIZE))
     {
-        case NRF_802154_ACK_DATA_PENDING_BIT:
-            if (extended)
-            {
-                p_addr_array       = (uint8_t *)m_pending_bit.extended_addr;
-                max_addr_array_len = NUM_EXTENDED_ADDRESSES;
-                p_addr_array_len   = &m_pending_bit.num_of_ext_addr;
-                entry_size         = EXTENDED_ADDRESS_SIZE;
-            }
-            else
-            {
-                p_addr_array       = (uint8_t *)m_pending_bit.short_addr;
-                max_addr_array_len = NUM_SHORT_ADDRESSES;
-                p_addr_array_len   = &m_pending_bit.num_of_short_addr;
-                entry_size         = SHORT_ADDRESS_SIZE;
-            }
-            break;
+        return false;
+    }
 
-        case NRF_802154_ACK_DATA_IE:
-            if (extended)
-            {
-                p_addr_array       = (uint8_t *)m_ie.ext_data;
-                max_addr_array_len = NUM_EXTENDED_ADDRESSES;
-                p_addr_array_len   = &m_ie.num_of_ext_data;
-                entry_size         = sizeof(ack_ext_ie_data_t);
-            }
-            else
-            {
-                p_addr_array       = (uint8_t *)m_ie.short_data;
-                max_addr_array_len = NUM_SHORT_ADDRESSES;
-                p_addr_array_len   = &m_ie.num_of_short_data;
-                entry_size         = sizeof(ack_short_ie_data_t);
-            }
-            break;
+    memcpy(p_entry, p_op->p_addr, p_op->extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE);
 
-        default:
-            valid_data_type = false;
-            assert(false);
-            break;
+    if (data_type == NRF_802154_ACK_DATA_IE)
+    {
+        p_ie_data = (ie_data_t *)(p_entry + (p_op->extended ?
+                                             offsetof(ack_ext_ie_data_t, ie_data) :
+                                             offsetof(ack_short_ie_data_t, ie_data)));
+
+        memcpy(p_ie_data->p_data, p_op->p_data, p_op->length);
+        p_ie_data->len = p_op->length;
     }
 
-    if (!valid_data_type || (*p_addr_array_len == max_addr_array_len))
+    return true;
+}
+
+#if NRF_802154_ACK_DATA_DOUBLE_BUFFER_ENABLED
+
+/**
+ * @brief Sort the operations on addresses of a given length.
+ *
+ * Insertion sort is stable, so operations on the same address keep the order in which they were
+ * requested.
+ *
+ * @param[in]  p_ops      Pointer to the array of operations.
+ * @param[in]  ops_count  Number of operations in @p p_ops.
+ * @param[in]  extended   Indication if operations on extended or short addresses are to be sorted.
+ * @param[out] p_order    Indexes of the operations on addresses of a given length in ascending order.
+ *
+ * @returns  Number of indexes stored in @p p_order.
+ */
+static uint32_t ops_sort(const nrf_802154_ack_data_op_t * p_ops,
+                         uint32_t                         ops_count,
+                         bool                             extended,
+                         uint8_t                        * p_order)
+{
+    uint32_t order_len = 0;
+
+    for (uint32_t i = 0; i < ops_count; i++)
     {
-        return false;
-    }
+        uint32_t j = order_len;
 
-    memmove(p_addr_array + entry_size * (location + 1),
-            p_addr_array + entry_size * (location),
-            (*p_addr_array_len - location) * entry_size);
+        if (p_ops[i].extended != extended)
+        {
+            continue;
+        }
 
-    memcpy(p_addr_array + entry_size * location,
-           p_addr,
-           extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE);
+        while ((j > 0) && (addr_compare(p_ops[i].p_addr, p_ops[p_order[j - 1]].p_addr, extended) < 0))
+        {
+            p_order[j] = p_order[j - 1];
+            j--;
+        }
 
-    (*p_addr_array_len)++;
+        p_order[j] = (uint8_t)i;
+        order_len++;
+    }
 
-    return true;
+    return order_len;
 }
 
 /**
- * @brief Remove an address from the address list keeping it in ascending order.
+ * @brief Merge sorted operations with a list of addresses into another list.
+ *
+ * Entries of @p p_src not affected by any operation are copied to @p p_dst. Of the operations on
+ * the same address only the last one takes effect. Room is always kept for the remaining entries
+ * of @p p_src, so an address is never dropped to make room for a new one.
  *
- * @param[in]  location     Index of the element to be removed from the list.
- * @param[in]  extended     Indication if address to remove is an extended or a short address.
+ * @param[in]  p_src      Pointer to the list the operations are applied to.
+ * @param[in]  p_dst      Pointer to the list to which the result is written.
+ * @param[in]  p_ops      Pointer to the array of operations.
+ * @param[in]  p_order    Indexes of operations to be applied in ascending order of their addresses.
+ * @param[in]  order_len  Number of indexes in @p p_order.
+ * @param[in]  data_type  Type of data stored in the lists.
+ * @param[in]  extended   Indication if the lists hold extended or short addresses.
  *
- * @retval true   Address @p p_addr has been removed from the list successfully.
- * @retval false  Address @p p_addr could not removed from the list.
+ * @retval true   All operations have been applied.
+ * @retval false  Some addresses could not be added (list is full) or removed (address is missing).
  */
-static bool addr_remove(uint32_t location, uint8_t data_type, bool extended)
+static bool addr_list_merge(const addr_list_t              * p_src,
+                            const addr_list_t              * p_dst,
+                            const nrf_802154_ack_data_op_t * p_ops,
+                            const uint8_t                  * p_order,
+                            uint32_t                         order_len,
+                            uint8_t                          data_type,
+                            bool                             extended)
 {
-    uint32_t * p_addr_array_len;
-    uint8_t  * p_addr_array;
-    uint8_t    entry_size;
-    bool       valid_data_type = true;
+    uint32_t src_len = *p_src->p_len;
+    uint32_t src_idx = 0;
+    uint32_t op_idx  = 0;
+    uint32_t dst_len = 0;
+    bool     result  = true;
 
-    switch (data_type)
+    while ((src_idx < src_len) || (op_idx < order_len))
     {
-        case NRF_802154_ACK_DATA_PENDING_BIT:
-            if (extended)
-            {
-                p_addr_array     = (uint8_t *)m_pending_bit.extended_addr;
-                p_addr_array_len = &m_pending_bit.num_of_ext_addr;
-                entry_size       = EXTENDED_ADDRESS_SIZE;
-            }
-            else
+        const uint8_t                  * p_src_entry = p_src->p_entries + p_src->entry_size * src_idx;
+        const nrf_802154_ack_data_op_t * p_op        = NULL;
+        int8_t                           cmp         = 1;
+
+        if (op_idx < order_len)
+        {
+            p_op = &p_ops[p_order[op_idx]];
+
+            while ((op_idx + 1 < order_len) &&
+                   (addr_compare(p_ops[p_order[op_idx + 1]].p_addr, p_op->p_addr, extended) == 0))
             {
-                p_addr_array     = (uint8_t *)m_pending_bit.short_addr;
-                p_addr_array_len = &m_pending_bit.num_of_short_addr;
-                entry_size       = SHORT_ADDRESS_SIZE;
+                op_idx++;
+                p_op = &p_ops[p_order[op_idx]];
             }
-            break;
 
-        case NRF_802154_ACK_DATA_IE:
-            if (extended)
+            cmp = (src_idx < src_len) ? addr_compare(p_op->p_addr, p_src_entry, extended) : -1;
+        }
+
+        if (cmp > 0)
+        {
+            memcpy(p_dst->p_entries + p_dst->entry_size * dst_len, p_src_entry, p_src->entry_size);
+            dst_len++;
+            src_idx++;
+            continue;
+        }
+
+        if (cmp == 0)
+        {
+            // The entry is replaced or removed.
+            src_idx++;
+        }
+
+        if (p_op->set)
+        {
+            if ((dst_len + (src_len - src_idx) < p_dst->max_len) &&
+                entry_write(p_dst->p_entries + p_dst->entry_size * dst_len, p_op, data_type))
             {
-                p_addr_array     = (uint8_t *)m_ie.ext_data;
-                p_addr_array_len = &m_ie.num_of_ext_data;
-                entry_size       = sizeof(ack_ext_ie_data_t);
+                dst_len++;
             }
             else
             {
-                p_addr_array     = (uint8_t *)m_ie.short_data;
-                p_addr_array_len = &m_ie.num_of_short_data;
-                entry_size       = sizeof(ack_short_ie_data_t);
+                result = false;
             }
-            break;
+        }
+        else if (cmp != 0)
+        {
+            result = false;
+        }
 
-        default:
-            valid_data_type = false;
-            assert(false);
-            break;
+        op_idx++;
     }
 
-    if (!valid_data_type || (*p_addr_array_len == 0))
+    *p_dst->p_len = dst_len;
+
+    return result;
+}
+
+/**
+ * @brief Apply a batch of operations to the ACK data lists.
+ *
+ * The operations are merged into the inactive copy of the lists they modify outside of any critical
+ * section. Lists not modified by the batch are neither copied nor switched. Only switching the active
+ * copies is done with interrupts disabled.
+ *
+ * @param[in]  p_ops      Pointer to the array of operations.
+ * @param[in]  ops_count  Number of operations in @p p_ops, at most @ref NRF_802154_ACK_DATA_BATCH_SIZE.
+ * @param[in]  data_type  Type of data to be set or removed.
+ *
+ * @retval true   All operations have been applied.
+ * @retval false  Some operations could not be applied.
+ */
+static bool ops_batch_apply(const nrf_802154_ack_data_op_t * p_ops,
+                            uint32_t                         ops_count,
+                            uint8_t                          data_type)
+{
+    uint8_t     order[NRF_802154_ACK_DATA_BATCH_SIZE];
+    uint32_t    order_len;
+    uint32_t    primask;
+    addr_list_t src;
+    addr_list_t dst;
+    bool        modified[2] = {false, false};
+    bool        result      = true;
+
+    for (uint32_t i = 0; i < 2; i++)
     {
-        return false;
+        bool extended = (i != 0);
+
+        order_len = ops_sort(p_ops, ops_count, extended, order);
+
+        if (order_len == 0)
+        {
+            continue;
+        }
+
+        addr_list_get(data_type, extended, true, &src);
+        addr_list_get(data_type, extended, false, &dst);
+
+        if (!addr_list_merge(&src, &dst, p_ops, order, order_len, data_type, extended))
+        {
+            result = false;
+        }
+
+        modified[i] = true;
     }
 
-    memmove(p_addr_array + entry_size * location,
-            p_addr_array + entry_size * (location + 1),
-            (*p_addr_array_len - location - 1) * entry_size);
+    primask = __get_PRIMASK();
+    __disable_irq();
+    __DMB();
 
-    (*p_addr_array_len)--;
+    for (uint32_t i = 0; i < 2; i++)
+    {
+        if (modified[i])
+        {
+            m_active[data_type][i] ^= 1;
+        }
+    }
 
-    return true;
+    __set_PRIMASK(primask);
+
+    return result;
 }
 
-static void ie_data_add(uint32_t location, bool extended, const uint8_t * p_data, uint8_t data_len)
+#else // NRF_802154_ACK_DATA_DOUBLE_BUFFER_ENABLED
+
+/**
+ * @brief Apply a batch of operations to the ACK data lists.
+ *
+ * Each operation inserts, replaces or removes a single entry in place. Only the shift of the entries
+ * following it is done with interrupts disabled, so that ACK generation never sees a list in the
+ * middle of an update.
+ *
+ * @param[in]  p_ops      Pointer to the array of operations.
+ * @param[in]  ops_count  Number of operations in @p p_ops.
+ * @param[in]  data_type  Type of data to be set or removed.
+ *
+ * @retval true   All operations have been applied.
+ * @retval false  Some addresses could not be added (list is full or data is too long) or removed
+ *                (address is missing).
+ */
+static bool ops_batch_apply(const nrf_802154_ack_data_op_t * p_ops,
+                            uint32_t                         ops_count,
+                            uint8_t                          data_type)
 {
-    if (extended)
-    {
-        memcpy(m_ie.ext_data[location].ie_data.p_data, p_data, data_len);
-        m_ie.ext_data[location].ie_data.len = data_len;
-    }
-    else
+    bool result = true;
+
+    for (uint32_t i = 0; i < ops_count; i++)
     {
-        memcpy(m_ie.short_data[location].ie_data.p_data, p_data, data_len);
-        m_ie.short_data[location].ie_data.len = data_len;
+        const nrf_802154_ack_data_op_t * p_op = &p_ops[i];
+        addr_list_t                      list;
+        uint32_t                         location;
+        uint32_t                         primask;
+        uint8_t                        * p_entry;
+        bool                             found;
+
+        if ((data_type == NRF_802154_ACK_DATA_IE) && p_op->set &&
+            (p_op->length > NRF_802154_MAX_ACK_IE_SIZE))
+        {
+            result = false;
+            continue;
+        }
+
+        addr_list_get(data_type, p_op->extended, true, &list);
+
+        found   = addr_binary_search(p_op->p_addr, &list, &location, p_op->extended);
+        p_entry = list.p_entries + list.entry_size * location;
+
+        if ((p_op->set && !found && (*list.p_len >= list.max_len)) || (!p_op->set && !found))
+        {
+            result = false;
+            continue;
+        }
+
+        primask = __get_PRIMASK();
+        __disable_irq();
+
+        if (!p_op->set)
+        {
+            memmove(p_entry, p_entry + list.entry_size, list.entry_size * (*list.p_len - location - 1));
+            (*list.p_len)--;
+        }
+        else
+        {
+            if (!found)
+            {
+                memmove(p_entry + list.entry_size, p_entry, list.entry_size * (*list.p_len - location));
+                (*list.p_len)++;
+            }
+
+            (void)entry_write(p_entry, p_op, data_type);
+        }
+
+        __set_PRIMASK(primask);
     }
+
+    return result;
 }
 
+#endif // NRF_802154_ACK_DATA_DOUBLE_BUFFER_ENABLED
+
 /***************************************************************************************************
  * @section Public API
  **************************************************************************************************/
 
 void nrf_802154_ack_data_init(void)
 {
-    memset(&m_pending_bit, 0, sizeof(m_pending_bit));
-    memset(&m_ie, 0, sizeof(m_ie));
+    memset(m_pending_bit, 0, sizeof(m_pending_bit));
+    memset(m_ie, 0, sizeof(m_ie));
+
+#if NRF_802154_ACK_DATA_DOUBLE_BUFFER_ENABLED
+    memset((void *)m_active, 0, sizeof(m_active));
+#endif
 
-    m_pending_bit.enabled = true;
+    m_pending_bit_enabled = true;
     m_src_matching_method = NRF_802154_SRC_ADDR_MATCH_THREAD;
 }
 
 void nrf_802154_ack_data_enable(bool enabled)
 {
-    m_pending_bit.enabled = enabled;
+    m_pending_bit_enabled = enabled;
 }
 
 bool nrf_802154_ack_data_for_addr_set(const uint8_t * p_addr,
@@ -605,62 +812,70 @@ bool nrf_802154_ack_data_for_addr_set(const uint8_t * p_addr,
                                       const void    * p_data,
                                       uint8_t         data_len)
 {
-    uint32_t location = 0;
-
-    if (addr_index_find(p_addr, &location, data_type, extended) ||
-        addr_add(p_addr, location, data_type, extended))
+    nrf_802154_ack_data_op_t op =
     {
-        if (data_type == NRF_802154_ACK_DATA_IE)
-        {
-            ie_data_add(location, extended, p_data, data_len);
-        }
+        .p_addr   = p_addr,
+        .extended = extended,
+        .set      = true,
+        .p_data   = p_data,
+        .length   = data_len,
+    };
 
-        return true;
-    }
-    else
-    {
-        return false;
-    }
+    return nrf_802154_ack_data_for_addrs_update(&op, 1, data_type);
 }
 
 bool nrf_802154_ack_data_for_addr_clear(const uint8_t * p_addr, bool extended, uint8_t data_type)
 {
-    uint32_t location = 0;
+    nrf_802154_ack_data_op_t op =
+    {
+        .p_addr   = p_addr,
+        .extended = extended,
+        .set      = false,
+    };
+
+    return nrf_802154_ack_data_for_addrs_update(&op, 1, data_type);
+}
+
+bool nrf_802154_ack_data_for_addrs_update(const nrf_802154_ack_data_op_t * p_ops,
+                                          uint32_t                         ops_count,
+                                          uint8_t                          data_type)
+{
+    bool result = true;
 
-    if (addr_index_find(p_addr, &location, data_type, extended))
+    if ((data_type != NRF_802154_ACK_DATA_PENDING_BIT) && (data_type != NRF_802154_ACK_DATA_IE))
     {
-        return addr_remove(location, data_type, extended);
+        assert(false);
+        return false;
     }
-    else
+
+    for (uint32_t first = 0; first < ops_count; first += NRF_802154_ACK_DATA_BATCH_SIZE)
     {
-        return false;
+        uint32_t count = ops_count - first;
+
+        if (count > NRF_802154_ACK_DATA_BATCH_SIZE)
+        {
+            count = NRF_802154_ACK_DATA_BATCH_SIZE;
+        }
+
+        if (!ops_batch_apply(&p_ops[first], count, data_type))
+        {
+            result = false;
+        }
     }
+
+    return result;
 }
 
 void nrf_802154_ack_data_reset(bool extended, uint8_t data_type)
 {
+    addr_list_t list;
+
     switch (data_type)
     {
         case NRF_802154_ACK_DATA_PENDING_BIT:
-            if (extended)
-            {
-                m_pending_bit.num_of_ext_addr = 0;
-            }
-            else
-            {
-                m_pending_bit.num_of_short_addr = 0;
-            }
-            break;
-
         case NRF_802154_ACK_DATA_IE:
-            if (extended)
-            {
-                m_ie.num_of_ext_data = 0;
-            }
-            else
-            {
-                m_ie.num_of_short_data = 0;
-            }
+            addr_list_get(data_type, extended, true, &list);
+            *list.p_len = 0;
             break;
 
         default:
@@ -707,6 +922,10 @@ bool nrf_802154_ack_data_pending_bit_should_be_set(const uint8_t * p_frame)
             ret = false;
     }
 
+#if NRF_802154_ACK_DATA_PENDING_BIT_HOOK_ENABLED
+    ret = nrf_802154_ack_pending_bit_decide(p_frame, ret);
+#endif
+
     return ret;
 }
 
@@ -714,25 +933,26 @@ const uint8_t * nrf_802154_ack_data_ie_get(const uint8_t * p_src_addr,
                                            bool            src_addr_extended,
                                            uint8_t       * p_ie_length)
 {
-    uint32_t location;
+    uint32_t    location;
+    addr_list_t list;
 
     if (NULL == p_src_addr)
     {
         return NULL;
     }
 
-    if (addr_index_find(p_src_addr, &location, NRF_802154_ACK_DATA_IE, src_addr_extended))
+    // The entry is taken from the same copy of the list the address was found in.
+    addr_list_get(NRF_802154_ACK_DATA_IE, src_addr_extended, true, &list);
+
+    if (addr_binary_search(p_src_addr, &list, &location, src_addr_extended))
     {
-        if (src_addr_extended)
-        {
-            *p_ie_length = m_ie.ext_data[location].ie_data.len;
-            return m_ie.ext_data[location].ie_data.p_data;
-        }
-        else
-        {
-            *p_ie_length = m_ie.short_data[location].ie_data.len;
-            return m_ie.short_data[location].ie_data.p_data;
-        }
+        ie_data_t * p_ie_data = (ie_data_t *)(list.p_entries + list.entry_size * location +
+                                              (src_addr_extended ?
+                                               offsetof(ack_ext_ie_data_t, ie_data) :
+                                               offsetof(ack_short_ie_data_t, ie_data)));
+
+        *p_ie_length = p_ie_data->len;
+        return p_ie_data->p_data;
     }
     else
     {
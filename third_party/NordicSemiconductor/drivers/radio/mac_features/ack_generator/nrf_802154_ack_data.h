@@ -92,6 +92,24 @@ bool nrf_802154_ack_data_for_addr_set(const uint8_t * p_addr,
  */
 bool nrf_802154_ack_data_for_addr_clear(const uint8_t * p_addr, bool extended, uint8_t data_type);
 
+/**
+ * @brief Adds addresses to and removes addresses from the ACK data list in a single pass.
+ *
+ * The operations are merged with the list outside of any critical section, and the updated list
+ * replaces the previous one atomically. Of several operations on the same address only the last one
+ * takes effect. The operations that can be applied are applied even if some others fail.
+ *
+ * @param[in]  p_ops      Pointer to the array of operations to be applied.
+ * @param[in]  ops_count  Number of operations in @p p_ops.
+ * @param[in]  data_type  Type of data to be set or removed. Refer to the @ref nrf_802154_ack_data_t type.
+ *
+ * @retval true   All operations have been applied.
+ * @retval false  Some addresses were not added (list is full) or removed (address is missing from the list).
+ */
+bool nrf_802154_ack_data_for_addrs_update(const nrf_802154_ack_data_op_t * p_ops,
+                                          uint32_t                         ops_count,
+                                          uint8_t                          data_type);
+
 /**
  * @brief Removes all addresses of a given length from the ACK data list.
  *
@@ -0,0 +1,534 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the antenna diversity feature of the 802.15.4 driver.
+ *
+ * The antenna is selected by a GPIO pin driven through a GPIOTE channel. While the receiver
+ * searches for a preamble, a timer started by the RADIO_RXREADY event toggles the pin in fixed
+ * intervals. The RADIO_ADDRESS event stops the timer, so the antenna that synchronized to the SFD
+ * is kept for the rest of the frame and for the acknowledgment. The pin input buffer is connected
+ * to read back the antenna that received a frame.
+ */
+
+#include "nrf_802154_ant_diversity.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_frame_parser.h"
+#include "nrf_802154_peripherals.h"
+#include "nrf_gpio.h"
+#include "nrf_gpiote.h"
+#include "nrf_ppi.h"
+#include "nrf_radio.h"
+#include "nrf_timer.h"
+
+#define RSSI_AVG_SHIFT     3 ///< Weight of a new RSSI sample in the moving average is 1/2^RSSI_AVG_SHIFT.
+#define RSSI_AVG_FRAC_BITS 4 ///< Number of fractional bits of the RSSI moving average.
+
+#define PPI_TIMER_TOGGLE   NRF_802154_PPI_ANT_DIVERSITY_TIMER_COMPARE_TO_GPIOTE
+#define PPI_READY_START    NRF_802154_PPI_ANT_DIVERSITY_RADIO_READY_TO_TIMER_START
+#define PPI_ADDRESS_STOP   NRF_802154_PPI_ANT_DIVERSITY_RADIO_ADDR_TO_TIMER_STOP
+
+/**
+ * @brief Antenna last acknowledged by a destination.
+ */
+typedef struct
+{
+    uint8_t                            addr[EXTENDED_ADDRESS_SIZE]; ///< Destination address (little-endian).
+    bool                               extended;                    ///< If @ref addr is an extended address.
+    bool                               valid;                       ///< If the entry is in use.
+    nrf_802154_ant_diversity_antenna_t antenna;                     ///< Antenna to be used for the next frame.
+    uint32_t                           last_used;                   ///< Value of @ref m_dst_use_count when the entry was last used.
+} dst_antenna_t;
+
+static nrf_802154_ant_diversity_mode_t    m_mode;           ///< Antenna diversity mode.
+static nrf_802154_ant_diversity_antenna_t m_manual_antenna; ///< Antenna used in the manual mode.
+static nrf_802154_ant_diversity_antenna_t m_tx_antenna;     ///< Antenna used by the last transmitted frame.
+static uint16_t                           m_toggle_time;    ///< Time between antenna switches during a preamble search in us.
+static bool                               m_rx_searching;   ///< If the antenna is switched by hardware.
+
+static int16_t m_rssi_avg[NRF_802154_ANT_DIVERSITY_ANTENNAS]; ///< RSSI moving averages with fractional bits.
+
+static dst_antenna_t m_dst_antennas[NRF_802154_ANT_DIVERSITY_DESTINATIONS]; ///< Antennas learned for destinations.
+static uint32_t      m_dst_use_count;                                       ///< Counter ordering the use of entries.
+
+static nrf_802154_ant_diversity_stats_t m_stats; ///< Statistics of the antenna diversity.
+
+#if NRF_802154_ANT_DIVERSITY_ENABLED
+
+/** Drive the selection pin to select given antenna. */
+static void antenna_select(nrf_802154_ant_diversity_antenna_t antenna)
+{
+    if (antenna == NRF_802154_ANT_DIVERSITY_ANTENNA_2)
+    {
+        nrf_gpiote_task_set(nrf_gpiote_set_task_get(NRF_802154_ANT_DIVERSITY_GPIOTE_CHANNEL));
+    }
+    else
+    {
+        nrf_gpiote_task_set(nrf_gpiote_clr_task_get(NRF_802154_ANT_DIVERSITY_GPIOTE_CHANNEL));
+    }
+}
+
+/** Get the antenna selected by the pin. */
+static nrf_802154_ant_diversity_antenna_t antenna_current_get(void)
+{
+    return nrf_gpio_pin_read(NRF_802154_ANT_DIVERSITY_PIN) ?
+           NRF_802154_ANT_DIVERSITY_ANTENNA_2 : NRF_802154_ANT_DIVERSITY_ANTENNA_1;
+}
+
+/** Configure the pin, the timer and the PPIs used to switch antennas. */
+static void hardware_enable(void)
+{
+    nrf_gpio_cfg(NRF_802154_ANT_DIVERSITY_PIN,
+                 NRF_GPIO_PIN_DIR_OUTPUT,
+                 NRF_GPIO_PIN_INPUT_CONNECT,
+                 NRF_GPIO_PIN_NOPULL,
+                 NRF_GPIO_PIN_S0S1,
+                 NRF_GPIO_PIN_NOSENSE);
+
+    nrf_gpiote_task_configure(NRF_802154_ANT_DIVERSITY_GPIOTE_CHANNEL,
+                              NRF_802154_ANT_DIVERSITY_PIN,
+                              NRF_GPIOTE_POLARITY_TOGGLE,
+                              (m_manual_antenna == NRF_802154_ANT_DIVERSITY_ANTENNA_2) ?
+                              NRF_GPIOTE_INITIAL_VALUE_HIGH : NRF_GPIOTE_INITIAL_VALUE_LOW);
+    nrf_gpiote_task_enable(NRF_802154_ANT_DIVERSITY_GPIOTE_CHANNEL);
+
+    nrf_timer_mode_set(NRF_802154_ANT_DIVERSITY_TIMER_INSTANCE, NRF_TIMER_MODE_TIMER);
+    nrf_timer_bit_width_set(NRF_802154_ANT_DIVERSITY_TIMER_INSTANCE, NRF_TIMER_BIT_WIDTH_16);
+    nrf_timer_frequency_set(NRF_802154_ANT_DIVERSITY_TIMER_INSTANCE, NRF_TIMER_FREQ_1MHz);
+    nrf_timer_cc_write(NRF_802154_ANT_DIVERSITY_TIMER_INSTANCE,
+                       NRF_TIMER_CC_CHANNEL0,
+                       m_toggle_time);
+    nrf_timer_shorts_enable(NRF_802154_ANT_DIVERSITY_TIMER_INSTANCE,
+                            NRF_TIMER_SHORT_COMPARE0_CLEAR_MASK);
+
+    nrf_ppi_channel_endpoint_setup(PPI_TIMER_TOGGLE,
+                                   (uint32_t)nrf_timer_event_address_get(
+                                       NRF_802154_ANT_DIVERSITY_TIMER_INSTANCE,
+                                       NRF_TIMER_EVENT_COMPARE0),
+                                   nrf_gpiote_task_addr_get(
+                                       nrf_gpiote_out_task_get(
+                                           NRF_802154_ANT_DIVERSITY_GPIOTE_CHANNEL)));
+    nrf_ppi_channel_and_fork_endpoint_setup(PPI_READY_START,
+                                            (uint32_t)nrf_radio_event_address_get(
+                                                NRF_RADIO_EVENT_RXREADY),
+                                            (uint32_t)nrf_timer_task_address_get(
+                                                NRF_802154_ANT_DIVERSITY_TIMER_INSTANCE,
+                                                NRF_TIMER_TASK_CLEAR),
+                                            (uint32_t)nrf_timer_task_address_get(
+                                                NRF_802154_ANT_DIVERSITY_TIMER_INSTANCE,
+                                                NRF_TIMER_TASK_START));
+    nrf_ppi_channel_endpoint_setup(PPI_ADDRESS_STOP,
+                                   (uint32_t)nrf_radio_event_address_get(NRF_RADIO_EVENT_ADDRESS),
+                                   (uint32_t)nrf_timer_task_address_get(
+                                       NRF_802154_ANT_DIVERSITY_TIMER_INSTANCE,
+                                       NRF_TIMER_TASK_STOP));
+}
+
+/** Release the pin, the timer and the PPIs used to switch antennas. */
+static void hardware_disable(void)
+{
+    nrf_ppi_channel_disable(PPI_READY_START);
+    nrf_ppi_channel_disable(PPI_ADDRESS_STOP);
+    nrf_ppi_channel_disable(PPI_TIMER_TOGGLE);
+
+    nrf_timer_task_trigger(NRF_802154_ANT_DIVERSITY_TIMER_INSTANCE, NRF_TIMER_TASK_SHUTDOWN);
+
+    nrf_gpiote_te_default(NRF_802154_ANT_DIVERSITY_GPIOTE_CHANNEL);
+    nrf_gpio_cfg_default(NRF_802154_ANT_DIVERSITY_PIN);
+}
+
+#else // NRF_802154_ANT_DIVERSITY_ENABLED
+
+static void antenna_select(nrf_802154_ant_diversity_antenna_t antenna)
+{
+    (void)antenna;
+}
+
+static nrf_802154_ant_diversity_antenna_t antenna_current_get(void)
+{
+    return m_manual_antenna;
+}
+
+static void hardware_enable(void)
+{
+    // Intentionally empty.
+}
+
+static void hardware_disable(void)
+{
+    // Intentionally empty.
+}
+
+#endif // NRF_802154_ANT_DIVERSITY_ENABLED
+
+/** Get the antenna that received frames with the highest average RSSI. */
+static nrf_802154_ant_diversity_antenna_t rx_antenna_preferred_get(void)
+{
+    const nrf_802154_ant_diversity_antenna_stats_t * p_ant = m_stats.antenna;
+
+    if ((p_ant[NRF_802154_ANT_DIVERSITY_ANTENNA_1].rx_frames == 0) ||
+        (p_ant[NRF_802154_ANT_DIVERSITY_ANTENNA_2].rx_frames == 0))
+    {
+        // Prefer the antenna that received anything.
+        return (p_ant[NRF_802154_ANT_DIVERSITY_ANTENNA_2].rx_frames != 0) ?
+               NRF_802154_ANT_DIVERSITY_ANTENNA_2 : NRF_802154_ANT_DIVERSITY_ANTENNA_1;
+    }
+
+    return (m_rssi_avg[NRF_802154_ANT_DIVERSITY_ANTENNA_2] >
+            m_rssi_avg[NRF_802154_ANT_DIVERSITY_ANTENNA_1]) ?
+           NRF_802154_ANT_DIVERSITY_ANTENNA_2 : NRF_802154_ANT_DIVERSITY_ANTENNA_1;
+}
+
+/** Get the other antenna. */
+static nrf_802154_ant_diversity_antenna_t antenna_other_get(
+    nrf_802154_ant_diversity_antenna_t antenna)
+{
+    return (antenna == NRF_802154_ANT_DIVERSITY_ANTENNA_1) ?
+           NRF_802154_ANT_DIVERSITY_ANTENNA_2 : NRF_802154_ANT_DIVERSITY_ANTENNA_1;
+}
+
+/**
+ * @brief Find the entry of the destination of a frame.
+ *
+ * @param[in]  p_frame  Pointer to the buffer that contains PHR and PSDU of the frame.
+ * @param[in]  create   If the least recently used entry is to be taken if there is none yet.
+ *
+ * @returns  Pointer to the entry or NULL if the frame has no unicast destination address or
+ *           there is no entry and @p create is false.
+ */
+static dst_antenna_t * dst_antenna_find(const uint8_t * p_frame, bool create)
+{
+    bool            extended;
+    const uint8_t * p_addr = nrf_802154_frame_parser_dst_addr_get(p_frame, &extended);
+    uint8_t         size   = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+    dst_antenna_t * p_free = NULL;
+
+    if ((p_addr == NULL) ||
+        (!extended && (0 == memcmp(p_addr, BROADCAST_ADDRESS, SHORT_ADDRESS_SIZE))))
+    {
+        return NULL;
+    }
+
+    for (uint32_t i = 0; i < NRF_802154_ANT_DIVERSITY_DESTINATIONS; i++)
+    {
+        dst_antenna_t * p_entry = &m_dst_antennas[i];
+
+        if (p_entry->valid &&
+            (p_entry->extended == extended) &&
+            (0 == memcmp(p_entry->addr, p_addr, size)))
+        {
+            p_entry->last_used = ++m_dst_use_count;
+            return p_entry;
+        }
+
+        // Take the first free entry, or the least recently used one if all are taken.
+        if ((p_free == NULL) ||
+            (p_free->valid && (!p_entry->valid || (p_entry->last_used < p_free->last_used))))
+        {
+            p_free = p_entry;
+        }
+    }
+
+    if (!create)
+    {
+        return NULL;
+    }
+
+    memcpy(p_free->addr, p_addr, size);
+    p_free->extended  = extended;
+    p_free->valid     = true;
+    p_free->antenna   = m_tx_antenna;
+    p_free->last_used = ++m_dst_use_count;
+
+    return p_free;
+}
+
+void nrf_802154_ant_diversity_init(void)
+{
+    m_mode           = NRF_802154_ANT_DIVERSITY_MODE_DISABLED;
+    m_manual_antenna = NRF_802154_ANT_DIVERSITY_ANTENNA_1;
+    m_tx_antenna     = NRF_802154_ANT_DIVERSITY_ANTENNA_1;
+    m_toggle_time    = NRF_802154_ANT_DIVERSITY_TOGGLE_TIME_US;
+    m_rx_searching   = false;
+
+    nrf_802154_ant_diversity_stats_reset();
+}
+
+bool nrf_802154_ant_diversity_mode_set(nrf_802154_ant_diversity_mode_t mode)
+{
+#if !NRF_802154_ANT_DIVERSITY_ENABLED
+    if (mode != NRF_802154_ANT_DIVERSITY_MODE_DISABLED)
+    {
+        return false;
+    }
+#endif // !NRF_802154_ANT_DIVERSITY_ENABLED
+
+    if (mode == m_mode)
+    {
+        return true;
+    }
+
+    nrf_802154_ant_diversity_rx_search_stop();
+
+    if (mode == NRF_802154_ANT_DIVERSITY_MODE_DISABLED)
+    {
+        hardware_disable();
+    }
+    else if (m_mode == NRF_802154_ANT_DIVERSITY_MODE_DISABLED)
+    {
+        hardware_enable();
+    }
+
+    m_mode = mode;
+
+    antenna_select(m_manual_antenna);
+
+    return true;
+}
+
+nrf_802154_ant_diversity_mode_t nrf_802154_ant_diversity_mode_get(void)
+{
+    return m_mode;
+}
+
+void nrf_802154_ant_diversity_antenna_set(nrf_802154_ant_diversity_antenna_t antenna)
+{
+    assert(antenna < NRF_802154_ANT_DIVERSITY_ANTENNAS);
+
+    m_manual_antenna = antenna;
+
+    if (m_mode == NRF_802154_ANT_DIVERSITY_MODE_MANUAL)
+    {
+        antenna_select(antenna);
+    }
+}
+
+nrf_802154_ant_diversity_antenna_t nrf_802154_ant_diversity_antenna_get(void)
+{
+    return (m_mode == NRF_802154_ANT_DIVERSITY_MODE_DISABLED) ?
+           m_manual_antenna : antenna_current_get();
+}
+
+void nrf_802154_ant_diversity_toggle_time_set(uint16_t time)
+{
+    m_toggle_time = time;
+
+#if NRF_802154_ANT_DIVERSITY_ENABLED
+    nrf_timer_cc_write(NRF_802154_ANT_DIVERSITY_TIMER_INSTANCE, NRF_TIMER_CC_CHANNEL0, time);
+#endif
+}
+
+void nrf_802154_ant_diversity_stats_get(nrf_802154_ant_diversity_stats_t * p_stats)
+{
+    *p_stats = m_stats;
+
+    for (uint32_t i = 0; i < NRF_802154_ANT_DIVERSITY_ANTENNAS; i++)
+    {
+        p_stats->antenna[i].rx_rssi = (int8_t)(m_rssi_avg[i] >> RSSI_AVG_FRAC_BITS);
+    }
+}
+
+void nrf_802154_ant_diversity_stats_reset(void)
+{
+    memset(&m_stats, 0, sizeof(m_stats));
+    memset(m_rssi_avg, 0, sizeof(m_rssi_avg));
+    memset(m_dst_antennas, 0, sizeof(m_dst_antennas));
+    m_dst_use_count = 0;
+}
+
+void nrf_802154_ant_diversity_rx_search_start(void)
+{
+    switch (m_mode)
+    {
+        case NRF_802154_ANT_DIVERSITY_MODE_MANUAL:
+            antenna_select(m_manual_antenna);
+            break;
+
+        case NRF_802154_ANT_DIVERSITY_MODE_AUTO:
+#if NRF_802154_ANT_DIVERSITY_ENABLED
+            if (!m_rx_searching)
+            {
+                // Anomaly 78: use SHUTDOWN instead of STOP and CLEAR.
+                nrf_timer_task_trigger(NRF_802154_ANT_DIVERSITY_TIMER_INSTANCE,
+                                       NRF_TIMER_TASK_SHUTDOWN);
+                antenna_select(rx_antenna_preferred_get());
+
+                nrf_ppi_channel_enable(PPI_TIMER_TOGGLE);
+                nrf_ppi_channel_enable(PPI_ADDRESS_STOP);
+                nrf_ppi_channel_enable(PPI_READY_START);
+
+                m_rx_searching = true;
+            }
+#endif // NRF_802154_ANT_DIVERSITY_ENABLED
+            break;
+
+        default:
+            break;
+    }
+}
+
+void nrf_802154_ant_diversity_rx_search_stop(void)
+{
+    if (!m_rx_searching)
+    {
+        return;
+    }
+
+#if NRF_802154_ANT_DIVERSITY_ENABLED
+    nrf_ppi_channel_disable(PPI_READY_START);
+    nrf_ppi_channel_disable(PPI_ADDRESS_STOP);
+    nrf_ppi_channel_disable(PPI_TIMER_TOGGLE);
+
+    // Anomaly 78: use SHUTDOWN instead of STOP and CLEAR.
+    nrf_timer_task_trigger(NRF_802154_ANT_DIVERSITY_TIMER_INSTANCE, NRF_TIMER_TASK_SHUTDOWN);
+#endif // NRF_802154_ANT_DIVERSITY_ENABLED
+
+    m_rx_searching = false;
+}
+
+void nrf_802154_ant_diversity_rx_frame_hook(int8_t rssi)
+{
+    nrf_802154_ant_diversity_antenna_t antenna;
+    int16_t                            sample = (int16_t)(rssi * (1 << RSSI_AVG_FRAC_BITS));
+
+    if (m_mode == NRF_802154_ANT_DIVERSITY_MODE_DISABLED)
+    {
+        return;
+    }
+
+    antenna = antenna_current_get();
+
+    if (m_stats.antenna[antenna].rx_frames == 0)
+    {
+        m_rssi_avg[antenna] = sample;
+    }
+    else
+    {
+        m_rssi_avg[antenna] += (sample - m_rssi_avg[antenna]) / (1 << RSSI_AVG_SHIFT);
+    }
+
+    m_stats.antenna[antenna].rx_frames++;
+}
+
+void nrf_802154_ant_diversity_rx_crcerror_hook(void)
+{
+    if (m_mode != NRF_802154_ANT_DIVERSITY_MODE_DISABLED)
+    {
+        m_stats.antenna[antenna_current_get()].rx_crc_errors++;
+    }
+}
+
+void nrf_802154_ant_diversity_tx_antenna_select(const uint8_t * p_frame)
+{
+    const dst_antenna_t * p_entry;
+
+    switch (m_mode)
+    {
+        case NRF_802154_ANT_DIVERSITY_MODE_MANUAL:
+            m_tx_antenna = m_manual_antenna;
+            break;
+
+        case NRF_802154_ANT_DIVERSITY_MODE_AUTO:
+            p_entry      = dst_antenna_find(p_frame, false);
+            m_tx_antenna = (p_entry != NULL) ? p_entry->antenna : rx_antenna_preferred_get();
+            break;
+
+        default:
+            return;
+    }
+
+    antenna_select(m_tx_antenna);
+}
+
+void nrf_802154_ant_diversity_transmitted_hook(const uint8_t * p_frame)
+{
+    dst_antenna_t * p_entry;
+
+    if (m_mode == NRF_802154_ANT_DIVERSITY_MODE_DISABLED)
+    {
+        return;
+    }
+
+    m_stats.antenna[m_tx_antenna].tx_frames++;
+
+    if (nrf_802154_frame_parser_ar_bit_is_set(p_frame))
+    {
+        m_stats.antenna[m_tx_antenna].tx_acked++;
+
+        p_entry = dst_antenna_find(p_frame, true);
+
+        if (p_entry != NULL)
+        {
+            p_entry->antenna = m_tx_antenna;
+        }
+    }
+}
+
+bool nrf_802154_ant_diversity_tx_failed_hook(const uint8_t * p_frame, nrf_802154_tx_error_t error)
+{
+    dst_antenna_t * p_entry;
+
+    if (m_mode == NRF_802154_ANT_DIVERSITY_MODE_DISABLED)
+    {
+        return true;
+    }
+
+    switch (error)
+    {
+        case NRF_802154_TX_ERROR_NO_ACK:
+        case NRF_802154_TX_ERROR_INVALID_ACK:
+            m_stats.antenna[m_tx_antenna].tx_frames++;
+            m_stats.antenna[m_tx_antenna].tx_no_ack++;
+
+            if (m_mode == NRF_802154_ANT_DIVERSITY_MODE_AUTO)
+            {
+                // Retransmissions to this destination are to be tried on the other antenna.
+                p_entry = dst_antenna_find(p_frame, true);
+
+                if ((p_entry != NULL) && (p_entry->antenna == m_tx_antenna))
+                {
+                    p_entry->antenna = antenna_other_get(m_tx_antenna);
+                    m_stats.tx_switches++;
+                }
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    return true;
+}
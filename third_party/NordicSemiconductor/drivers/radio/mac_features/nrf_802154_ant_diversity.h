@@ -0,0 +1,168 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Module that implements the antenna diversity feature.
+ *
+ */
+
+#ifndef NRF_802154_ANT_DIVERSITY_H_
+#define NRF_802154_ANT_DIVERSITY_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_types.h"
+
+/**
+ * @defgroup nrf_802154_ant_diversity Antenna diversity
+ * @{
+ * @ingroup nrf_802154
+ * @brief Selection of one of two antennas connected through an RF switch.
+ *
+ * While the receiver searches for a preamble, the antenna is switched by hardware in fixed
+ * intervals, starting from the antenna that received the strongest frames so far. The antenna
+ * in use when the receiver synchronizes to the SFD is kept until the end of the frame and for
+ * its acknowledgment. Each transmitted frame uses the antenna that was last acknowledged by its
+ * recipient, and the other antenna after the recipient failed to acknowledge a frame.
+ */
+
+/**
+ * @brief Initializes the antenna diversity.
+ *
+ * The antenna diversity is disabled, antenna 1 is selected and the statistics are cleared.
+ */
+void nrf_802154_ant_diversity_init(void);
+
+/**
+ * @brief Sets the mode of the antenna diversity.
+ *
+ * @param[in]  mode  Antenna diversity mode.
+ *
+ * @retval true   The mode is set.
+ * @retval false  The antenna diversity is not enabled in the driver configuration.
+ */
+bool nrf_802154_ant_diversity_mode_set(nrf_802154_ant_diversity_mode_t mode);
+
+/**
+ * @brief Gets the mode of the antenna diversity.
+ *
+ * @returns  Antenna diversity mode.
+ */
+nrf_802154_ant_diversity_mode_t nrf_802154_ant_diversity_mode_get(void);
+
+/**
+ * @brief Selects the antenna used in the manual mode.
+ *
+ * @param[in]  antenna  Antenna to be used.
+ */
+void nrf_802154_ant_diversity_antenna_set(nrf_802154_ant_diversity_antenna_t antenna);
+
+/**
+ * @brief Gets the antenna selected by the antenna diversity.
+ *
+ * @returns  Antenna connected to the radio at the moment of the call.
+ */
+nrf_802154_ant_diversity_antenna_t nrf_802154_ant_diversity_antenna_get(void);
+
+/**
+ * @brief Sets the time the receiver listens on one antenna while searching for a preamble.
+ *
+ * @param[in]  time  Time in microseconds.
+ */
+void nrf_802154_ant_diversity_toggle_time_set(uint16_t time);
+
+/**
+ * @brief Gets the statistics of the antenna diversity.
+ *
+ * @param[out]  p_stats  Pointer to the structure for the statistics.
+ */
+void nrf_802154_ant_diversity_stats_get(nrf_802154_ant_diversity_stats_t * p_stats);
+
+/**
+ * @brief Clears the statistics and the antennas learned for destination addresses.
+ */
+void nrf_802154_ant_diversity_stats_reset(void);
+
+/**
+ * @brief Prepares the antenna switching for the receive operation.
+ *
+ * This function is called by the core module when the receiver is being enabled.
+ */
+void nrf_802154_ant_diversity_rx_search_start(void);
+
+/**
+ * @brief Stops the antenna switching.
+ *
+ * This function is called by the core module when the receive operation is terminated.
+ */
+void nrf_802154_ant_diversity_rx_search_stop(void);
+
+/**
+ * @brief Handles a frame received with a correct FCS.
+ *
+ * @param[in]  rssi  RSSI of the received frame in dBm.
+ */
+void nrf_802154_ant_diversity_rx_frame_hook(int8_t rssi);
+
+/**
+ * @brief Handles a frame received with an incorrect FCS.
+ */
+void nrf_802154_ant_diversity_rx_crcerror_hook(void);
+
+/**
+ * @brief Selects the antenna for the transmission of a frame.
+ *
+ * This function is called by the core module when the transmitter is being enabled.
+ *
+ * @param[in]  p_frame  Pointer to the buffer that contains PHR and PSDU of the transmitted frame.
+ */
+void nrf_802154_ant_diversity_tx_antenna_select(const uint8_t * p_frame);
+
+/**
+ * @brief Handles a transmitted event.
+ *
+ * @param[in]  p_frame  Pointer to the buffer that contains the transmitted frame.
+ */
+void nrf_802154_ant_diversity_transmitted_hook(const uint8_t * p_frame);
+
+/**
+ * @brief Handles a TX failed event.
+ *
+ * @param[in]  p_frame  Pointer to the buffer that contains a frame that was not transmitted.
+ * @param[in]  error    Cause of failed transmission.
+ *
+ * @retval  true   TX failed event is to be propagated to the MAC layer.
+ */
+bool nrf_802154_ant_diversity_tx_failed_hook(const uint8_t * p_frame, nrf_802154_tx_error_t error);
+
+/**
+ *@}
+ **/
+
+#endif // NRF_802154_ANT_DIVERSITY_H_
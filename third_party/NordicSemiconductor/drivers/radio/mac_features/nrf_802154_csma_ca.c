@@ -41,6 +41,7 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include "nrf_802154.h"
 #include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
 #include "../nrf_802154_debug.h"
@@ -224,14 +225,17 @@ bool nrf_802154_csma_ca_abort(nrf_802154_term_t term_lvl, req_originator_t req_o
 
 bool nrf_802154_csma_ca_tx_failed_hook(const uint8_t * p_frame, nrf_802154_tx_error_t error)
 {
-    (void)error;
-
     bool result = true;
 
     if (p_frame == mp_data)
     {
         nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_CSMA_TX_FAILED);
 
+        if (procedure_is_running() && (error == NRF_802154_TX_ERROR_BUSY_CHANNEL))
+        {
+            nrf_802154_csma_ca_cca_done(p_frame, false);
+        }
+
         result = channel_busy();
 
         nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_CSMA_TX_FAILED);
@@ -247,6 +251,12 @@ bool nrf_802154_csma_ca_tx_started_hook(const uint8_t * p_frame)
         nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_CSMA_TX_STARTED);
 
         assert(!nrf_802154_timer_sched_is_running(&m_timer));
+
+        if (procedure_is_running())
+        {
+            nrf_802154_csma_ca_cca_done(p_frame, true);
+        }
+
         procedure_stop();
 
         nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_CSMA_TX_STARTED);
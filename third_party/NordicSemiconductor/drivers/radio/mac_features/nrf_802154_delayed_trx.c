@@ -528,6 +528,11 @@ bool nrf_802154_delayed_trx_abort(nrf_802154_term_t term_lvl, req_originator_t r
     return result;
 }
 
+bool nrf_802154_delayed_trx_receive_is_ongoing(void)
+{
+    return dly_op_state_get(RSCH_DLY_RX) == DELAYED_TRX_OP_STATE_ONGOING;
+}
+
 void nrf_802154_delayed_trx_rx_started_hook(const uint8_t * p_frame)
 {
     if (dly_op_state_get(RSCH_DLY_RX) == DELAYED_TRX_OP_STATE_ONGOING)
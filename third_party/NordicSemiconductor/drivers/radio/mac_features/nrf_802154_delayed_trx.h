@@ -127,6 +127,14 @@ bool nrf_802154_delayed_trx_receive_cancel(void);
  */
 bool nrf_802154_delayed_trx_abort(nrf_802154_term_t term_lvl, req_originator_t req_orig);
 
+/**
+ * @brief Checks if a delayed reception window is ongoing.
+ *
+ * @retval  true   The radio is receiving within a delayed reception window.
+ * @retval  false  No delayed reception window is ongoing.
+ */
+bool nrf_802154_delayed_trx_receive_is_ongoing(void);
+
 /**
  * @brief Extends the timeout timer when the reception start is detected and there is not enough
  *        time left for a delayed RX operation.
@@ -44,15 +44,35 @@
 #include <stdint.h>
 #include <string.h>
 
+#include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
 #include "nrf_802154_frame_parser.h"
 #include "nrf_802154_pib.h"
+#include "timer_scheduler/nrf_802154_timer_sched.h"
 
 #define FCF_CHECK_OFFSET           (PHR_SIZE + FCF_SIZE)
 #define PANID_CHECK_OFFSET         (DEST_ADDR_OFFSET)
 #define SHORT_ADDR_CHECK_OFFSET    (DEST_ADDR_OFFSET + SHORT_ADDRESS_SIZE)
 #define EXTENDED_ADDR_CHECK_OFFSET (DEST_ADDR_OFFSET + EXTENDED_ADDRESS_SIZE)
 
+#define FRAME_TYPES_ALL            0xff ///< Bitmask allowing all frame types.
+
+static uint8_t m_frame_type_allowlist; ///< Bitmask of frame types accepted by the early filter.
+
+static uint8_t m_blocked_pan_ids[NRF_802154_FILTER_BLOCKED_PAN_IDS][PAN_ID_SIZE];
+static uint8_t m_blocked_short_addrs[NRF_802154_FILTER_BLOCKED_SHORT_ADDRESSES][SHORT_ADDRESS_SIZE];
+static uint8_t m_blocked_extended_addrs[NRF_802154_FILTER_BLOCKED_EXTENDED_ADDRESSES][EXTENDED_ADDRESS_SIZE];
+
+static volatile uint8_t m_num_blocked_pan_ids;          ///< Number of valid entries in @ref m_blocked_pan_ids.
+static volatile uint8_t m_num_blocked_short_addrs;      ///< Number of valid entries in @ref m_blocked_short_addrs.
+static volatile uint8_t m_num_blocked_extended_addrs;   ///< Number of valid entries in @ref m_blocked_extended_addrs.
+
+static uint32_t m_beacon_req_interval;   ///< Minimum interval between accepted Beacon Requests, 0 if disabled.
+static uint32_t m_beacon_req_time;       ///< Time of the last accepted Beacon Request.
+static bool     m_beacon_req_time_valid; ///< If @ref m_beacon_req_time holds time of an accepted frame.
+
+static nrf_802154_filter_stats_t m_stats; ///< Statistics of the early frame filter.
+
 /**
  * @brief Check if given frame version is allowed for given frame type.
  *
@@ -298,6 +318,28 @@ static nrf_802154_rx_error_t dst_addressing_end_offset_get(const uint8_t * p_dat
     return result;
 }
 
+/**
+ * @brief Check if incoming frame contains destination addressing fields verified by the filter.
+ *
+ * @param[in] p_data         Pointer to a buffer containing PHR and PSDU of the incoming frame.
+ * @param[in] frame_type     Type of incoming frame.
+ * @param[in] frame_version  Version of incoming frame.
+ *
+ * @retval true   Destination addressing fields of the frame are verified by @ref dst_addr_check.
+ * @retval false  The frame has no destination addressing fields to verify.
+ */
+static bool dst_addressing_is_present(const uint8_t * p_data,
+                                      uint8_t         frame_type,
+                                      uint8_t         frame_version)
+{
+    uint8_t num_bytes = FCF_CHECK_OFFSET;
+
+    return dst_addressing_may_be_present(frame_type) &&
+           (dst_addressing_end_offset_get(p_data, &num_bytes, frame_type, frame_version) ==
+            NRF_802154_RX_ERROR_NONE) &&
+           (num_bytes != FCF_CHECK_OFFSET);
+}
+
 /**
  * Verify if destination PAN Id of incoming frame allows processing by this node.
  *
@@ -437,6 +479,183 @@ static nrf_802154_rx_error_t dst_addr_check(const uint8_t * p_data, uint8_t fram
     return NRF_802154_RX_ERROR_INVALID_FRAME;
 }
 
+/**
+ * @brief Check if the early filter checks any field following the destination addressing fields.
+ *
+ * @retval true   Source addressing or the command identifier of the incoming frame is checked.
+ * @retval false  The frame is accepted once its destination addressing fields are verified.
+ */
+static bool early_src_filter_is_enabled(void)
+{
+    return ((m_num_blocked_pan_ids != 0) ||
+            (m_num_blocked_short_addrs != 0) ||
+            (m_num_blocked_extended_addrs != 0) ||
+            (m_beacon_req_interval != 0)) &&
+           !nrf_802154_pib_promiscuous_get();
+}
+
+/**
+ * @brief Check if a given value is present in a list.
+ *
+ * @param[in] p_list     Pointer to the first entry of the list.
+ * @param[in] num_items  Number of entries in the list.
+ * @param[in] p_value    Pointer to the value.
+ * @param[in] size       Size of a single entry.
+ *
+ * @retval true   The value is present in the list.
+ * @retval false  The value is not present in the list.
+ */
+static bool list_contains(const uint8_t * p_list,
+                          uint8_t         num_items,
+                          const uint8_t * p_value,
+                          uint8_t         size)
+{
+    for (uint8_t i = 0; i < num_items; i++)
+    {
+        if (0 == memcmp(&p_list[i * size], p_value, size))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Add a value to a list if it is not present yet.
+ *
+ * @retval true   The value is present in the list.
+ * @retval false  There is no free slot in the list.
+ */
+static bool list_add(uint8_t          * p_list,
+                     volatile uint8_t * p_num_items,
+                     uint8_t            max_items,
+                     const uint8_t    * p_value,
+                     uint8_t            size)
+{
+    if (list_contains(p_list, *p_num_items, p_value, size))
+    {
+        return true;
+    }
+
+    if (*p_num_items >= max_items)
+    {
+        return false;
+    }
+
+    // Fill the entry before it becomes visible to the filter running in the RADIO IRQ handler.
+    memcpy(&p_list[*p_num_items * size], p_value, size);
+    (*p_num_items)++;
+
+    return true;
+}
+
+/**
+ * @brief Check if a Beacon Request command is accepted by the rate limit.
+ *
+ * @retval true   The Beacon Request is accepted.
+ * @retval false  The Beacon Request follows the previous accepted one too closely.
+ */
+static bool beacon_req_rate_limit_check(void)
+{
+    uint32_t now = nrf_802154_timer_sched_time_get();
+
+    if (m_beacon_req_time_valid && ((now - m_beacon_req_time) < m_beacon_req_interval))
+    {
+        return false;
+    }
+
+    m_beacon_req_time       = now;
+    m_beacon_req_time_valid = true;
+
+    return true;
+}
+
+/**
+ * @brief Verify source addressing and the command identifier of incoming frame against the early filter.
+ *
+ * This function is called once destination addressing fields of the frame are verified, or right
+ * after the FCF if the frame has none. If the checked fields are not received yet, this function
+ * requests them by updating @p p_num_bytes.
+ *
+ * @param[in]    p_data       Pointer to a buffer containing PHR and PSDU of the incoming frame.
+ * @param[inout] p_num_bytes  Number of bytes available in @p p_data buffer.
+ * @param[in]    frame_type   Type of incoming frame.
+ *
+ * @retval NRF_802154_RX_ERROR_NONE      The frame is accepted or more bytes are requested.
+ * @retval NRF_802154_RX_ERROR_FILTERED  The frame is dropped by the early filter.
+ */
+static nrf_802154_rx_error_t early_src_filter(const uint8_t * p_data,
+                                              uint8_t       * p_num_bytes,
+                                              uint8_t         frame_type)
+{
+    nrf_802154_frame_parser_mhr_data_t mhr_data;
+    const uint8_t                    * p_src_panid;
+    uint8_t                            payload_end = p_data[PHR_OFFSET] + PHR_SIZE - FCS_SIZE;
+    uint8_t                            required;
+    bool                               cmd_id_check;
+
+    if (!early_src_filter_is_enabled() || !nrf_802154_frame_parser_mhr_parse(p_data, &mhr_data))
+    {
+        return NRF_802154_RX_ERROR_NONE;
+    }
+
+    // The command identifier is readable only in unsecured command frames without Header IEs.
+    cmd_id_check = (frame_type == FRAME_TYPE_COMMAND) &&
+                   (m_beacon_req_interval != 0) &&
+                   !(p_data[SECURITY_ENABLED_OFFSET] & SECURITY_ENABLED_BIT) &&
+                   !(p_data[IE_PRESENT_OFFSET] & IE_PRESENT_BIT) &&
+                   (mhr_data.addressing_end_offset < payload_end);
+
+    required = mhr_data.addressing_end_offset + (cmd_id_check ? 1 : 0);
+
+    if (required > payload_end)
+    {
+        // Malformed frame, leave it to the upper layer.
+        return NRF_802154_RX_ERROR_NONE;
+    }
+
+    if (*p_num_bytes < required)
+    {
+        *p_num_bytes = required;
+        return NRF_802154_RX_ERROR_NONE;
+    }
+
+    p_src_panid = (mhr_data.p_src_panid != NULL) ? mhr_data.p_src_panid : mhr_data.p_dst_panid;
+
+    if ((mhr_data.p_src_addr != NULL) && (p_src_panid != NULL) &&
+        list_contains(&m_blocked_pan_ids[0][0], m_num_blocked_pan_ids, p_src_panid, PAN_ID_SIZE))
+    {
+        m_stats.src_pan_id++;
+        return NRF_802154_RX_ERROR_FILTERED;
+    }
+
+    if (((mhr_data.src_addr_size == SHORT_ADDRESS_SIZE) &&
+         list_contains(&m_blocked_short_addrs[0][0],
+                       m_num_blocked_short_addrs,
+                       mhr_data.p_src_addr,
+                       SHORT_ADDRESS_SIZE)) ||
+        ((mhr_data.src_addr_size == EXTENDED_ADDRESS_SIZE) &&
+         list_contains(&m_blocked_extended_addrs[0][0],
+                       m_num_blocked_extended_addrs,
+                       mhr_data.p_src_addr,
+                       EXTENDED_ADDRESS_SIZE)))
+    {
+        m_stats.src_addr++;
+        return NRF_802154_RX_ERROR_FILTERED;
+    }
+
+    if (cmd_id_check &&
+        (p_data[mhr_data.addressing_end_offset] == MAC_CMD_BEACON_REQ) &&
+        !beacon_req_rate_limit_check())
+    {
+        m_stats.beacon_req++;
+        return NRF_802154_RX_ERROR_FILTERED;
+    }
+
+    return NRF_802154_RX_ERROR_NONE;
+}
+
 nrf_802154_rx_error_t nrf_802154_filter_frame_part(const uint8_t * p_data, uint8_t * p_num_bytes)
 {
     nrf_802154_rx_error_t result        = NRF_802154_RX_ERROR_INVALID_FRAME;
@@ -458,19 +677,104 @@ nrf_802154_rx_error_t nrf_802154_filter_frame_part(const uint8_t * p_data, uint8
                 break;
             }
 
-            if (!dst_addressing_may_be_present(frame_type))
+            if (!(m_frame_type_allowlist & (1 << frame_type)) &&
+                !nrf_802154_pib_promiscuous_get())
             {
-                result = NRF_802154_RX_ERROR_NONE;
+                m_stats.frame_type++;
+                result = NRF_802154_RX_ERROR_FILTERED;
                 break;
             }
 
-            result = dst_addressing_end_offset_get(p_data, p_num_bytes, frame_type, frame_version);
+            if (dst_addressing_may_be_present(frame_type))
+            {
+                result = dst_addressing_end_offset_get(p_data,
+                                                       p_num_bytes,
+                                                       frame_type,
+                                                       frame_version);
+            }
+            else
+            {
+                result = NRF_802154_RX_ERROR_NONE;
+            }
+
+            if ((result == NRF_802154_RX_ERROR_NONE) && (*p_num_bytes == FCF_CHECK_OFFSET))
+            {
+                // There are no destination addressing fields to verify, check the source ones only.
+                result = early_src_filter(p_data, p_num_bytes, frame_type);
+            }
+
             break;
 
         default:
-            result = dst_addr_check(p_data, frame_type);
+            result = dst_addressing_is_present(p_data, frame_type, frame_version) ?
+                     dst_addr_check(p_data, frame_type) : NRF_802154_RX_ERROR_NONE;
+
+            if (result == NRF_802154_RX_ERROR_NONE)
+            {
+                result = early_src_filter(p_data, p_num_bytes, frame_type);
+            }
+
             break;
     }
 
     return result;
 }
+
+void nrf_802154_filter_init(void)
+{
+    m_frame_type_allowlist = FRAME_TYPES_ALL;
+    m_beacon_req_interval  = 0;
+
+    nrf_802154_filter_blocklist_reset();
+    memset(&m_stats, 0, sizeof(m_stats));
+}
+
+void nrf_802154_filter_frame_type_allowlist_set(uint8_t allowlist)
+{
+    m_frame_type_allowlist = allowlist;
+}
+
+bool nrf_802154_filter_src_pan_id_block(const uint8_t * p_pan_id)
+{
+    return list_add(&m_blocked_pan_ids[0][0],
+                    &m_num_blocked_pan_ids,
+                    NRF_802154_FILTER_BLOCKED_PAN_IDS,
+                    p_pan_id,
+                    PAN_ID_SIZE);
+}
+
+bool nrf_802154_filter_src_addr_block(const uint8_t * p_addr, bool extended)
+{
+    if (extended)
+    {
+        return list_add(&m_blocked_extended_addrs[0][0],
+                        &m_num_blocked_extended_addrs,
+                        NRF_802154_FILTER_BLOCKED_EXTENDED_ADDRESSES,
+                        p_addr,
+                        EXTENDED_ADDRESS_SIZE);
+    }
+
+    return list_add(&m_blocked_short_addrs[0][0],
+                    &m_num_blocked_short_addrs,
+                    NRF_802154_FILTER_BLOCKED_SHORT_ADDRESSES,
+                    p_addr,
+                    SHORT_ADDRESS_SIZE);
+}
+
+void nrf_802154_filter_blocklist_reset(void)
+{
+    m_num_blocked_pan_ids        = 0;
+    m_num_blocked_short_addrs    = 0;
+    m_num_blocked_extended_addrs = 0;
+}
+
+void nrf_802154_filter_beacon_req_interval_set(uint32_t interval)
+{
+    m_beacon_req_time_valid = false;
+    m_beacon_req_interval   = interval;
+}
+
+void nrf_802154_filter_stats_get(nrf_802154_filter_stats_t * p_stats)
+{
+    *p_stats = m_stats;
+}
@@ -74,4 +74,60 @@
  */
 nrf_802154_rx_error_t nrf_802154_filter_frame_part(const uint8_t * p_data, uint8_t * p_num_bytes);
 
+/**
+ * @brief Initializes the early frame filter.
+ *
+ * All frame types are allowed, the blocklists are empty and the Beacon Request rate limit
+ * is disabled.
+ */
+void nrf_802154_filter_init(void);
+
+/**
+ * @brief Sets the frame types accepted by the early frame filter.
+ *
+ * @param[in]  allowlist  Bitmask of allowed frame types. Bit n allows frames whose Frame Type
+ *                        field equals n.
+ */
+void nrf_802154_filter_frame_type_allowlist_set(uint8_t allowlist);
+
+/**
+ * @brief Adds a source PAN ID to the blocklist of the early frame filter.
+ *
+ * @param[in]  p_pan_id  Pointer to the PAN ID (little-endian).
+ *
+ * @retval true   The PAN ID is in the blocklist.
+ * @retval false  Not enough memory to store the PAN ID in the blocklist.
+ */
+bool nrf_802154_filter_src_pan_id_block(const uint8_t * p_pan_id);
+
+/**
+ * @brief Adds a source address to the blocklist of the early frame filter.
+ *
+ * @param[in]  p_addr    Pointer to the address (little-endian).
+ * @param[in]  extended  If the given address is an extended MAC address or a short MAC address.
+ *
+ * @retval true   The address is in the blocklist.
+ * @retval false  Not enough memory to store the address in the blocklist.
+ */
+bool nrf_802154_filter_src_addr_block(const uint8_t * p_addr, bool extended);
+
+/**
+ * @brief Removes all PAN IDs and addresses from the blocklists of the early frame filter.
+ */
+void nrf_802154_filter_blocklist_reset(void);
+
+/**
+ * @brief Sets the minimum interval between accepted Beacon Request commands.
+ *
+ * @param[in]  interval  Interval in microseconds. Value 0 disables the rate limit.
+ */
+void nrf_802154_filter_beacon_req_interval_set(uint32_t interval);
+
+/**
+ * @brief Gets the statistics of the early frame filter.
+ *
+ * @param[out]  p_stats  Pointer to the structure for the statistics.
+ */
+void nrf_802154_filter_stats_get(nrf_802154_filter_stats_t * p_stats);
+
 #endif /* NRF_802154_FILTER_H_ */
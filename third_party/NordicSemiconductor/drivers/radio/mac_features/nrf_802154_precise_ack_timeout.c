@@ -41,6 +41,8 @@
 #include <stdint.h>
 
 #include "../nrf_802154_debug.h"
+#include "nrf_802154_ant_diversity.h"
+#include "nrf_802154_config.h"
 #include "nrf_802154_notification.h"
 #include "nrf_802154_procedures_duration.h"
 #include "nrf_802154_request.h"
@@ -60,6 +62,9 @@ static void notify_tx_error(bool result)
 {
     if (result)
     {
+#if NRF_802154_ANT_DIVERSITY_ENABLED
+        nrf_802154_ant_diversity_tx_failed_hook(mp_frame, NRF_802154_TX_ERROR_NO_ACK);
+#endif // NRF_802154_ANT_DIVERSITY_ENABLED
         nrf_802154_notify_transmit_failed(mp_frame, NRF_802154_TX_ERROR_NO_ACK);
     }
 }
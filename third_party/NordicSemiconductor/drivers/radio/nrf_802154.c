@@ -64,8 +64,10 @@
 #include "timer_scheduler/nrf_802154_timer_sched.h"
 
 #include "mac_features/nrf_802154_ack_timeout.h"
+#include "mac_features/nrf_802154_ant_diversity.h"
 #include "mac_features/nrf_802154_csma_ca.h"
 #include "mac_features/nrf_802154_delayed_trx.h"
+#include "mac_features/nrf_802154_filter.h"
 #include "mac_features/ack_generator/nrf_802154_ack_data.h"
 
 #if ENABLE_FEM
@@ -161,6 +163,11 @@ int8_t nrf_802154_tx_power_get(void)
     return nrf_802154_pib_tx_power_get();
 }
 
+void nrf_802154_tx_power_frame_set(int8_t power)
+{
+    nrf_802154_pib_tx_power_frame_set(power);
+}
+
 void nrf_802154_temperature_changed(void)
 {
     nrf_802154_request_cca_cfg_update();
@@ -205,8 +212,10 @@ void nrf_802154_init(void)
     nrf_802154_ack_data_init();
     nrf_802154_core_init();
     nrf_802154_clock_init();
+    nrf_802154_ant_diversity_init();
     nrf_802154_critical_section_init();
     nrf_802154_debug_init();
+    nrf_802154_filter_init();
     nrf_802154_notification_init();
     nrf_802154_lp_timer_init();
     nrf_802154_pib_init();
@@ -624,6 +633,13 @@ bool nrf_802154_ack_data_clear(const uint8_t * p_addr, bool extended, uint8_t da
     return nrf_802154_ack_data_for_addr_clear(p_addr, extended, data_type);
 }
 
+bool nrf_802154_ack_data_update(const nrf_802154_ack_data_op_t * p_ops,
+                                uint32_t                         ops_count,
+                                uint8_t                          data_type)
+{
+    return nrf_802154_ack_data_for_addrs_update(p_ops, ops_count, data_type);
+}
+
 void nrf_802154_auto_pending_bit_set(bool enabled)
 {
     nrf_802154_ack_data_enable(enabled);
@@ -648,6 +664,117 @@ void nrf_802154_pending_bit_for_addr_reset(bool extended)
     nrf_802154_ack_data_reset(extended, NRF_802154_ACK_DATA_PENDING_BIT);
 }
 
+void nrf_802154_rx_filter_frame_types_set(uint8_t allowlist)
+{
+    nrf_802154_filter_frame_type_allowlist_set(allowlist);
+}
+
+bool nrf_802154_rx_filter_src_pan_id_block(const uint8_t * p_pan_id)
+{
+    return nrf_802154_filter_src_pan_id_block(p_pan_id);
+}
+
+bool nrf_802154_rx_filter_src_addr_block(const uint8_t * p_addr, bool extended)
+{
+    return nrf_802154_filter_src_addr_block(p_addr, extended);
+}
+
+void nrf_802154_rx_filter_blocklist_reset(void)
+{
+    nrf_802154_filter_blocklist_reset();
+}
+
+void nrf_802154_rx_filter_beacon_req_interval_set(uint32_t interval)
+{
+    nrf_802154_filter_beacon_req_interval_set(interval);
+}
+
+void nrf_802154_rx_filter_stats_get(nrf_802154_filter_stats_t * p_stats)
+{
+    nrf_802154_filter_stats_get(p_stats);
+}
+
+bool nrf_802154_antenna_diversity_mode_set(nrf_802154_ant_diversity_mode_t mode)
+{
+    return nrf_802154_ant_diversity_mode_set(mode);
+}
+
+nrf_802154_ant_diversity_mode_t nrf_802154_antenna_diversity_mode_get(void)
+{
+    return nrf_802154_ant_diversity_mode_get();
+}
+
+void nrf_802154_antenna_set(nrf_802154_ant_diversity_antenna_t antenna)
+{
+    nrf_802154_ant_diversity_antenna_set(antenna);
+}
+
+nrf_802154_ant_diversity_antenna_t nrf_802154_antenna_get(void)
+{
+    return nrf_802154_ant_diversity_antenna_get();
+}
+
+void nrf_802154_antenna_diversity_toggle_time_set(uint16_t time)
+{
+    nrf_802154_ant_diversity_toggle_time_set(time);
+}
+
+void nrf_802154_antenna_diversity_stats_get(nrf_802154_ant_diversity_stats_t * p_stats)
+{
+    nrf_802154_ant_diversity_stats_get(p_stats);
+}
+
+void nrf_802154_antenna_diversity_stats_reset(void)
+{
+    nrf_802154_ant_diversity_stats_reset();
+}
+
+#if NRF_802154_PREEMPTION_POLICY_ENABLED
+void nrf_802154_preemption_priority_set(nrf_802154_op_class_t op_class, uint8_t priority)
+{
+    nrf_802154_core_preemption_priority_set(op_class, priority);
+}
+
+uint8_t nrf_802154_preemption_priority_get(nrf_802154_op_class_t op_class)
+{
+    return nrf_802154_core_preemption_priority_get(op_class);
+}
+
+void nrf_802154_preemption_stats_get(nrf_802154_preemption_stats_t * p_stats)
+{
+    nrf_802154_core_preemption_stats_get(p_stats);
+}
+
+void nrf_802154_preemption_stats_reset(void)
+{
+    nrf_802154_core_preemption_stats_reset();
+}
+
+#endif // NRF_802154_PREEMPTION_POLICY_ENABLED
+
+#if NRF_802154_HFCLK_WARM_ENABLED
+void nrf_802154_hfclk_warm_request(uint32_t t0, uint32_t keep_dt, uint32_t prestart_dt, uint32_t hold)
+{
+    nrf_802154_rsch_hfclk_warm_request(t0, keep_dt, prestart_dt, hold);
+}
+
+void nrf_802154_hfclk_warm_cancel(void)
+{
+    nrf_802154_rsch_hfclk_warm_cancel();
+}
+
+void nrf_802154_hfclk_warm_stats_get(nrf_802154_hfclk_warm_stats_t * p_stats)
+{
+    nrf_802154_rsch_hfclk_warm_stats_get(p_stats);
+}
+
+void nrf_802154_hfclk_warm_stats_reset(void)
+{
+    nrf_802154_rsch_hfclk_warm_stats_reset();
+}
+
+#endif // NRF_802154_HFCLK_WARM_ENABLED
+
 void nrf_802154_cca_cfg_set(const nrf_802154_cca_cfg_t * p_cca_cfg)
 {
     nrf_802154_pib_cca_cfg_set(p_cca_cfg);
@@ -704,6 +831,28 @@ __WEAK void nrf_802154_tx_ack_started(uint8_t * p_data, int8_t power, uint8_t lq
     (void)lqi;
 }
 
+#if NRF_802154_ACK_DATA_PENDING_BIT_HOOK_ENABLED
+__WEAK bool nrf_802154_ack_pending_bit_decide(const uint8_t * p_frame, bool table_pending)
+{
+    (void)p_frame;
+
+    return table_pending;
+}
+
+#endif // NRF_802154_ACK_DATA_PENDING_BIT_HOOK_ENABLED
+
+#if NRF_802154_PREEMPTION_POLICY_ENABLED
+__WEAK void nrf_802154_preemption_notify(nrf_802154_op_class_t requested,
+                                         nrf_802154_op_class_t ongoing,
+                                         bool                  granted)
+{
+    (void)requested;
+    (void)ongoing;
+    (void)granted;
+}
+
+#endif // NRF_802154_PREEMPTION_POLICY_ENABLED
+
 #if NRF_802154_USE_RAW_API
 __WEAK void nrf_802154_received_raw(uint8_t * p_data, int8_t power, uint8_t lqi)
 {
@@ -842,3 +991,12 @@ __WEAK void nrf_802154_cca_failed(nrf_802154_cca_error_t error)
 {
     (void)error;
 }
+
+#if NRF_802154_CSMA_CA_ENABLED
+__WEAK void nrf_802154_csma_ca_cca_done(const uint8_t * p_frame, bool channel_free)
+{
+    (void)p_frame;
+    (void)channel_free;
+}
+
+#endif // NRF_802154_CSMA_CA_ENABLED
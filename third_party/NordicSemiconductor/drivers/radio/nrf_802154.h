@@ -119,6 +119,17 @@ void nrf_802154_tx_power_set(int8_t power);
  */
 int8_t nrf_802154_tx_power_get(void);
 
+/**
+ * @brief Limits the transmit power of the transmitted frames.
+ *
+ * Frames requested with the transmit functions are sent with the lower of this limit and the power
+ * set with @ref nrf_802154_tx_power_set. The limit is applied when the transmission starts, so
+ * ACK frames sent in the meantime, for example during CSMA-CA backoffs, keep the full power.
+ *
+ * @param[in]  power  Transmit power limit in dBm. INT8_MAX removes the limit.
+ */
+void nrf_802154_tx_power_frame_set(int8_t power);
+
 /**
  * @defgroup nrf_802154_frontend Frontend Module management
  * @{
@@ -541,6 +552,46 @@ bool nrf_802154_continuous_carrier(void);
  */
 extern void nrf_802154_tx_ack_started(uint8_t * p_data, int8_t power, uint8_t lqi);
 
+#if NRF_802154_ACK_DATA_PENDING_BIT_HOOK_ENABLED
+
+/**
+ * @brief Decides the pending bit of the ACK frame sent in response to a given frame.
+ *
+ * This function is called from the interrupt context while the ACK frame is being prepared, after
+ * the source address matching algorithm decided the pending bit from the ACK data lists.
+ *
+ * @note This function must be very short to prevent dropping frames by the driver.
+ *
+ * @param[in]  p_frame        Pointer to a buffer with PHR and PSDU of the acknowledged frame.
+ * @param[in]  table_pending  Pending bit decided by the source address matching algorithm.
+ *
+ * @retval true   Pending bit is to be set.
+ * @retval false  Pending bit is to be cleared.
+ */
+extern bool nrf_802154_ack_pending_bit_decide(const uint8_t * p_frame, bool table_pending);
+
+#endif // NRF_802154_ACK_DATA_PENDING_BIT_HOOK_ENABLED
+
+#if NRF_802154_PREEMPTION_POLICY_ENABLED
+
+/**
+ * @brief Notifies about a conflict resolved by the preemption policy.
+ *
+ * The ongoing operation terminated by a granted request is also notified as aborted by the
+ * respective failure notification, and a denied request fails as if the radio was busy.
+ *
+ * @note This function must be very short to prevent dropping frames by the driver.
+ *
+ * @param[in]  requested  Class of the requested operation.
+ * @param[in]  ongoing    Class of the ongoing operation.
+ * @param[in]  granted    If the ongoing operation was terminated in favor of the request.
+ */
+extern void nrf_802154_preemption_notify(nrf_802154_op_class_t requested,
+                                         nrf_802154_op_class_t ongoing,
+                                         bool                  granted);
+
+#endif // NRF_802154_PREEMPTION_POLICY_ENABLED
+
 #if NRF_802154_USE_RAW_API
 
 /**
@@ -830,6 +881,23 @@ extern void nrf_802154_cca_done(bool channel_free);
  */
 extern void nrf_802154_cca_failed(nrf_802154_cca_error_t error);
 
+#if NRF_802154_CSMA_CA_ENABLED
+
+/**
+ * @brief Notifies about the result of a CCA performed by the CSMA-CA procedure.
+ *
+ * This function is called for each CCA attempt of the procedure, including the ones followed by
+ * a backoff.
+ *
+ * @note This function must be very short to prevent dropping frames by the driver.
+ *
+ * @param[in]  p_frame       Pointer to a buffer with PHR and PSDU of the frame being transmitted.
+ * @param[in]  channel_free  Indication if the channel is free.
+ */
+extern void nrf_802154_csma_ca_cca_done(const uint8_t * p_frame, bool channel_free);
+
+#endif // NRF_802154_CSMA_CA_ENABLED
+
 /**
  * @}
  * @defgroup nrf_802154_memman Driver memory management
@@ -1067,6 +1135,26 @@ bool nrf_802154_ack_data_set(const uint8_t * p_addr,
  */
 bool nrf_802154_ack_data_clear(const uint8_t * p_addr, bool extended, uint8_t data_type);
 
+/**
+ * @brief Sets or removes the ACK data for several peer nodes at once.
+ *
+ * Each operation works like @ref nrf_802154_ack_data_set or @ref nrf_802154_ack_data_clear, but
+ * all operations are merged with the list in a single pass, and the updated list replaces the
+ * previous one atomically. Use this function instead of a series of the single-address functions
+ * when many entries change at once, for example for both addresses of a node or for all children
+ * of a parent.
+ *
+ * @param[in]  p_ops      Pointer to the array of operations to be applied.
+ * @param[in]  ops_count  Number of operations in @p p_ops.
+ * @param[in]  data_type  Type of data to be set or removed. Refer to the @ref nrf_802154_ack_data_t type.
+ *
+ * @retval True   All operations have been applied.
+ * @retval False  Some addresses were not added (not enough memory) or removed (not found in the list).
+ */
+bool nrf_802154_ack_data_update(const nrf_802154_ack_data_op_t * p_ops,
+                                uint32_t                         ops_count,
+                                uint8_t                          data_type);
+
 /**
  * @brief Enables or disables setting a pending bit in automatically transmitted ACK frames.
  *
@@ -1147,6 +1235,229 @@ bool nrf_802154_pending_bit_for_addr_clear(const uint8_t * p_addr, bool extended
  */
 void nrf_802154_pending_bit_for_addr_reset(bool extended);
 
+/**
+ * @}
+ * @defgroup nrf_802154_rx_filter Early frame filter
+ * @{
+ */
+
+/**
+ * @brief Sets the frame types accepted by the receiver.
+ *
+ * The frame type is verified when the Frame Control field is received. Frames of other types are
+ * aborted before they are received entirely, so they do not occupy a receive buffer and are not
+ * notified to the higher layer. The early frame filter is not applied in promiscuous mode.
+ *
+ * @param[in]  allowlist  Bitmask of allowed frame types. Bit n allows frames whose Frame Type field
+ *                        equals n. All frame types are allowed by default.
+ */
+void nrf_802154_rx_filter_frame_types_set(uint8_t allowlist);
+
+/**
+ * @brief Adds a source PAN ID to the blocklist of the receiver.
+ *
+ * Frames with a source address sent from the given PAN are aborted during the reception.
+ * If the Source PAN ID field is elided, the Destination PAN ID field is checked.
+ *
+ * @note This function makes a copy of the given PAN ID.
+ *
+ * @param[in]  p_pan_id  Pointer to the PAN ID (little-endian).
+ *
+ * @retval True   The PAN ID is in the blocklist.
+ * @retval False  Not enough memory to store the PAN ID in the blocklist.
+ */
+bool nrf_802154_rx_filter_src_pan_id_block(const uint8_t * p_pan_id);
+
+/**
+ * @brief Adds a source address to the blocklist of the receiver.
+ *
+ * Frames sent from the given address are aborted during the reception.
+ *
+ * @note This function makes a copy of the given address.
+ *
+ * @param[in]  p_addr    Array of bytes containing the address of the node (little-endian).
+ * @param[in]  extended  If the given address is an extended MAC address or a short MAC address.
+ *
+ * @retval True   The address is in the blocklist.
+ * @retval False  Not enough memory to store the address in the blocklist.
+ */
+bool nrf_802154_rx_filter_src_addr_block(const uint8_t * p_addr, bool extended);
+
+/**
+ * @brief Removes all PAN IDs and addresses from the blocklists of the receiver.
+ */
+void nrf_802154_rx_filter_blocklist_reset(void);
+
+/**
+ * @brief Sets the minimum interval between Beacon Request commands accepted by the receiver.
+ *
+ * Unsecured Beacon Request commands received sooner than @p interval after the previous accepted
+ * one are aborted during the reception.
+ *
+ * @param[in]  interval  Interval in microseconds. Value 0 disables the rate limit (default).
+ */
+void nrf_802154_rx_filter_beacon_req_interval_set(uint32_t interval);
+
+/**
+ * @brief Gets the number of frames dropped by the early frame filter.
+ *
+ * @param[out]  p_stats  Pointer to the structure for the statistics.
+ */
+void nrf_802154_rx_filter_stats_get(nrf_802154_filter_stats_t * p_stats);
+
+/**
+ * @}
+ * @defgroup nrf_802154_antenna_diversity Antenna diversity
+ * @{
+ */
+
+/**
+ * @brief Sets the mode of the antenna diversity.
+ *
+ * In the automatic mode, the receiver switches antennas while it searches for a preamble, starting
+ * from the antenna that received frames with the highest average RSSI. Each frame is transmitted
+ * with the antenna last acknowledged by its recipient, and with the other antenna after the
+ * recipient did not acknowledge a frame. Broadcast frames and frames to unknown recipients use
+ * the antenna preferred for the reception.
+ *
+ * @note The antenna diversity requires @ref NRF_802154_ANT_DIVERSITY_ENABLED. The mode is applied
+ *       to the receiver the next time it is enabled.
+ *
+ * @param[in]  mode  Antenna diversity mode. The antenna diversity is disabled by default.
+ *
+ * @retval true   The mode is set.
+ * @retval false  The antenna diversity is not enabled in the driver configuration.
+ */
+bool nrf_802154_antenna_diversity_mode_set(nrf_802154_ant_diversity_mode_t mode);
+
+/**
+ * @brief Gets the mode of the antenna diversity.
+ *
+ * @returns  Antenna diversity mode.
+ */
+nrf_802154_ant_diversity_mode_t nrf_802154_antenna_diversity_mode_get(void);
+
+/**
+ * @brief Selects the antenna used in the manual mode of the antenna diversity.
+ *
+ * @param[in]  antenna  Antenna to be used for both transmission and reception.
+ */
+void nrf_802154_antenna_set(nrf_802154_ant_diversity_antenna_t antenna);
+
+/**
+ * @brief Gets the antenna currently connected to the radio.
+ *
+ * @returns  Antenna selected by the antenna diversity.
+ */
+nrf_802154_ant_diversity_antenna_t nrf_802154_antenna_get(void);
+
+/**
+ * @brief Sets the time the receiver listens on one antenna while searching for a preamble.
+ *
+ * @param[in]  time  Time in microseconds. The default value is defined by
+ *                   @ref NRF_802154_ANT_DIVERSITY_TOGGLE_TIME_US.
+ */
+void nrf_802154_antenna_diversity_toggle_time_set(uint16_t time);
+
+/**
+ * @brief Gets the per-antenna statistics of the antenna diversity.
+ *
+ * @param[out]  p_stats  Pointer to the structure for the statistics.
+ */
+void nrf_802154_antenna_diversity_stats_get(nrf_802154_ant_diversity_stats_t * p_stats);
+
+/**
+ * @brief Clears the statistics of the antenna diversity and the antennas learned for recipients.
+ */
+void nrf_802154_antenna_diversity_stats_reset(void);
+
+#if NRF_802154_PREEMPTION_POLICY_ENABLED
+
+/**
+ * @}
+ * @defgroup nrf_802154_preemption Preemption policy
+ * @{
+ */
+
+/**
+ * @brief Sets the priority of an operation class.
+ *
+ * A request of a higher priority than the ongoing operation terminates it, a request of a lower
+ * priority is denied. Requests of the same priority as the ongoing operation follow their
+ * termination levels. Default priorities are defined by NRF_802154_PREEMPTION_PRIORITY_*.
+ *
+ * @param[in]  op_class  Operation class.
+ * @param[in]  priority  Priority of the operation class.
+ */
+void nrf_802154_preemption_priority_set(nrf_802154_op_class_t op_class, uint8_t priority);
+
+/**
+ * @brief Gets the priority of an operation class.
+ *
+ * @param[in]  op_class  Operation class.
+ *
+ * @returns  Priority of the operation class.
+ */
+uint8_t nrf_802154_preemption_priority_get(nrf_802154_op_class_t op_class);
+
+/**
+ * @brief Gets the statistics of the preemption policy.
+ *
+ * @param[out]  p_stats  Pointer to the structure for the statistics.
+ */
+void nrf_802154_preemption_stats_get(nrf_802154_preemption_stats_t * p_stats);
+
+/**
+ * @brief Clears the statistics of the preemption policy.
+ */
+void nrf_802154_preemption_stats_reset(void);
+
+#endif // NRF_802154_PREEMPTION_POLICY_ENABLED
+
+#if NRF_802154_HFCLK_WARM_ENABLED
+
+/**
+ * @}
+ * @defgroup nrf_802154_hfclk_warm HF clock warm policy
+ * @{
+ */
+
+/**
+ * @brief Keeps the HF clock warm while the radio is idle and pre-starts it ahead of a deadline.
+ *
+ * A radio operation requested while the HF clock is kept warm starts without waiting for the
+ * crystal ramp-up, at the cost of the current drawn by the running HF clock.
+ *
+ * The HF clock is kept running from now until @p t0 + @p keep_dt. If @p prestart_dt is not zero,
+ * the HF clock is started again so that it is ready at @p t0 + @p prestart_dt, and kept running
+ * until @p hold microseconds later. The request replaces the previous one.
+ *
+ * @param[in]  t0           Base time of the request, in microseconds.
+ * @param[in]  keep_dt      End of the keep period relative to @p t0, in microseconds.
+ * @param[in]  prestart_dt  Deadline relative to @p t0, in microseconds, or zero if none.
+ * @param[in]  hold         Time to keep the HF clock running after the deadline, in microseconds.
+ */
+void nrf_802154_hfclk_warm_request(uint32_t t0, uint32_t keep_dt, uint32_t prestart_dt, uint32_t hold);
+
+/**
+ * @brief Releases the HF clock kept warm and cancels any pending pre-start.
+ */
+void nrf_802154_hfclk_warm_cancel(void);
+
+/**
+ * @brief Gets the statistics of the HF clock warm policy.
+ *
+ * @param[out]  p_stats  Pointer to the structure for the statistics.
+ */
+void nrf_802154_hfclk_warm_stats_get(nrf_802154_hfclk_warm_stats_t * p_stats);
+
+/**
+ * @brief Clears the statistics of the HF clock warm policy.
+ */
+void nrf_802154_hfclk_warm_stats_reset(void);
+
+#endif // NRF_802154_HFCLK_WARM_ENABLED
+
 /**
  * @}
  * @defgroup nrf_802154_cca CCA configuration management
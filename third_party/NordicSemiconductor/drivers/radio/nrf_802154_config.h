@@ -157,6 +157,9 @@ extern "C" {
  *
  * The number of slots containing short addresses of nodes for which the pending data is stored.
  *
+ * @note Each slot takes 2 bytes for the pending bit and 3 + @ref NRF_802154_MAX_ACK_IE_SIZE bytes
+ *       for the IE data, twice with @ref NRF_802154_ACK_DATA_DOUBLE_BUFFER_ENABLED.
+ *
  */
 #ifndef NRF_802154_PENDING_SHORT_ADDRESSES
 #define NRF_802154_PENDING_SHORT_ADDRESSES 10
@@ -167,11 +170,46 @@ extern "C" {
  *
  * The number of slots containing extended addresses of nodes for which the pending data is stored.
  *
+ * @note Each slot takes 8 bytes for the pending bit and 9 + @ref NRF_802154_MAX_ACK_IE_SIZE bytes
+ *       for the IE data, twice with @ref NRF_802154_ACK_DATA_DOUBLE_BUFFER_ENABLED.
+ *
  */
 #ifndef NRF_802154_PENDING_EXTENDED_ADDRESSES
 #define NRF_802154_PENDING_EXTENDED_ADDRESSES 10
 #endif
 
+/**
+ * @def NRF_802154_FILTER_BLOCKED_PAN_IDS
+ *
+ * The number of slots containing source PAN IDs of frames dropped by the early frame filter.
+ *
+ */
+#ifndef NRF_802154_FILTER_BLOCKED_PAN_IDS
+#define NRF_802154_FILTER_BLOCKED_PAN_IDS 2
+#endif
+
+/**
+ * @def NRF_802154_FILTER_BLOCKED_SHORT_ADDRESSES
+ *
+ * The number of slots containing short source addresses of frames dropped by the early frame
+ * filter.
+ *
+ */
+#ifndef NRF_802154_FILTER_BLOCKED_SHORT_ADDRESSES
+#define NRF_802154_FILTER_BLOCKED_SHORT_ADDRESSES 4
+#endif
+
+/**
+ * @def NRF_802154_FILTER_BLOCKED_EXTENDED_ADDRESSES
+ *
+ * The number of slots containing extended source addresses of frames dropped by the early frame
+ * filter.
+ *
+ */
+#ifndef NRF_802154_FILTER_BLOCKED_EXTENDED_ADDRESSES
+#define NRF_802154_FILTER_BLOCKED_EXTENDED_ADDRESSES 4
+#endif
+
 /**
  * @def NRF_802154_RX_BUFFERS
  *
@@ -392,6 +430,41 @@ extern "C" {
 #define NRF_802154_MAX_ACK_IE_SIZE 8
 #endif
 
+/**
+ * @def NRF_802154_ACK_DATA_BATCH_SIZE
+ *
+ * The maximum number of ACK data operations applied in a single pass over the ACK data lists by
+ * @ref nrf_802154_ack_data_update. Longer batches are applied in several passes.
+ *
+ */
+#ifndef NRF_802154_ACK_DATA_BATCH_SIZE
+#define NRF_802154_ACK_DATA_BATCH_SIZE 16
+#endif
+
+/**
+ * @def NRF_802154_ACK_DATA_DOUBLE_BUFFER_ENABLED
+ *
+ * Indicates whether the ACK data lists are double-buffered. Updates are then merged into a second
+ * copy of each modified list, and only switching the copies disables interrupts. Otherwise, the
+ * lists take half the RAM and each address is inserted or removed in place with interrupts
+ * disabled, for a time that grows with the number of slots.
+ *
+ */
+#ifndef NRF_802154_ACK_DATA_DOUBLE_BUFFER_ENABLED
+#define NRF_802154_ACK_DATA_DOUBLE_BUFFER_ENABLED 1
+#endif
+
+/**
+ * @def NRF_802154_ACK_DATA_PENDING_BIT_HOOK_ENABLED
+ *
+ * Indicates whether @ref nrf_802154_ack_pending_bit_decide is called to decide the pending bit of
+ * each ACK frame after source address matching.
+ *
+ */
+#ifndef NRF_802154_ACK_DATA_PENDING_BIT_HOOK_ENABLED
+#define NRF_802154_ACK_DATA_PENDING_BIT_HOOK_ENABLED 0
+#endif
+
 /**
  * @}
  * @defgroup nrf_802154_config_transmission Transmission start notification feature configuration
@@ -414,6 +487,157 @@ extern "C" {
 #endif
 #endif // NRF_802154_TX_STARTED_NOTIFY_ENABLED
 
+/**
+ * @}
+ * @defgroup nrf_802154_config_ant_diversity Antenna diversity feature configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_ANT_DIVERSITY_ENABLED
+ *
+ * Indicates whether the antenna diversity feature is to be enabled in the driver.
+ *
+ * @note This feature requires an RF switch selecting one of two antennas controlled by a single
+ *       GPIO pin (see @ref NRF_802154_ANT_DIVERSITY_PIN), and a timer instance that is not
+ *       available on nRF52811.
+ */
+#ifndef NRF_802154_ANT_DIVERSITY_ENABLED
+#define NRF_802154_ANT_DIVERSITY_ENABLED 0
+#endif
+
+#if NRF_802154_ANT_DIVERSITY_ENABLED
+
+#ifdef NRF52811_XXAA
+#error "The antenna diversity feature is not supported on nRF52811."
+#endif
+
+/**
+ * @def NRF_802154_ANT_DIVERSITY_PIN
+ *
+ * The GPIO pin controlling the RF switch. Antenna 0 is selected when the pin is low.
+ *
+ */
+#ifndef NRF_802154_ANT_DIVERSITY_PIN
+#error "NRF_802154_ANT_DIVERSITY_PIN must be defined when the antenna diversity is enabled."
+#endif
+
+#endif // NRF_802154_ANT_DIVERSITY_ENABLED
+
+/**
+ * @def NRF_802154_ANT_DIVERSITY_TOGGLE_TIME_US
+ *
+ * The default time in microseconds (us) the receiver listens on one antenna while searching for
+ * a preamble, before it switches to the other one.
+ *
+ */
+#ifndef NRF_802154_ANT_DIVERSITY_TOGGLE_TIME_US
+#define NRF_802154_ANT_DIVERSITY_TOGGLE_TIME_US 40
+#endif
+
+/**
+ * @def NRF_802154_ANT_DIVERSITY_DESTINATIONS
+ *
+ * The number of destination addresses for which the antenna used by the last successful
+ * transmission is remembered.
+ *
+ */
+#ifndef NRF_802154_ANT_DIVERSITY_DESTINATIONS
+#define NRF_802154_ANT_DIVERSITY_DESTINATIONS 8
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_preemption Preemption policy configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_PREEMPTION_POLICY_ENABLED
+ *
+ * Indicates whether conflicting requests are resolved by the priorities of their operation
+ * classes (see @ref nrf_802154_op_class_t) instead of their termination levels alone.
+ *
+ * A request of a higher priority than the ongoing operation terminates it, and a request of a
+ * lower priority is denied. Requests of the same priority follow their termination levels.
+ * A frame being received and the ACK transmitted for it are never terminated by a higher priority.
+ *
+ */
+#ifndef NRF_802154_PREEMPTION_POLICY_ENABLED
+#define NRF_802154_PREEMPTION_POLICY_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_PREEMPTION_PRIORITY_IDLE_RX
+ *
+ * The default priority of @ref NRF_802154_OP_CLASS_IDLE_RX.
+ *
+ */
+#ifndef NRF_802154_PREEMPTION_PRIORITY_IDLE_RX
+#define NRF_802154_PREEMPTION_PRIORITY_IDLE_RX 0
+#endif
+
+/**
+ * @def NRF_802154_PREEMPTION_PRIORITY_TX
+ *
+ * The default priority of @ref NRF_802154_OP_CLASS_TX.
+ *
+ */
+#ifndef NRF_802154_PREEMPTION_PRIORITY_TX
+#define NRF_802154_PREEMPTION_PRIORITY_TX 1
+#endif
+
+/**
+ * @def NRF_802154_PREEMPTION_PRIORITY_ED_CCA
+ *
+ * The default priority of @ref NRF_802154_OP_CLASS_ED_CCA.
+ *
+ */
+#ifndef NRF_802154_PREEMPTION_PRIORITY_ED_CCA
+#define NRF_802154_PREEMPTION_PRIORITY_ED_CCA 1
+#endif
+
+/**
+ * @def NRF_802154_PREEMPTION_PRIORITY_SCHEDULED_TX
+ *
+ * The default priority of @ref NRF_802154_OP_CLASS_SCHEDULED_TX.
+ *
+ */
+#ifndef NRF_802154_PREEMPTION_PRIORITY_SCHEDULED_TX
+#define NRF_802154_PREEMPTION_PRIORITY_SCHEDULED_TX 2
+#endif
+
+/**
+ * @def NRF_802154_PREEMPTION_PRIORITY_SCHEDULED_RX
+ *
+ * The default priority of @ref NRF_802154_OP_CLASS_SCHEDULED_RX.
+ *
+ */
+#ifndef NRF_802154_PREEMPTION_PRIORITY_SCHEDULED_RX
+#define NRF_802154_PREEMPTION_PRIORITY_SCHEDULED_RX 3
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_hfclk_warm HF clock warm policy configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_HFCLK_WARM_ENABLED
+ *
+ * Indicates whether the higher layer can keep the HF clock running while the driver is idle,
+ * and pre-start it ahead of deadlines known to the higher layer
+ * (see @ref nrf_802154_hfclk_warm_request).
+ *
+ * A radio operation requested while the HF clock is kept warm does not wait for the crystal
+ * to start up.
+ *
+ */
+#ifndef NRF_802154_HFCLK_WARM_ENABLED
+#define NRF_802154_HFCLK_WARM_ENABLED 0
+#endif
+
 /**
  *@}
  **/
@@ -62,6 +62,7 @@
 #include "nrf_radio.h"
 #include "nrf_timer.h"
 #include "fem/nrf_fem_protocol_api.h"
+#include "mac_features/nrf_802154_ant_diversity.h"
 #include "mac_features/nrf_802154_delayed_trx.h"
 #include "mac_features/nrf_802154_filter.h"
 #include "mac_features/nrf_802154_frame_parser.h"
@@ -233,6 +234,12 @@ static nrf_802154_flags_t m_flags;               ///< Flags used to store the cu
 
 static volatile bool m_rsch_timeslot_is_granted; ///< State of the RSCH timeslot.
 
+#if NRF_802154_PREEMPTION_POLICY_ENABLED
+static nrf_802154_op_class_t         m_tx_class;                            ///< Class of the ongoing transmission.
+static uint8_t                       m_priorities[NRF_802154_OP_CLASS_NUM]; ///< Priorities of the operation classes.
+static nrf_802154_preemption_stats_t m_preemption_stats;                    ///< Statistics of the preemption policy.
+#endif // NRF_802154_PREEMPTION_POLICY_ENABLED
+
 /***************************************************************************************************
  * @section Common core operations
  **************************************************************************************************/
@@ -1035,6 +1042,10 @@ static void rx_terminate(void)
 {
     uint32_t ints_to_disable = 0;
 
+#if NRF_802154_ANT_DIVERSITY_ENABLED
+    nrf_802154_ant_diversity_rx_search_stop();
+#endif // NRF_802154_ANT_DIVERSITY_ENABLED
+
     nrf_ppi_channel_disable(PPI_DISABLED_EGU);
     nrf_ppi_channel_disable(PPI_EGU_RAMP_UP);
     nrf_ppi_channel_disable(PPI_EGU_TIMER_START);
@@ -1473,6 +1484,165 @@ static bool current_operation_terminate(nrf_802154_term_t term_lvl,
     return result;
 }
 
+#if NRF_802154_PREEMPTION_POLICY_ENABLED
+
+/** Get the class of the ongoing operation.
+ *
+ * @param[out]  p_class  Class of the ongoing operation.
+ *
+ * @retval true   An operation that a request has to preempt is ongoing.
+ * @retval false  The radio is sleeping or idle.
+ */
+static bool ongoing_operation_class_get(nrf_802154_op_class_t * p_class)
+{
+    bool result = true;
+
+    switch (m_state)
+    {
+        case RADIO_STATE_RX:
+        case RADIO_STATE_TX_ACK:
+#if NRF_802154_DELAYED_TRX_ENABLED
+            if (nrf_802154_delayed_trx_receive_is_ongoing())
+            {
+                *p_class = NRF_802154_OP_CLASS_SCHEDULED_RX;
+                break;
+            }
+#endif // NRF_802154_DELAYED_TRX_ENABLED
+
+            *p_class = NRF_802154_OP_CLASS_IDLE_RX;
+            result   = (m_state == RADIO_STATE_TX_ACK) || psdu_is_being_received();
+            break;
+
+        case RADIO_STATE_CCA_TX:
+        case RADIO_STATE_TX:
+        case RADIO_STATE_RX_ACK:
+            *p_class = m_tx_class;
+            break;
+
+        case RADIO_STATE_ED:
+        case RADIO_STATE_CCA:
+            *p_class = NRF_802154_OP_CLASS_ED_CCA;
+            break;
+
+        default:
+            result = false;
+            break;
+    }
+
+    return result;
+}
+
+/** Terminate ongoing operation according to the priorities of the operation classes.
+ *
+ * A request of a higher priority than the ongoing operation terminates it regardless of its
+ * termination level, and a request of a lower priority never does. A frame being received or the
+ * ACK being transmitted for it is never terminated above the termination level of the request, so
+ * the policy cannot drop it. Each conflict is counted and notified to the higher layer.
+ *
+ * @param[in]  req_class  Class of the requested operation.
+ * @param[in]  term_lvl   Termination level of this request, used if the priorities are equal.
+ * @param[in]  req_orig   Module that originates termination request.
+ * @param[in]  notify     If Termination of current operation shall be notified.
+ *
+ * @retval true   Terminated ongoing operation.
+ * @retval false  Ongoing operation was not terminated.
+ */
+static bool current_operation_preempt(nrf_802154_op_class_t req_class,
+                                      nrf_802154_term_t     term_lvl,
+                                      req_originator_t      req_orig,
+                                      bool                  notify)
+{
+    nrf_802154_op_class_t ongoing_class = NRF_802154_OP_CLASS_IDLE_RX;
+    bool                  conflict      = ongoing_operation_class_get(&ongoing_class);
+    bool                  result;
+
+    if (conflict)
+    {
+        bool frame_ongoing = (m_state == RADIO_STATE_TX_ACK) ||
+                             ((m_state == RADIO_STATE_RX) && psdu_is_being_received());
+
+        if ((m_priorities[req_class] > m_priorities[ongoing_class]) && !frame_ongoing)
+        {
+            term_lvl = NRF_802154_TERM_802154;
+        }
+        else if (m_priorities[req_class] < m_priorities[ongoing_class])
+        {
+            term_lvl = NRF_802154_TERM_NONE;
+        }
+    }
+
+    result = current_operation_terminate(term_lvl, req_orig, notify);
+
+    if (conflict)
+    {
+        if (result)
+        {
+            m_preemption_stats.preempted[ongoing_class]++;
+        }
+        else
+        {
+            m_preemption_stats.denied[req_class]++;
+        }
+
+        nrf_802154_preemption_notify(req_class, ongoing_class, result);
+    }
+
+    return result;
+}
+
+#endif // NRF_802154_PREEMPTION_POLICY_ENABLED
+
+/** Terminate ongoing operation on request of a receive or transmit operation.
+ *
+ * Requests of the next higher layer, CSMA-CA and delayed operations are subject to the preemption
+ * policy. Requests of other modules follow their termination levels.
+ *
+ * @param[in]  tx        If the request is a transmit request.
+ * @param[in]  term_lvl  Termination level of this request. Selects procedures to abort.
+ * @param[in]  req_orig  Module that originates termination request.
+ * @param[in]  notify    If Termination of current operation shall be notified.
+ *
+ * @retval true   Terminated ongoing operation.
+ * @retval false  Ongoing operation was not terminated.
+ */
+static bool trx_request_operation_terminate(bool              tx,
+                                            nrf_802154_term_t term_lvl,
+                                            req_originator_t  req_orig,
+                                            bool              notify)
+{
+#if NRF_802154_PREEMPTION_POLICY_ENABLED
+    switch (req_orig)
+    {
+        case REQ_ORIG_HIGHER_LAYER:
+            return current_operation_preempt(tx ? NRF_802154_OP_CLASS_TX : NRF_802154_OP_CLASS_IDLE_RX,
+                                             term_lvl,
+                                             req_orig,
+                                             notify);
+
+#if NRF_802154_CSMA_CA_ENABLED
+        case REQ_ORIG_CSMA_CA:
+            return current_operation_preempt(NRF_802154_OP_CLASS_TX, term_lvl, req_orig, notify);
+#endif // NRF_802154_CSMA_CA_ENABLED
+
+#if NRF_802154_DELAYED_TRX_ENABLED
+        case REQ_ORIG_DELAYED_TRX:
+            return current_operation_preempt(
+                tx ? NRF_802154_OP_CLASS_SCHEDULED_TX : NRF_802154_OP_CLASS_SCHEDULED_RX,
+                term_lvl,
+                req_orig,
+                notify);
+#endif // NRF_802154_DELAYED_TRX_ENABLED
+
+        default:
+            break;
+    }
+#else // NRF_802154_PREEMPTION_POLICY_ENABLED
+    (void)tx;
+#endif // NRF_802154_PREEMPTION_POLICY_ENABLED
+
+    return current_operation_terminate(term_lvl, req_orig, notify);
+}
+
 /** Enter Sleep state. */
 static void sleep_init(void)
 {
@@ -1656,6 +1826,11 @@ static void rx_init(bool disabled_was_triggered)
     nrf_802154_timer_coord_timestamp_prepare(
         (uint32_t)nrf_radio_event_address_get(NRF_RADIO_EVENT_CRCOK));
 
+#if NRF_802154_ANT_DIVERSITY_ENABLED
+    // Select the initial antenna and switch antennas during the preamble search.
+    nrf_802154_ant_diversity_rx_search_start();
+#endif // NRF_802154_ANT_DIVERSITY_ENABLED
+
     // Start procedure if necessary
     if (!disabled_was_triggered || !ppi_egu_worked())
     {
@@ -1691,9 +1866,13 @@ static bool tx_init(const uint8_t * p_data, bool cca, bool disabled_was_triggere
         return false;
     }
 
-    nrf_radio_txpower_set(nrf_802154_pib_tx_power_get());
+    nrf_radio_txpower_set(nrf_802154_pib_tx_power_frame_get());
     nrf_radio_packetptr_set(p_data);
 
+#if NRF_802154_ANT_DIVERSITY_ENABLED
+    nrf_802154_ant_diversity_tx_antenna_select(p_data);
+#endif // NRF_802154_ANT_DIVERSITY_ENABLED
+
     // Set shorts
     nrf_radio_shorts_set(cca ? SHORTS_CCA_TX : SHORTS_TX);
 
@@ -2032,8 +2211,11 @@ static void irq_bcmatch_state_rx(void)
 
             frame_accepted = false;
 
-            if ((mp_current_rx_buffer->data[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK) !=
-                FRAME_TYPE_ACK)
+            // Frames dropped by the early filter are not reported to save the upper layer from
+            // processing them.
+            if (((mp_current_rx_buffer->data[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK) !=
+                 FRAME_TYPE_ACK) &&
+                (filter_result != NRF_802154_RX_ERROR_FILTERED))
             {
                 receive_failed_notify(filter_result);
             }
@@ -2069,6 +2251,9 @@ static void irq_bcmatch_state_rx(void)
 #if !NRF_802154_DISABLE_BCC_MATCHING || NRF_802154_NOTIFY_CRCERROR
 static void irq_crcerror_state_rx(void)
 {
+#if NRF_802154_ANT_DIVERSITY_ENABLED
+    nrf_802154_ant_diversity_rx_crcerror_hook();
+#endif // NRF_802154_ANT_DIVERSITY_ENABLED
 #if !NRF_802154_DISABLE_BCC_MATCHING
     rx_restart(false);
 #endif // !NRF_802154_DISABLE_BCC_MATCHING
@@ -2091,6 +2276,10 @@ static void irq_crcok_state_rx(void)
     m_flags.psdu_being_received = false;
 #endif
 
+#if NRF_802154_ANT_DIVERSITY_ENABLED
+    nrf_802154_ant_diversity_rx_frame_hook(rssi_last_measurement_get());
+#endif // NRF_802154_ANT_DIVERSITY_ENABLED
+
 #if NRF_802154_DISABLE_BCC_MATCHING
     uint8_t               num_data_bytes      = PHR_SIZE + FCF_SIZE;
     uint8_t               prev_num_data_bytes = 0;
@@ -2904,6 +3093,15 @@ void nrf_802154_core_init(void)
     m_state                    = RADIO_STATE_SLEEP;
     m_rsch_timeslot_is_granted = false;
 
+#if NRF_802154_PREEMPTION_POLICY_ENABLED
+    m_priorities[NRF_802154_OP_CLASS_IDLE_RX]      = NRF_802154_PREEMPTION_PRIORITY_IDLE_RX;
+    m_priorities[NRF_802154_OP_CLASS_TX]           = NRF_802154_PREEMPTION_PRIORITY_TX;
+    m_priorities[NRF_802154_OP_CLASS_ED_CCA]       = NRF_802154_PREEMPTION_PRIORITY_ED_CCA;
+    m_priorities[NRF_802154_OP_CLASS_SCHEDULED_TX] = NRF_802154_PREEMPTION_PRIORITY_SCHEDULED_TX;
+    m_priorities[NRF_802154_OP_CLASS_SCHEDULED_RX] = NRF_802154_PREEMPTION_PRIORITY_SCHEDULED_RX;
+    memset(&m_preemption_stats, 0, sizeof(m_preemption_stats));
+#endif // NRF_802154_PREEMPTION_POLICY_ENABLED
+
     nrf_timer_init();
     nrf_802154_ack_generator_init();
 }
@@ -2962,7 +3160,7 @@ bool nrf_802154_core_receive(nrf_802154_term_t              term_lvl,
         {
             if (critical_section_can_be_processed_now())
             {
-                result = current_operation_terminate(term_lvl, req_orig, notify_abort);
+                result = trx_request_operation_terminate(false, term_lvl, req_orig, notify_abort);
 
                 if (result)
                 {
@@ -3005,13 +3203,22 @@ bool nrf_802154_core_transmit(nrf_802154_term_t              term_lvl,
 
     if (result)
     {
-        result = current_operation_terminate(term_lvl, req_orig, true);
+        result = trx_request_operation_terminate(true, term_lvl, req_orig, true);
 
         if (result)
         {
             // Set state to RX in case sleep terminate succeeded, but transmit_begin fails.
             state_set(RADIO_STATE_RX);
 
+#if NRF_802154_PREEMPTION_POLICY_ENABLED
+#if NRF_802154_DELAYED_TRX_ENABLED
+            m_tx_class = (req_orig == REQ_ORIG_DELAYED_TRX) ? NRF_802154_OP_CLASS_SCHEDULED_TX :
+                         NRF_802154_OP_CLASS_TX;
+#else // NRF_802154_DELAYED_TRX_ENABLED
+            m_tx_class = NRF_802154_OP_CLASS_TX;
+#endif // NRF_802154_DELAYED_TRX_ENABLED
+#endif // NRF_802154_PREEMPTION_POLICY_ENABLED
+
             mp_tx_data = p_data;
             result     = tx_init(p_data, cca, true);
 
@@ -3050,7 +3257,11 @@ bool nrf_802154_core_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_
 
     if (result)
     {
+#if NRF_802154_PREEMPTION_POLICY_ENABLED
+        result = current_operation_preempt(NRF_802154_OP_CLASS_ED_CCA, term_lvl, REQ_ORIG_CORE, true);
+#else // NRF_802154_PREEMPTION_POLICY_ENABLED
         result = current_operation_terminate(term_lvl, REQ_ORIG_CORE, true);
+#endif // NRF_802154_PREEMPTION_POLICY_ENABLED
 
         if (result)
         {
@@ -3072,7 +3283,11 @@ bool nrf_802154_core_cca(nrf_802154_term_t term_lvl)
 
     if (result)
     {
+#if NRF_802154_PREEMPTION_POLICY_ENABLED
+        result = current_operation_preempt(NRF_802154_OP_CLASS_ED_CCA, term_lvl, REQ_ORIG_CORE, true);
+#else // NRF_802154_PREEMPTION_POLICY_ENABLED
         result = current_operation_terminate(term_lvl, REQ_ORIG_CORE, true);
+#endif // NRF_802154_PREEMPTION_POLICY_ENABLED
 
         if (result)
         {
@@ -3269,6 +3484,33 @@ bool nrf_802154_core_last_rssi_measurement_get(int8_t * p_rssi)
     return result;
 }
 
+#if NRF_802154_PREEMPTION_POLICY_ENABLED
+void nrf_802154_core_preemption_priority_set(nrf_802154_op_class_t op_class, uint8_t priority)
+{
+    assert(op_class < NRF_802154_OP_CLASS_NUM);
+
+    m_priorities[op_class] = priority;
+}
+
+uint8_t nrf_802154_core_preemption_priority_get(nrf_802154_op_class_t op_class)
+{
+    assert(op_class < NRF_802154_OP_CLASS_NUM);
+
+    return m_priorities[op_class];
+}
+
+void nrf_802154_core_preemption_stats_get(nrf_802154_preemption_stats_t * p_stats)
+{
+    *p_stats = m_preemption_stats;
+}
+
+void nrf_802154_core_preemption_stats_reset(void)
+{
+    memset(&m_preemption_stats, 0, sizeof(m_preemption_stats));
+}
+
+#endif // NRF_802154_PREEMPTION_POLICY_ENABLED
+
 #if NRF_802154_INTERNAL_RADIO_IRQ_HANDLING
 void RADIO_IRQHandler(void)
 #else // NRF_802154_INTERNAL_RADIO_IRQ_HANDLING
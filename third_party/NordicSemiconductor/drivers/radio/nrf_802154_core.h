@@ -226,6 +226,39 @@ bool nrf_802154_core_rssi_measure(void);
  */
 bool nrf_802154_core_last_rssi_measurement_get(int8_t * p_rssi);
 
+#if NRF_802154_PREEMPTION_POLICY_ENABLED
+
+/**
+ * @brief Sets the priority of an operation class for the preemption policy.
+ *
+ * @param[in]  op_class  Operation class.
+ * @param[in]  priority  Priority of the operation class, higher values preempt lower ones.
+ */
+void nrf_802154_core_preemption_priority_set(nrf_802154_op_class_t op_class, uint8_t priority);
+
+/**
+ * @brief Gets the priority of an operation class for the preemption policy.
+ *
+ * @param[in]  op_class  Operation class.
+ *
+ * @returns  Priority of the operation class.
+ */
+uint8_t nrf_802154_core_preemption_priority_get(nrf_802154_op_class_t op_class);
+
+/**
+ * @brief Gets the statistics of the preemption policy.
+ *
+ * @param[out]  p_stats  Statistics of the preemption policy.
+ */
+void nrf_802154_core_preemption_stats_get(nrf_802154_preemption_stats_t * p_stats);
+
+/**
+ * @brief Clears the statistics of the preemption policy.
+ */
+void nrf_802154_core_preemption_stats_reset(void);
+
+#endif // NRF_802154_PREEMPTION_POLICY_ENABLED
+
 #if !NRF_802154_INTERNAL_IRQ_HANDLING
 /**
  * @brief Notifies the core module that there is a pending IRQ to be handled.
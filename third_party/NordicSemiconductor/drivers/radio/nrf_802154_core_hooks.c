@@ -42,6 +42,7 @@
 #include <stdbool.h>
 
 #include "mac_features/nrf_802154_ack_timeout.h"
+#include "mac_features/nrf_802154_ant_diversity.h"
 #include "mac_features/nrf_802154_csma_ca.h"
 #include "mac_features/nrf_802154_delayed_trx.h"
 #include "nrf_802154_config.h"
@@ -82,6 +83,10 @@ static const transmitted_hook m_transmitted_hooks[] =
     nrf_802154_ack_timeout_transmitted_hook,
 #endif
 
+#if NRF_802154_ANT_DIVERSITY_ENABLED
+    nrf_802154_ant_diversity_transmitted_hook,
+#endif
+
     NULL,
 };
 
@@ -95,6 +100,10 @@ static const tx_failed_hook m_tx_failed_hooks[] =
     nrf_802154_ack_timeout_tx_failed_hook,
 #endif
 
+#if NRF_802154_ANT_DIVERSITY_ENABLED
+    nrf_802154_ant_diversity_tx_failed_hook,
+#endif
+
     NULL,
 };
 
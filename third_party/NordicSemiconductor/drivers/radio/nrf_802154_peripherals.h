@@ -386,6 +386,151 @@ extern "C" {
 
 #endif // NRF_802154_FRAME_TIMESTAMP_ENABLED
 
+#if NRF_802154_ANT_DIVERSITY_ENABLED
+
+/**
+ * @def NRF_802154_ANT_DIVERSITY_TIMER_INSTANCE_NO
+ *
+ * Number of the timer instance used to switch antennas while the receiver searches for a preamble.
+ *
+ * @note This option is used only when the antenna diversity feature is enabled
+ *       (see @ref NRF_802154_ANT_DIVERSITY_ENABLED).
+ *
+ */
+#ifndef NRF_802154_ANT_DIVERSITY_TIMER_INSTANCE_NO
+#define NRF_802154_ANT_DIVERSITY_TIMER_INSTANCE_NO 3
+#endif
+
+/**
+ * @def NRF_802154_ANT_DIVERSITY_TIMER_INSTANCE
+ *
+ * The timer instance used to switch antennas while the receiver searches for a preamble.
+ *
+ */
+#define NRF_802154_ANT_DIVERSITY_TIMER_INSTANCE \
+    NRFX_CONCAT_2(NRF_TIMER, NRF_802154_ANT_DIVERSITY_TIMER_INSTANCE_NO)
+
+/**
+ * @def NRF_802154_ANT_DIVERSITY_GPIOTE_CHANNEL
+ *
+ * The GPIOTE channel driving the antenna selection pin.
+ *
+ * @note This option is used only when the antenna diversity feature is enabled
+ *       (see @ref NRF_802154_ANT_DIVERSITY_ENABLED).
+ * @note The channel must not be used by the FEM, which takes channels 5 to 7 by default.
+ *
+ */
+#ifndef NRF_802154_ANT_DIVERSITY_GPIOTE_CHANNEL
+#define NRF_802154_ANT_DIVERSITY_GPIOTE_CHANNEL 4
+#endif
+
+#if (NRF_802154_FEM_GPIOTE_CHANNELS_USED_MASK | NRF_802154_DEBUG_GPIOTE_CHANNELS_USED_MASK) & \
+    (1 << NRF_802154_ANT_DIVERSITY_GPIOTE_CHANNEL)
+#error "NRF_802154_ANT_DIVERSITY_GPIOTE_CHANNEL is used by the FEM or the debug pins, select a free channel"
+#endif
+
+#if RAAL_SOFTDEVICE && (!defined(NRF_802154_PPI_ANT_DIVERSITY_TIMER_COMPARE_TO_GPIOTE) ||   \
+                        !defined(NRF_802154_PPI_ANT_DIVERSITY_RADIO_READY_TO_TIMER_START) || \
+                        !defined(NRF_802154_PPI_ANT_DIVERSITY_RADIO_ADDR_TO_TIMER_STOP))
+#error "The default antenna diversity PPI channels are reserved by the SoftDevice, select free channels"
+#endif
+
+/**
+ * @def NRF_802154_PPI_ANT_DIVERSITY_TIMER_COMPARE_TO_GPIOTE
+ *
+ * The PPI channel that connects TIMER_COMPARE event to the GPIOTE task toggling the antenna.
+ *
+ * @note This option is used only when the antenna diversity feature is enabled
+ *       (see @ref NRF_802154_ANT_DIVERSITY_ENABLED).
+ * @note The default channel is reserved by the SoftDevice and must be overridden when the driver
+ *       runs alongside it.
+ *
+ */
+#ifndef NRF_802154_PPI_ANT_DIVERSITY_TIMER_COMPARE_TO_GPIOTE
+#define NRF_802154_PPI_ANT_DIVERSITY_TIMER_COMPARE_TO_GPIOTE NRF_PPI_CHANNEL17
+#endif
+
+/**
+ * @def NRF_802154_PPI_ANT_DIVERSITY_RADIO_READY_TO_TIMER_START
+ *
+ * The PPI channel that connects RADIO_RXREADY event to TIMER_START task.
+ *
+ * @note This option is used only when the antenna diversity feature is enabled
+ *       (see @ref NRF_802154_ANT_DIVERSITY_ENABLED).
+ * @note The default channel is reserved by the SoftDevice and must be overridden when the driver
+ *       runs alongside it.
+ *
+ */
+#ifndef NRF_802154_PPI_ANT_DIVERSITY_RADIO_READY_TO_TIMER_START
+#define NRF_802154_PPI_ANT_DIVERSITY_RADIO_READY_TO_TIMER_START NRF_PPI_CHANNEL18
+#endif
+
+/**
+ * @def NRF_802154_PPI_ANT_DIVERSITY_RADIO_ADDR_TO_TIMER_STOP
+ *
+ * The PPI channel that connects RADIO_ADDRESS event to TIMER_STOP task.
+ *
+ * @note This option is used only when the antenna diversity feature is enabled
+ *       (see @ref NRF_802154_ANT_DIVERSITY_ENABLED).
+ * @note The default channel is reserved by the SoftDevice and must be overridden when the driver
+ *       runs alongside it.
+ *
+ */
+#ifndef NRF_802154_PPI_ANT_DIVERSITY_RADIO_ADDR_TO_TIMER_STOP
+#define NRF_802154_PPI_ANT_DIVERSITY_RADIO_ADDR_TO_TIMER_STOP NRF_PPI_CHANNEL19
+#endif
+
+/**
+ * @def NRF_802154_ANT_DIVERSITY_TIMERS_USED_MASK
+ *
+ * Helper bit mask of timer instances used by the 802.15.4 driver for the antenna diversity.
+ */
+#define NRF_802154_ANT_DIVERSITY_TIMERS_USED_MASK (1 << NRF_802154_ANT_DIVERSITY_TIMER_INSTANCE_NO)
+
+/**
+ * @def NRF_802154_ANT_DIVERSITY_PINS_USED_MASK
+ *
+ * Helper bit mask of GPIO pins of port 0 used by the 802.15.4 driver for the antenna diversity.
+ */
+#define NRF_802154_ANT_DIVERSITY_PINS_USED_MASK \
+    ((NRF_802154_ANT_DIVERSITY_PIN < 32) ? (1UL << (NRF_802154_ANT_DIVERSITY_PIN & 0x1F)) : 0)
+
+/**
+ * @def NRF_802154_ANT_DIVERSITY_P1_PINS_USED_MASK
+ *
+ * Helper bit mask of GPIO pins of port 1 used by the 802.15.4 driver for the antenna diversity.
+ */
+#define NRF_802154_ANT_DIVERSITY_P1_PINS_USED_MASK \
+    ((NRF_802154_ANT_DIVERSITY_PIN < 32) ? 0 : (1UL << (NRF_802154_ANT_DIVERSITY_PIN & 0x1F)))
+
+/**
+ * @def NRF_802154_ANT_DIVERSITY_GPIOTE_CHANNELS_USED_MASK
+ *
+ * Helper bit mask of GPIOTE channels used by the 802.15.4 driver for the antenna diversity.
+ */
+#define NRF_802154_ANT_DIVERSITY_GPIOTE_CHANNELS_USED_MASK \
+    (1 << NRF_802154_ANT_DIVERSITY_GPIOTE_CHANNEL)
+
+/**
+ * @def NRF_802154_ANT_DIVERSITY_PPI_CHANNELS_USED_MASK
+ *
+ * Helper bit mask of PPI channels used by the 802.15.4 driver for the antenna diversity.
+ */
+#define NRF_802154_ANT_DIVERSITY_PPI_CHANNELS_USED_MASK               \
+    ((1 << NRF_802154_PPI_ANT_DIVERSITY_TIMER_COMPARE_TO_GPIOTE) |    \
+     (1 << NRF_802154_PPI_ANT_DIVERSITY_RADIO_READY_TO_TIMER_START) | \
+     (1 << NRF_802154_PPI_ANT_DIVERSITY_RADIO_ADDR_TO_TIMER_STOP))
+
+#else // NRF_802154_ANT_DIVERSITY_ENABLED
+
+#define NRF_802154_ANT_DIVERSITY_TIMERS_USED_MASK          0
+#define NRF_802154_ANT_DIVERSITY_PINS_USED_MASK            0
+#define NRF_802154_ANT_DIVERSITY_P1_PINS_USED_MASK         0
+#define NRF_802154_ANT_DIVERSITY_GPIOTE_CHANNELS_USED_MASK 0
+#define NRF_802154_ANT_DIVERSITY_PPI_CHANNELS_USED_MASK    0
+
+#endif // NRF_802154_ANT_DIVERSITY_ENABLED
+
 /**
  * @def NRF_802154_PPI_CORE_GROUP
  *
@@ -423,7 +568,8 @@ extern "C" {
 #ifndef NRF_802154_TIMERS_USED_MASK
 #define NRF_802154_TIMERS_USED_MASK ((1 << NRF_802154_HIGH_PRECISION_TIMER_INSTANCE_NO) | \
                                      (1 << NRF_802154_TIMER_INSTANCE_NO) |                \
-                                     (1 << NRF_802154_COUNTER_TIMER_INSTANCE_NO))
+                                     (1 << NRF_802154_COUNTER_TIMER_INSTANCE_NO) |        \
+                                     NRF_802154_ANT_DIVERSITY_TIMERS_USED_MASK)
 #endif // NRF_802154_TIMERS_USED_MASK
 
 /**
@@ -447,21 +593,32 @@ extern "C" {
 /**
  * @def NRF_802154_GPIO_PINS_USED_MASK
  *
- * Bit mask of GPIO pins used by the 802.15.4 driver.
+ * Bit mask of GPIO pins of port 0 used by the 802.15.4 driver.
  */
 #ifndef NRF_802154_GPIO_PINS_USED_MASK
-#define NRF_802154_GPIO_PINS_USED_MASK (NRF_802154_FEM_PINS_USED_MASK | \
-                                        NRF_802154_DEBUG_PINS_USED_MASK)
+#define NRF_802154_GPIO_PINS_USED_MASK (NRF_802154_FEM_PINS_USED_MASK |   \
+                                        NRF_802154_DEBUG_PINS_USED_MASK | \
+                                        NRF_802154_ANT_DIVERSITY_PINS_USED_MASK)
 #endif // NRF_802154_GPIO_PINS_USED_MASK
 
+/**
+ * @def NRF_802154_GPIO_P1_PINS_USED_MASK
+ *
+ * Bit mask of GPIO pins of port 1 used by the 802.15.4 driver.
+ */
+#ifndef NRF_802154_GPIO_P1_PINS_USED_MASK
+#define NRF_802154_GPIO_P1_PINS_USED_MASK NRF_802154_ANT_DIVERSITY_P1_PINS_USED_MASK
+#endif // NRF_802154_GPIO_P1_PINS_USED_MASK
+
 /**
  * @def NRF_802154_GPIOTE_CHANNELS_USED_MASK
  *
  * Bit mask of GPIOTE peripherals used by the 802.15.4 driver.
  */
 #ifndef NRF_802154_GPIOTE_CHANNELS_USED_MASK
-#define NRF_802154_GPIOTE_CHANNELS_USED_MASK (NRF_802154_FEM_GPIOTE_CHANNELS_USED_MASK | \
-                                              NRF_802154_DEBUG_GPIOTE_CHANNELS_USED_MASK)
+#define NRF_802154_GPIOTE_CHANNELS_USED_MASK (NRF_802154_FEM_GPIOTE_CHANNELS_USED_MASK |   \
+                                              NRF_802154_DEBUG_GPIOTE_CHANNELS_USED_MASK | \
+                                              NRF_802154_ANT_DIVERSITY_GPIOTE_CHANNELS_USED_MASK)
 #endif // NRF_802154_GPIOTE_CHANNELS_USED_MASK
 
 /**
@@ -480,7 +637,8 @@ extern "C" {
                                            NRF_802154_DISABLE_BCC_MATCHING_PPI_CHANNELS_USED_MASK | \
                                            NRF_802154_TIMESTAMP_PPI_CHANNELS_USED_MASK |            \
                                            NRF_802154_FEM_PPI_CHANNELS_USED_MASK |                  \
-                                           NRF_802154_DEBUG_PPI_CHANNELS_USED_MASK)
+                                           NRF_802154_DEBUG_PPI_CHANNELS_USED_MASK |                \
+                                           NRF_802154_ANT_DIVERSITY_PPI_CHANNELS_USED_MASK)
 #endif // NRF_802154_PPI_CHANNELS_USED_MASK
 
 /**
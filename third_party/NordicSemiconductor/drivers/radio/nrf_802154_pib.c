@@ -49,6 +49,7 @@
 typedef struct
 {
     int8_t               tx_power;                             ///< Transmit power.
+    int8_t               tx_power_frame;                       ///< Upper limit of the frame transmit power.
     uint8_t              pan_id[PAN_ID_SIZE];                  ///< Pan Id of this node.
     uint8_t              short_addr[SHORT_ADDRESS_SIZE];       ///< Short Address of this node.
     uint8_t              extended_addr[EXTENDED_ADDRESS_SIZE]; ///< Extended Address of this node.
@@ -122,10 +123,11 @@ static nrf_radio_txpower_t to_radio_tx_power_convert(int8_t integer_tx_power)
 
 void nrf_802154_pib_init(void)
 {
-    m_data.promiscuous = false;
-    m_data.auto_ack    = true;
-    m_data.pan_coord   = false;
-    m_data.channel     = 11;
+    m_data.promiscuous    = false;
+    m_data.auto_ack       = true;
+    m_data.pan_coord      = false;
+    m_data.channel        = 11;
+    m_data.tx_power_frame = INT8_MAX;
 
     memset(m_data.pan_id, 0xff, sizeof(m_data.pan_id));
     m_data.short_addr[0] = 0xfe;
@@ -190,6 +192,20 @@ void nrf_802154_pib_tx_power_set(int8_t dbm)
     m_data.tx_power = dbm;
 }
 
+nrf_radio_txpower_t nrf_802154_pib_tx_power_frame_get(void)
+{
+    int8_t tx_power = m_data.tx_power_frame < m_data.tx_power ? m_data.tx_power_frame : m_data.tx_power;
+
+    tx_power = nrf_802154_fal_tx_power_get(m_data.channel, tx_power);
+
+    return to_radio_tx_power_convert(tx_power);
+}
+
+void nrf_802154_pib_tx_power_frame_set(int8_t dbm)
+{
+    m_data.tx_power_frame = dbm;
+}
+
 const uint8_t * nrf_802154_pib_pan_id_get(void)
 {
     return m_data.pan_id;
@@ -123,6 +123,20 @@ nrf_radio_txpower_t nrf_802154_pib_tx_power_get(void);
  */
 void nrf_802154_pib_tx_power_set(int8_t dbm);
 
+/**
+ * @brief Gets the transmit power used for transmitted frames.
+ *
+ * @returns  The lower of the transmit power and the frame transmit power limit, in dBm.
+ */
+nrf_radio_txpower_t nrf_802154_pib_tx_power_frame_get(void);
+
+/**
+ * @brief Sets the upper limit of the transmit power used for transmitted frames.
+ *
+ * @param[in]  dbm  Transmit power limit in dBm.
+ */
+void nrf_802154_pib_tx_power_frame_set(int8_t dbm);
+
 /**
  * @brief Gets the PAN ID used by this device.
  *
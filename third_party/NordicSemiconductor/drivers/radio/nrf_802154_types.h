@@ -31,6 +31,7 @@
 #ifndef NRF_802154_TYPES_H__
 #define NRF_802154_TYPES_H__
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "nrf_radio.h"
@@ -85,6 +86,7 @@ typedef uint8_t nrf_802154_rx_error_t;
 #define NRF_802154_RX_ERROR_DELAYED_TIMEOUT         0x08 // !< Delayed reception timeslot ended.
 #define NRF_802154_RX_ERROR_INVALID_LENGTH          0x09 // !< Received a frame with invalid length.
 #define NRF_802154_RX_ERROR_DELAYED_ABORTED         0x0A // !< Delayed operation in the ongoing state was aborted by other request.
+#define NRF_802154_RX_ERROR_FILTERED                0x0B // !< Received a frame dropped by the early frame filter.
 
 /**
  * @brief Possible errors during the energy detection.
@@ -119,6 +121,39 @@ typedef uint8_t nrf_802154_term_t;
 #define NRF_802154_TERM_NONE   0x00 // !< Request is skipped if another operation is ongoing.
 #define NRF_802154_TERM_802154 0x01 // !< Request terminates the ongoing 802.15.4 operation.
 
+/**
+ * @brief Class of a radio operation, used by the preemption policy.
+ */
+typedef uint8_t nrf_802154_op_class_t;
+
+#define NRF_802154_OP_CLASS_IDLE_RX      0x00 // !< Reception outside of a scheduled window.
+#define NRF_802154_OP_CLASS_TX           0x01 // !< Transmission requested for now, with or without CSMA-CA.
+#define NRF_802154_OP_CLASS_ED_CCA       0x02 // !< Energy detection or stand-alone CCA.
+#define NRF_802154_OP_CLASS_SCHEDULED_TX 0x03 // !< Delayed transmission.
+#define NRF_802154_OP_CLASS_SCHEDULED_RX 0x04 // !< Delayed reception window.
+#define NRF_802154_OP_CLASS_NUM          0x05 // !< Number of operation classes.
+
+/**
+ * @brief Structure for the statistics of the preemption policy.
+ */
+typedef struct
+{
+    uint32_t preempted[NRF_802154_OP_CLASS_NUM]; // !< Ongoing operations of each class terminated by a request of a higher priority.
+    uint32_t denied[NRF_802154_OP_CLASS_NUM];    // !< Requests of each class denied due to an ongoing operation of a higher priority.
+} nrf_802154_preemption_stats_t;
+
+/**
+ * @brief Structure for the statistics of the HF clock warm policy.
+ */
+typedef struct
+{
+    uint32_t prestarts;     // !< HF clock starts ahead of a deadline requested by the higher layer.
+    uint32_t hits;          // !< Radio operations requested while the HF clock was kept warm and running.
+    uint32_t misses;        // !< Periods the HF clock was kept warm without any radio operation requested.
+    uint64_t latency_saved; // !< Sum of the HF clock ramp-up times avoided by the hits, in microseconds.
+    uint64_t warm_time;     // !< Time the HF clock was running only for the warm policy, in microseconds.
+} nrf_802154_hfclk_warm_stats_t;
+
 /**
  * @brief Structure for configuring CCA.
  */
@@ -138,6 +173,18 @@ typedef uint8_t nrf_802154_ack_data_t;
 #define NRF_802154_ACK_DATA_PENDING_BIT 0x00
 #define NRF_802154_ACK_DATA_IE          0x01
 
+/**
+ * @brief Operation on an ACK data list applied by @ref nrf_802154_ack_data_update.
+ */
+typedef struct
+{
+    const uint8_t * p_addr;   // !< Address of the node (little-endian).
+    bool            extended; // !< If @p p_addr is an extended MAC address or a short MAC address.
+    bool            set;      // !< True if the data is to be set for @p p_addr, false if it is to be removed.
+    const void    * p_data;   // !< Data to be set. Not used when the data is removed.
+    uint8_t         length;   // !< Length of @p p_data. Not used when the data is removed.
+} nrf_802154_ack_data_op_t;
+
 /**
  * @brief Methods of source address matching.
  *
@@ -155,6 +202,58 @@ typedef uint8_t nrf_802154_src_addr_match_t;
 #define NRF_802154_SRC_ADDR_MATCH_ZIGBEE   0x01 // !< Implementation for the Zigbee protocol.
 #define NRF_802154_SRC_ADDR_MATCH_ALWAYS_1 0x02 // !< Standard compliant implementation.
 
+/**
+ * @brief Statistics of the early frame filter.
+ */
+typedef struct
+{
+    uint32_t frame_type;  // !< Number of frames dropped because their frame type is not allowed.
+    uint32_t src_pan_id;  // !< Number of frames dropped because of a blocked source PAN ID.
+    uint32_t src_addr;    // !< Number of frames dropped because of a blocked source address.
+    uint32_t beacon_req;  // !< Number of Beacon Request commands dropped by the rate limit.
+} nrf_802154_filter_stats_t;
+
+/**
+ * @brief Modes of the antenna diversity.
+ */
+typedef uint8_t nrf_802154_ant_diversity_mode_t;
+
+#define NRF_802154_ANT_DIVERSITY_MODE_DISABLED 0x00 // !< Antenna diversity is disabled, the selection pin is not driven.
+#define NRF_802154_ANT_DIVERSITY_MODE_MANUAL   0x01 // !< Antenna is selected with @ref nrf_802154_antenna_set.
+#define NRF_802154_ANT_DIVERSITY_MODE_AUTO     0x02 // !< Antenna is selected by the driver for each frame.
+
+/**
+ * @brief Antennas selectable by the antenna diversity.
+ */
+typedef uint8_t nrf_802154_ant_diversity_antenna_t;
+
+#define NRF_802154_ANT_DIVERSITY_ANTENNA_1 0x00 // !< Antenna selected when the selection pin is low.
+#define NRF_802154_ANT_DIVERSITY_ANTENNA_2 0x01 // !< Antenna selected when the selection pin is high.
+
+#define NRF_802154_ANT_DIVERSITY_ANTENNAS  2    // !< Number of antennas selectable by the antenna diversity.
+
+/**
+ * @brief Statistics of a single antenna used by the antenna diversity.
+ */
+typedef struct
+{
+    uint32_t rx_frames;     // !< Number of frames received with a correct FCS.
+    uint32_t rx_crc_errors; // !< Number of frames received with an incorrect FCS.
+    int8_t   rx_rssi;       // !< Moving average of RSSI of received frames in dBm, 0 if none was received.
+    uint32_t tx_frames;     // !< Number of transmitted frames.
+    uint32_t tx_acked;      // !< Number of transmitted frames acknowledged by the recipient.
+    uint32_t tx_no_ack;     // !< Number of transmitted frames not acknowledged by the recipient.
+} nrf_802154_ant_diversity_antenna_stats_t;
+
+/**
+ * @brief Statistics of the antenna diversity.
+ */
+typedef struct
+{
+    nrf_802154_ant_diversity_antenna_stats_t antenna[NRF_802154_ANT_DIVERSITY_ANTENNAS]; // !< Per-antenna statistics.
+    uint32_t                                 tx_switches;                                // !< Number of retransmissions moved to the other antenna.
+} nrf_802154_ant_diversity_stats_t;
+
 /**
  * @brief RSSI measurement results.
  */
@@ -91,6 +91,17 @@ void nrf_802154_clock_hfclk_stop(void);
  */
 bool nrf_802154_clock_hfclk_is_running(void);
 
+/**
+ * @brief Keeps the High Frequency Clock running regardless of the start and stop requests.
+ *
+ * The High Frequency Clock requested with @p warm set to true keeps running after
+ * @ref nrf_802154_clock_hfclk_stop until this function is called with @p warm set to false.
+ *
+ * @param[in]  warm  If the High Frequency Clock is to be kept running.
+ *
+ */
+void nrf_802154_clock_hfclk_warm_set(bool warm);
+
 /**
  * @brief Starts the Low Frequency Clock.
  *
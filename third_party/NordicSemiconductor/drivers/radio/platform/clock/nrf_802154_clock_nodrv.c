@@ -43,6 +43,10 @@
 #include "nrf_802154_config.h"
 #include "nrf_802154_utils.h"
 
+static volatile bool m_hfclk_requested;     ///< If the HF clock is requested by the driver.
+static bool          m_hfclk_warm;          ///< If the HF clock is requested by the warm policy.
+static volatile bool m_hfclk_ready_pending; ///< If the HF clock kept warm is to be notified as ready.
+
 void nrf_802154_clock_init(void)
 {
     nrf_clock_lf_src_set(NRF_802154_CLOCK_LFCLK_SOURCE);
@@ -69,13 +73,29 @@ void nrf_802154_clock_deinit(void)
 
 void nrf_802154_clock_hfclk_start(void)
 {
-    nrf_clock_event_clear(NRF_CLOCK_EVENT_HFCLKSTARTED);
-    nrf_clock_task_trigger(NRF_CLOCK_TASK_HFCLKSTART);
+    m_hfclk_requested = true;
+
+    if (m_hfclk_warm && nrf_clock_hf_is_running(NRF_CLOCK_HFCLK_HIGH_ACCURACY))
+    {
+        // The start of the HF clock kept warm was not notified, notify it from the clock interrupt.
+        m_hfclk_ready_pending = true;
+        NVIC_SetPendingIRQ(POWER_CLOCK_IRQn);
+    }
+    else
+    {
+        nrf_clock_event_clear(NRF_CLOCK_EVENT_HFCLKSTARTED);
+        nrf_clock_task_trigger(NRF_CLOCK_TASK_HFCLKSTART);
+    }
 }
 
 void nrf_802154_clock_hfclk_stop(void)
 {
-    nrf_clock_task_trigger(NRF_CLOCK_TASK_HFCLKSTOP);
+    m_hfclk_requested = false;
+
+    if (!m_hfclk_warm)
+    {
+        nrf_clock_task_trigger(NRF_CLOCK_TASK_HFCLKSTOP);
+    }
 }
 
 bool nrf_802154_clock_hfclk_is_running(void)
@@ -83,6 +103,25 @@ bool nrf_802154_clock_hfclk_is_running(void)
     return nrf_clock_hf_is_running(NRF_CLOCK_HFCLK_HIGH_ACCURACY);
 }
 
+void nrf_802154_clock_hfclk_warm_set(bool warm)
+{
+    m_hfclk_warm = warm;
+
+    if (m_hfclk_requested)
+    {
+        // The HF clock is already running or starting on request of the driver.
+    }
+    else if (warm)
+    {
+        nrf_clock_event_clear(NRF_CLOCK_EVENT_HFCLKSTARTED);
+        nrf_clock_task_trigger(NRF_CLOCK_TASK_HFCLKSTART);
+    }
+    else
+    {
+        nrf_clock_task_trigger(NRF_CLOCK_TASK_HFCLKSTOP);
+    }
+}
+
 void nrf_802154_clock_lfclk_start(void)
 {
     nrf_clock_event_clear(NRF_CLOCK_EVENT_LFCLKSTARTED);
@@ -101,11 +140,16 @@ bool nrf_802154_clock_lfclk_is_running(void)
 
 void POWER_CLOCK_IRQHandler(void)
 {
-    if (nrf_clock_event_check(NRF_CLOCK_EVENT_HFCLKSTARTED))
+    if (nrf_clock_event_check(NRF_CLOCK_EVENT_HFCLKSTARTED) || m_hfclk_ready_pending)
     {
         nrf_clock_event_clear(NRF_CLOCK_EVENT_HFCLKSTARTED);
+        m_hfclk_ready_pending = false;
 
-        nrf_802154_clock_hfclk_ready();
+        // A start triggered only to keep the HF clock warm must not be reported as granted to the driver.
+        if (m_hfclk_requested)
+        {
+            nrf_802154_clock_hfclk_ready();
+        }
     }
 
     if (nrf_clock_event_check(NRF_CLOCK_EVENT_LFCLKSTARTED))
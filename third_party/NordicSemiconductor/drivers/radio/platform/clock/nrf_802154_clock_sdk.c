@@ -50,6 +50,8 @@ static nrf_drv_clock_handler_item_t m_clock_handler =
     .event_handler = clock_handler,
 };
 
+static bool m_warm; ///< If the HF clock is requested by the warm policy.
+
 static void clock_handler(nrf_drv_clock_evt_type_t event)
 {
     if (event == NRF_DRV_CLOCK_EVT_HFCLK_STARTED)
@@ -88,6 +90,26 @@ bool nrf_802154_clock_hfclk_is_running(void)
     return nrf_drv_clock_hfclk_is_running();
 }
 
+void nrf_802154_clock_hfclk_warm_set(bool warm)
+{
+    if (warm == m_warm)
+    {
+        return;
+    }
+
+    m_warm = warm;
+
+    // The HF clock is reference counted by the clock driver, so it runs until both requests are released.
+    if (warm)
+    {
+        nrf_drv_clock_hfclk_request(NULL);
+    }
+    else
+    {
+        nrf_drv_clock_hfclk_release();
+    }
+}
+
 void nrf_802154_clock_lfclk_start(void)
 {
     nrf_drv_clock_lfclk_request(&m_clock_handler);
@@ -2,6 +2,7 @@
 
 #include <assert.h>
 #include <stddef.h>
+#include <string.h>
 #include <nrf.h>
 
 #include "../nrf_802154_debug.h"
@@ -66,6 +67,24 @@ typedef struct
 
 static dly_ts_t m_dly_ts[RSCH_DLY_TS_NUM];
 
+#if NRF_802154_HFCLK_WARM_ENABLED
+typedef enum
+{
+    HFCLK_WARM_IDLE,    ///< HF clock is not kept warm.
+    HFCLK_WARM_PENDING, ///< HF clock is going to be pre-started ahead of a deadline.
+    HFCLK_WARM_HELD,    ///< HF clock is kept warm.
+} hfclk_warm_state_t;
+
+static hfclk_warm_state_t            m_warm_state;       ///< State of the HF clock warm policy.
+static nrf_802154_timer_t            m_warm_timer;       ///< Timer used to start and release the HF clock kept warm.
+static uint32_t                      m_warm_t0;          ///< Time base of the warm request.
+static uint32_t                      m_warm_prestart_dt; ///< Deadline of the pending pre-start relative to m_warm_t0, zero if none.
+static uint32_t                      m_warm_hold;        ///< Time to keep the HF clock running after the deadline.
+static bool                          m_warm_used;        ///< If a radio operation was requested while the HF clock was kept warm.
+static uint32_t                      m_warm_since;       ///< Start of the period the HF clock is running only to be kept warm.
+static nrf_802154_hfclk_warm_stats_t m_warm_stats;       ///< Statistics of the HF clock warm policy.
+#endif // NRF_802154_HFCLK_WARM_ENABLED
+
 /** @brief Non-blocking mutex for notifying core.
  *
  *  @param[inout]  p_mutex          Pointer to the mutex data.
@@ -189,6 +208,147 @@ static inline void prec_approved_prio_set(rsch_prec_t prec, rsch_prio_t prio)
     nrf_802154_log_exit(prec_approved_prio_set, 2);
 }
 
+#if NRF_802154_HFCLK_WARM_ENABLED
+
+/** @brief Account the time the HF clock was running only to be kept warm. */
+static void hfclk_warm_time_account(void)
+{
+    uint32_t now = nrf_802154_timer_sched_time_get();
+
+    if ((m_warm_state == HFCLK_WARM_HELD) && (m_requested_prio == RSCH_PRIO_IDLE))
+    {
+        m_warm_stats.warm_time += now - m_warm_since;
+    }
+
+    m_warm_since = now;
+}
+
+/** @brief Start keeping the HF clock warm. */
+static void hfclk_warm_hold_start(void)
+{
+    m_warm_state = HFCLK_WARM_HELD;
+    m_warm_used  = false;
+    m_warm_since = nrf_802154_timer_sched_time_get();
+
+    nrf_802154_clock_hfclk_warm_set(true);
+}
+
+/** @brief Stop keeping the HF clock warm. */
+static void hfclk_warm_hold_end(void)
+{
+    hfclk_warm_time_account();
+
+    if (!m_warm_used)
+    {
+        m_warm_stats.misses++;
+    }
+
+    m_warm_state = HFCLK_WARM_IDLE;
+
+    nrf_802154_clock_hfclk_warm_set(false);
+}
+
+/** @brief Update the statistics of the HF clock warm policy when the requested priority changes.
+ *
+ * @param[in]  prev_prio  Priority level requested so far.
+ * @param[in]  new_prio   Priority level requested from now on.
+ */
+static void hfclk_warm_prio_changed(rsch_prio_t prev_prio, rsch_prio_t new_prio)
+{
+    if (m_warm_state != HFCLK_WARM_HELD)
+    {
+        return;
+    }
+
+    if (prev_prio == RSCH_PRIO_IDLE)
+    {
+        hfclk_warm_time_account();
+
+        if (!m_warm_used && nrf_802154_clock_hfclk_is_running())
+        {
+            m_warm_stats.hits++;
+            m_warm_stats.latency_saved += PREC_RAMP_UP_TIME;
+        }
+
+        m_warm_used = true;
+    }
+    else if (new_prio == RSCH_PRIO_IDLE)
+    {
+        m_warm_since = nrf_802154_timer_sched_time_get();
+    }
+}
+
+static void hfclk_warm_timer_handler(void * p_context);
+
+/** @brief Start the timer of the HF clock warm policy.
+ *
+ * @param[in]  dt  Expiration time relative to the time base of the warm request.
+ */
+static void hfclk_warm_timer_start(uint32_t dt)
+{
+    m_warm_timer.t0        = m_warm_t0;
+    m_warm_timer.dt        = dt;
+    m_warm_timer.callback  = hfclk_warm_timer_handler;
+    m_warm_timer.p_context = NULL;
+
+    nrf_802154_timer_sched_add(&m_warm_timer, false);
+}
+
+/** @brief Schedule the pending pre-start of the HF clock, or start it right away if it is late. */
+static void hfclk_warm_prestart_schedule(void)
+{
+    uint32_t now = nrf_802154_timer_sched_time_get();
+
+    if (m_warm_prestart_dt == 0)
+    {
+        return;
+    }
+
+    if ((m_warm_prestart_dt > PREC_RAMP_UP_TIME) &&
+        nrf_802154_timer_sched_time_is_in_future(now, m_warm_t0, m_warm_prestart_dt - PREC_RAMP_UP_TIME))
+    {
+        m_warm_state = HFCLK_WARM_PENDING;
+        hfclk_warm_timer_start(m_warm_prestart_dt - PREC_RAMP_UP_TIME);
+    }
+    else
+    {
+        if (nrf_802154_timer_sched_time_is_in_future(now, m_warm_t0, m_warm_prestart_dt + m_warm_hold))
+        {
+            // Too late to have the HF clock ready at the deadline, start it right away.
+            m_warm_stats.prestarts++;
+            hfclk_warm_hold_start();
+            hfclk_warm_timer_start(m_warm_prestart_dt + m_warm_hold);
+        }
+
+        m_warm_prestart_dt = 0;
+    }
+}
+
+/** Timer callback used to start and release the HF clock kept warm.
+ *
+ * @param[in]  p_context  Unused.
+ */
+static void hfclk_warm_timer_handler(void * p_context)
+{
+    (void)p_context;
+
+    if (m_warm_state == HFCLK_WARM_PENDING)
+    {
+        m_warm_stats.prestarts++;
+        hfclk_warm_hold_start();
+        hfclk_warm_timer_start(m_warm_prestart_dt + m_warm_hold);
+
+        m_warm_prestart_dt = 0;
+    }
+    else
+    {
+        hfclk_warm_hold_end();
+        hfclk_warm_prestart_schedule();
+    }
+}
+
+#endif // NRF_802154_HFCLK_WARM_ENABLED
+
 /** @brief Request all preconditions.
  */
 static inline void all_prec_update(void)
@@ -212,6 +372,10 @@ static inline void all_prec_update(void)
 
         if (prev_prio != new_prio)
         {
+#if NRF_802154_HFCLK_WARM_ENABLED
+            hfclk_warm_prio_changed(prev_prio, new_prio);
+#endif // NRF_802154_HFCLK_WARM_ENABLED
+
             m_requested_prio = new_prio;
 
             nrf_802154_wifi_coex_prio_request(new_prio);
@@ -384,6 +548,12 @@ void nrf_802154_rsch_init(void)
     {
         m_approved_prios[i] = RSCH_PRIO_IDLE;
     }
+
+#if NRF_802154_HFCLK_WARM_ENABLED
+    m_warm_state       = HFCLK_WARM_IDLE;
+    m_warm_prestart_dt = 0;
+    memset(&m_warm_stats, 0, sizeof(m_warm_stats));
+#endif // NRF_802154_HFCLK_WARM_ENABLED
 }
 
 void nrf_802154_rsch_uninit(void)
@@ -393,6 +563,10 @@ void nrf_802154_rsch_uninit(void)
         nrf_802154_timer_sched_remove(&m_dly_ts[i].timer, NULL);
     }
 
+#if NRF_802154_HFCLK_WARM_ENABLED
+    nrf_802154_rsch_hfclk_warm_cancel();
+#endif // NRF_802154_HFCLK_WARM_ENABLED
+
     nrf_802154_wifi_coex_uninit();
     nrf_raal_uninit();
 }
@@ -532,6 +706,112 @@ uint32_t nrf_802154_rsch_timeslot_us_left_get(void)
     return nrf_raal_timeslot_us_left_get();
 }
 
+#if NRF_802154_HFCLK_WARM_ENABLED
+void nrf_802154_rsch_hfclk_warm_request(uint32_t t0,
+                                        uint32_t keep_dt,
+                                        uint32_t prestart_dt,
+                                        uint32_t hold)
+{
+    // The timer and the priority level changes of the driver can preempt the request.
+    uint32_t primask = __get_PRIMASK();
+    uint32_t now;
+
+    __disable_irq();
+
+    now = nrf_802154_timer_sched_time_get();
+    nrf_802154_timer_sched_remove(&m_warm_timer, NULL);
+
+    if ((prestart_dt != 0) && (prestart_dt <= keep_dt + PREC_RAMP_UP_TIME))
+    {
+        // Releasing the HF clock between the keep period and the deadline would not save anything.
+        keep_dt     = prestart_dt + hold;
+        prestart_dt = 0;
+    }
+
+    m_warm_t0          = t0;
+    m_warm_prestart_dt = prestart_dt;
+    m_warm_hold        = hold;
+
+    if ((keep_dt != 0) && nrf_802154_timer_sched_time_is_in_future(now, t0, keep_dt))
+    {
+        if (m_warm_state == HFCLK_WARM_HELD)
+        {
+            // Continue keeping the HF clock warm for a new period.
+            hfclk_warm_time_account();
+
+            if (!m_warm_used)
+            {
+                m_warm_stats.misses++;
+            }
+
+            m_warm_used = false;
+        }
+        else
+        {
+            hfclk_warm_hold_start();
+        }
+
+        hfclk_warm_timer_start(keep_dt);
+    }
+    else
+    {
+        if (m_warm_state == HFCLK_WARM_HELD)
+        {
+            hfclk_warm_hold_end();
+        }
+
+        m_warm_state = HFCLK_WARM_IDLE;
+        hfclk_warm_prestart_schedule();
+    }
+
+    __set_PRIMASK(primask);
+}
+
+void nrf_802154_rsch_hfclk_warm_cancel(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+
+    nrf_802154_timer_sched_remove(&m_warm_timer, NULL);
+
+    if (m_warm_state == HFCLK_WARM_HELD)
+    {
+        hfclk_warm_hold_end();
+    }
+
+    m_warm_state       = HFCLK_WARM_IDLE;
+    m_warm_prestart_dt = 0;
+
+    __set_PRIMASK(primask);
+}
+
+void nrf_802154_rsch_hfclk_warm_stats_get(nrf_802154_hfclk_warm_stats_t * p_stats)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+
+    // Count the time of the ongoing warm period.
+    hfclk_warm_time_account();
+    *p_stats = m_warm_stats;
+
+    __set_PRIMASK(primask);
+}
+
+void nrf_802154_rsch_hfclk_warm_stats_reset(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+
+    memset(&m_warm_stats, 0, sizeof(m_warm_stats));
+
+    __set_PRIMASK(primask);
+}
+
+#endif // NRF_802154_HFCLK_WARM_ENABLED
+
 // External handlers
 
 void nrf_raal_timeslot_started(void)
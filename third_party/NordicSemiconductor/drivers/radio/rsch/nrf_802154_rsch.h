@@ -39,6 +39,9 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "nrf_802154_config.h"
+#include "nrf_802154_types.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -216,6 +219,46 @@ bool nrf_802154_rsch_prec_is_approved(rsch_prec_t prec, rsch_prio_t prio);
  */
 uint32_t nrf_802154_rsch_timeslot_us_left_get(void);
 
+#if NRF_802154_HFCLK_WARM_ENABLED
+
+/**
+ * @brief Keeps the HF clock warm while the radio is idle and pre-starts it ahead of a deadline.
+ *
+ * The HF clock is kept running from now until @p t0 + @p keep_dt. If @p prestart_dt is not zero,
+ * the HF clock is started again so that it is ready at @p t0 + @p prestart_dt, and kept running
+ * until @p hold microseconds later. A deadline that follows the keep period closer than the HF
+ * clock ramp-up time keeps the HF clock running continuously. The request replaces the previous
+ * one.
+ *
+ * @param[in]  t0           Base time of the request, in microseconds.
+ * @param[in]  keep_dt      End of the keep period relative to @p t0, in microseconds.
+ * @param[in]  prestart_dt  Deadline relative to @p t0, in microseconds, or zero if none.
+ * @param[in]  hold         Time to keep the HF clock running after the deadline, in microseconds.
+ */
+void nrf_802154_rsch_hfclk_warm_request(uint32_t t0,
+                                        uint32_t keep_dt,
+                                        uint32_t prestart_dt,
+                                        uint32_t hold);
+
+/**
+ * @brief Releases the HF clock kept warm and cancels any pending pre-start.
+ */
+void nrf_802154_rsch_hfclk_warm_cancel(void);
+
+/**
+ * @brief Gets the statistics of the HF clock warm policy.
+ *
+ * @param[out]  p_stats  Pointer to the structure for the statistics.
+ */
+void nrf_802154_rsch_hfclk_warm_stats_get(nrf_802154_hfclk_warm_stats_t * p_stats);
+
+/**
+ * @brief Clears the statistics of the HF clock warm policy.
+ */
+void nrf_802154_rsch_hfclk_warm_stats_reset(void);
+
+#endif // NRF_802154_HFCLK_WARM_ENABLED
+
 /**
  * @brief Notifies the core about changes of the approved priority level.
  *
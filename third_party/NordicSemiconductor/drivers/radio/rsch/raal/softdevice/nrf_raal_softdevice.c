@@ -161,13 +161,13 @@ static volatile timeslot_state_t m_timeslot_state;
 static timer_action_t m_timer_action;
 
 /**@brief Current timeslot length. */
-static uint16_t m_timeslot_length;
+static uint32_t m_timeslot_length;
 
 /**@brief Previously granted timeslot length. */
-static uint16_t m_prev_timeslot_length;
+static uint32_t m_prev_timeslot_length;
 
 /**@brief Interval between successive timeslot extensions. */
-static uint16_t m_extension_interval;
+static uint32_t m_extension_interval;
 
 /**@brief Number of already performed extentions tries on failed event. */
 static volatile uint16_t m_timeslot_extend_tries;
@@ -175,6 +175,24 @@ static volatile uint16_t m_timeslot_extend_tries;
 /**@brief Defines if timeslot releasing works correctly on given SoftDevice version. */
 static bool m_timeslot_releasing;
 
+/**@brief Length of timeslot requests and extensions sized by the adaptive policy. */
+static uint32_t m_adaptive_length;
+
+/**@brief Length of the last requested timeslot extension. */
+static uint32_t m_extend_length;
+
+/**@brief Number of 802.15.4 radio events since the last adaptation of the timeslot length. */
+static volatile uint32_t m_activity_count;
+
+/**@brief Number of denied timeslot requests and extensions since the last adaptation of the timeslot length. */
+static volatile uint32_t m_denial_count;
+
+/**@brief Defines if the last timeslot extension was denied by the SoftDevice. */
+static volatile bool m_extend_denied;
+
+/**@brief RAAL statistics. */
+static nrf_raal_softdevice_stats_t m_stats;
+
 /***************************************************************************************************
  * @section Drift calculations
  **************************************************************************************************/
@@ -183,12 +201,67 @@ static uint32_t time_corrected_for_drift_get(uint32_t time)
 {
     uint32_t ppm = m_config.lf_clk_accuracy_ppm + MAX_HFCLK_PPM;
 
-    return time - NRF_802154_DIVIDE_AND_CEIL(time * ppm, PPM_UNIT);
+    return time - (uint32_t)NRF_802154_DIVIDE_AND_CEIL((uint64_t)time * ppm, PPM_UNIT);
 }
 
 static void calculate_config(void)
 {
-    m_extension_interval = time_corrected_for_drift_get(m_config.timeslot_length);
+    m_adaptive_length    = m_config.timeslot_length;
+    m_extension_interval = time_corrected_for_drift_get(m_adaptive_length);
+}
+
+/***************************************************************************************************
+ * @section Adaptive timeslot length.
+ **************************************************************************************************/
+
+/**@brief Check if the adaptive timeslot length policy is enabled. */
+static inline bool adaptive_length_is_enabled(void)
+{
+    return m_config.timeslot_adaptive_max_length > m_config.timeslot_length;
+}
+
+/**@brief Size the next timeslot request or extension from the recent radio activity.
+ *
+ * The length is doubled while the 802.15.4 radio is active, to lower the overhead of timeslot
+ * scheduling, and halved back towards the configured length when the radio is idle or when the
+ * SoftDevice denies timeslots, to give more radio time to the SoftDevice.
+ */
+static void adaptive_length_update(void)
+{
+    uint32_t length = m_adaptive_length;
+
+    if (!adaptive_length_is_enabled())
+    {
+        return;
+    }
+
+    if ((m_denial_count == 0) && (m_activity_count != 0))
+    {
+        length <<= 1;
+    }
+    else
+    {
+        length >>= 1;
+    }
+
+    if (length > m_config.timeslot_adaptive_max_length)
+    {
+        length = m_config.timeslot_adaptive_max_length;
+    }
+
+    if (length < m_config.timeslot_length)
+    {
+        length = m_config.timeslot_length;
+    }
+
+    m_activity_count = 0;
+    m_denial_count   = 0;
+
+    if (length != m_adaptive_length)
+    {
+        m_adaptive_length    = length;
+        m_extension_interval = time_corrected_for_drift_get(length);
+    }
 }
 
 /***************************************************************************************************
@@ -302,7 +375,7 @@ static void timer_on_extend_update(void)
     }
     else
     {
-        uint16_t extension_interval = (m_prev_timeslot_length == m_config.timeslot_length) ?
+        uint32_t extension_interval = (m_prev_timeslot_length == m_adaptive_length) ?
                                       m_extension_interval :
                                       time_corrected_for_drift_get(m_prev_timeslot_length);
 
@@ -320,7 +393,7 @@ static void timer_on_extend_update(void)
 static inline void timeslot_data_init(void)
 {
     m_timeslot_extend_tries = 0;
-    m_timeslot_length       = m_config.timeslot_length;
+    m_timeslot_length       = m_adaptive_length;
 }
 
 /**@brief Indicate if timeslot is in idle state. */
@@ -395,6 +468,7 @@ static void timeslot_extend(uint32_t timeslot_length)
 {
     m_ret_param.callback_action         = NRF_RADIO_SIGNAL_CALLBACK_ACTION_EXTEND;
     m_ret_param.params.extend.length_us = timeslot_length;
+    m_extend_length                     = timeslot_length;
 
     nrf_802154_pin_set(PIN_DBG_TIMESLOT_EXTEND_REQ);
     nrf_802154_log(EVENT_TIMESLOT_REQUEST, m_ret_param.params.extend.length_us);
@@ -435,6 +509,13 @@ static void timer_irq_handle(void)
                 m_timeslot_state = TIMESLOT_STATE_IDLE;
                 timeslot_ended_notify();
 
+                // Reaching the margin after a denied extension means the SoftDevice took the radio
+                // over, reaching it after a granted one is the regular end of the timeslot.
+                if (m_continuous && m_extend_denied)
+                {
+                    m_stats.preempted_count++;
+                }
+
                 // Ignore any other events.
                 timer_reset();
 
@@ -459,12 +540,19 @@ static void timer_irq_handle(void)
             nrf_timer_int_disable(RAAL_TIMER, TIMER_CC_ACTION_INT);
             nrf_timer_event_clear(RAAL_TIMER, TIMER_CC_ACTION_EVENT);
 
+            if (m_continuous && (m_timeslot_extend_tries == 0))
+            {
+                // Size the extension from the radio activity during the previous one.
+                adaptive_length_update();
+                m_timeslot_length = m_adaptive_length;
+            }
+
             if (m_continuous &&
                 (nrf_timer_cc_read(RAAL_TIMER, TIMER_CC_ACTION) +
-                 m_config.timeslot_length < m_config.timeslot_max_length))
+                 m_adaptive_length < m_config.timeslot_max_length))
             {
                 // Try to extend timeslot.
-                timeslot_extend(m_config.timeslot_length);
+                timeslot_extend(m_adaptive_length);
             }
             else
             {
@@ -520,6 +608,10 @@ static nrf_radio_signal_callback_return_param_t * signal_handler(uint8_t signal_
 
             assert(m_timeslot_state == TIMESLOT_STATE_REQUESTED);
 
+            m_stats.granted_count++;
+            m_stats.granted_time_us += m_timeslot_length;
+            m_extend_denied = false;
+
             // Set up timer first with requested timeslot length.
             timer_start();
 
@@ -549,6 +641,7 @@ static nrf_radio_signal_callback_return_param_t * signal_handler(uint8_t signal_
             {
                 if (!timer_is_margin_reached())
                 {
+                    m_activity_count++;
                     nrf_802154_radio_irq_handler();
                 }
                 else
@@ -570,6 +663,10 @@ static nrf_radio_signal_callback_return_param_t * signal_handler(uint8_t signal_
             nrf_802154_pin_tgl(PIN_DBG_TIMESLOT_FAILED);
             nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_RAAL_SIG_EVENT_EXTEND_FAIL);
 
+            m_stats.extend_failed_count++;
+            m_denial_count++;
+            m_extend_denied = true;
+
             if (!timer_is_set_to_margin())
             {
                 timer_to_margin_set();
@@ -583,6 +680,9 @@ static nrf_radio_signal_callback_return_param_t * signal_handler(uint8_t signal_
         case NRF_RADIO_CALLBACK_SIGNAL_TYPE_EXTEND_SUCCEEDED: /**< This signal indicates extend action succeeded. */
             nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_RAAL_SIG_EVENT_EXTEND_SUCCESS);
 
+            m_stats.granted_time_us += m_extend_length;
+            m_extend_denied = false;
+
             if ((!timer_is_set_to_margin()) &&
                 (ticks_to_timeslot_end_get() <
                  MINIMUM_TIMESLOT_LENGTH_EXTENSION_TIME_TICKS))
@@ -635,6 +735,9 @@ void nrf_raal_softdevice_soc_evt_handler(uint32_t evt_id)
 
             m_timeslot_state = TIMESLOT_STATE_IDLE;
 
+            m_stats.denied_count++;
+            m_denial_count++;
+
             if (m_continuous)
             {
                 if (m_timeslot_extend_tries < m_config.timeslot_alloc_iters)
@@ -661,6 +764,7 @@ void nrf_raal_softdevice_soc_evt_handler(uint32_t evt_id)
 
             if (m_continuous && timeslot_is_idle())
             {
+                adaptive_length_update();
                 timeslot_data_init();
                 timeslot_request();
             }
@@ -692,6 +796,21 @@ void nrf_raal_softdevice_config(const nrf_raal_softdevice_cfg_t * p_cfg)
     calculate_config();
 }
 
+void nrf_raal_softdevice_stats_get(nrf_raal_softdevice_stats_t * p_stats)
+{
+    assert(p_stats);
+
+    // Statistics are updated from the SoftDevice radio signal handler which cannot be masked,
+    // repeat the copy until it is consistent.
+    do
+    {
+        *p_stats = m_stats;
+    }
+    while (p_stats->granted_time_us != m_stats.granted_time_us);
+
+    p_stats->timeslot_length = m_adaptive_length;
+}
+
 void nrf_raal_init(void)
 {
     assert(!m_initialized);
@@ -706,6 +825,10 @@ void nrf_raal_init(void)
     m_config.timeslot_timeout     = NRF_RAAL_TIMESLOT_DEFAULT_TIMEOUT;
     m_config.lf_clk_accuracy_ppm  = NRF_RAAL_DEFAULT_LF_CLK_ACCURACY_PPM;
 
+    m_config.timeslot_adaptive_max_length = NRF_RAAL_TIMESLOT_DEFAULT_ADAPTIVE_MAX_LENGTH;
+
+    memset(&m_stats, 0, sizeof(m_stats));
+
     calculate_config();
 
     uint32_t err_code = sd_radio_session_open(signal_handler);
@@ -816,6 +939,8 @@ bool nrf_raal_timeslot_request(uint32_t length_us)
         return false;
     }
 
+    m_activity_count++;
+
     us_left = nrf_raal_timeslot_us_left_get();
 
     assert((us_left >= nrf_802154_rx_duration_get(MAX_PACKET_SIZE,
@@ -53,6 +53,7 @@ extern "C" {
         NRF_RAAL_DEFAULT_LF_CLK_ACCURACY_PPM)
 #define NRF_RAAL_TIMESLOT_DEFAULT_TIMEOUT                   2500
 #define NRF_RAAL_TIMESLOT_DEFAULT_MAX_LENGTH                120000000
+#define NRF_RAAL_TIMESLOT_DEFAULT_ADAPTIVE_MAX_LENGTH       0
 #define NRF_RAAL_DEFAULT_LF_CLK_ACCURACY_PPM                500
 
 #define NRF_RAAL_TIMESLOT_DEFAULT_SAFE_MARGIN_LFRC_TICKS    4
@@ -116,8 +117,29 @@ typedef struct
      * @brief The clock accuracy in ppm unit.
      */
     uint16_t lf_clk_accuracy_ppm;
+
+    /**
+     * @brief The maximum length of timeslot requests and extensions sized by the adaptive policy,
+     *        in microseconds.
+     *
+     * The length grows from timeslot_length up to this value while there is 802.15.4 radio
+     * activity, and shrinks back when the radio is idle or the SoftDevice denies timeslots.
+     * Value not greater than timeslot_length, including the default 0, disables the adaptive policy.
+     */
+    uint32_t timeslot_adaptive_max_length;
 } nrf_raal_softdevice_cfg_t;
 
+/** @brief RAAL SoftDevice statistics. */
+typedef struct
+{
+    uint64_t granted_time_us;     ///< Total timeslot time granted by the SoftDevice, in microseconds.
+    uint32_t granted_count;       ///< Number of granted timeslots.
+    uint32_t denied_count;        ///< Number of timeslot requests blocked or canceled by the SoftDevice.
+    uint32_t extend_failed_count; ///< Number of timeslot extensions denied by the SoftDevice.
+    uint32_t preempted_count;     ///< Number of timeslots ended by the safe margin after a denied extension.
+    uint32_t timeslot_length;     ///< Current length of timeslot requests and extensions, in microseconds.
+} nrf_raal_softdevice_stats_t;
+
 /**
  * @brief Informs the RAAL client about the SoftDevice SoC events.
  *
@@ -130,6 +152,12 @@ void nrf_raal_softdevice_soc_evt_handler(uint32_t evt_id);
  */
 void nrf_raal_softdevice_config(const nrf_raal_softdevice_cfg_t * p_cfg);
 
+/**
+ * @brief Gets RAAL statistics.
+ *
+ */
+void nrf_raal_softdevice_stats_get(nrf_raal_softdevice_stats_t * p_stats);
+
 /**
  *@}
  **/
@@ -71,6 +71,12 @@ NRF_LOG_MODULE_REGISTER();
 static uint8_t                                m_version_string[] = APP_NAME " " VERSION_STRING; ///< Human-readable version string.
 static app_usbd_nrf_dfu_trigger_nordic_info_t m_dfu_info;                                       ///< Struct with various information about the current firmware.
 
+__WEAK void nrf_dfu_trigger_usb_detach(void)
+{
+    nrf_gpio_cfg_output(BSP_SELF_PINRESET_PIN);
+    nrf_gpio_pin_clear(BSP_SELF_PINRESET_PIN);
+}
+
 static void dfu_trigger_evt_handler(app_usbd_class_inst_t        const *  p_inst,
                                     app_usbd_nrf_dfu_trigger_user_event_t event)
 {
@@ -79,10 +85,9 @@ static void dfu_trigger_evt_handler(app_usbd_class_inst_t        const *  p_inst
     switch (event)
     {
         case APP_USBD_NRF_DFU_TRIGGER_USER_EVT_DETACH:
-            NRF_LOG_INFO("DFU Detach request received. Triggering a pin reset.");
+            NRF_LOG_INFO("DFU Detach request received.");
             NRF_LOG_FINAL_FLUSH();
-            nrf_gpio_cfg_output(BSP_SELF_PINRESET_PIN);
-            nrf_gpio_pin_clear(BSP_SELF_PINRESET_PIN);
+            nrf_dfu_trigger_usb_detach();
             break;
         default:
             break;
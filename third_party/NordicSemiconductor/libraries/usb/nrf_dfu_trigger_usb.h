@@ -69,6 +69,14 @@
  */
 ret_code_t nrf_dfu_trigger_usb_init(void);
 
+/**
+ * @brief Function called when the host requests the device to detach and enter the bootloader.
+ *
+ * @details The default implementation triggers a pin reset through @ref BSP_SELF_PINRESET_PIN. It is
+ *          weak and can be overridden by the application to enter the bootloader in another way.
+ */
+void nrf_dfu_trigger_usb_detach(void);
+
 /** @} */
 
 #endif //NRF_DFU_TRIGGER_USB_H